@@ -48,10 +48,13 @@ bool FDlgCondition::IsConditionMet(const UDlgContext& Context, const UObject* Pa
 	{
 		if (CustomCondition == nullptr)
 		{
-			FDlgLogger::Get().Errorf(
-				TEXT("Custom Condition is empty (not valid). IsConditionMet returning false.\nContext:\n\t%s, Participant = %s"),
-				*Context.GetContextString(), Participant ? *Participant->GetPathName() : TEXT("INVALID")
-			);
+			FDlgLogger::Get().ErrorLazy([&]()
+			{
+				return FString::Printf(
+					TEXT("Custom Condition is empty (not valid). IsConditionMet returning false.\nContext:\n\t%s, Participant = %s"),
+					*Context.GetContextString(), Participant ? *Participant->GetPathName() : TEXT("INVALID")
+				);
+			});
 			return false;
 		}
 
@@ -152,10 +155,13 @@ bool FDlgCondition::CheckFloat(const UDlgContext& Context, double Value) const
 			return !FMath::IsNearlyEqual(Value, ValueToCheckAgainst);
 
 		default:
-			FDlgLogger::Get().Errorf(
-				TEXT("Invalid Operation in float based condition.\nContext:\n\t%s"),
-				*Context.GetContextString()
-			);
+			FDlgLogger::Get().ErrorLazy([&]()
+			{
+				return FString::Printf(
+					TEXT("Invalid Operation in float based condition.\nContext:\n\t%s"),
+					*Context.GetContextString()
+				);
+			});
 			return false;
 	}
 }
@@ -202,10 +208,13 @@ bool FDlgCondition::CheckInt(const UDlgContext& Context, int32 Value) const
 			return Value != ValueToCheckAgainst;
 
 		default:
-			FDlgLogger::Get().Errorf(
-				TEXT("Invalid Operation in int based condition.\nContext:\n\t%s"),
-				*Context.GetContextString()
-			);
+			FDlgLogger::Get().ErrorLazy([&]()
+			{
+				return FString::Printf(
+					TEXT("Invalid Operation in int based condition.\nContext:\n\t%s"),
+					*Context.GetContextString()
+				);
+			});
 			return false;
 	}
 }
@@ -270,10 +279,13 @@ bool FDlgCondition::ValidateIsParticipantValid(const UDlgContext& Context, const
 		return true;
 	}
 
-	FDlgLogger::Get().Errorf(
-		TEXT("%s FAILED because the PARTICIPANT is INVALID.\nContext:\n\t%s, ConditionType = %s"),
-		*ContextString, *Context.GetContextString(), *ConditionTypeToString(ConditionType)
-	);
+	FDlgLogger::Get().ErrorLazy([&]()
+	{
+		return FString::Printf(
+			TEXT("%s FAILED because the PARTICIPANT is INVALID.\nContext:\n\t%s, ConditionType = %s"),
+			*ContextString, *Context.GetContextString(), *ConditionTypeToString(ConditionType)
+		);
+	});
 	return false;
 }
 
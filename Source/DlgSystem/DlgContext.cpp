@@ -511,7 +511,11 @@ bool UDlgContext::EnterNode(int32 NodeIndex, TSet<const UDlgNode*> NodesEnteredW
 	ActiveNodeIndex = NodeIndex;
 	SetNodeVisited(NodeIndex, Node->GetGUID());
 
-	return Node->HandleNodeEnter(*this, NodesEnteredWithThisStep);
+	EnterNodeDepth++;
+	MaxEnterNodeDepth = FMath::Max(MaxEnterNodeDepth, EnterNodeDepth);
+	const bool bResult = Node->HandleNodeEnter(*this, NodesEnteredWithThisStep);
+	EnterNodeDepth--;
+	return bResult;
 }
 
 UDlgContext* UDlgContext::CreateCopy() const
@@ -367,6 +367,9 @@ public:
 	// Conditions are not checked here - they are expected to be satisfied
 	bool EnterNode(int32 NodeIndex, TSet<const UDlgNode*> NodesEnteredWithThisStep);
 
+	// The deepest EnterNode() recursion this context had so far, 1 means no node entered another node
+	int32 GetMaxEnterNodeDepth() const { return MaxEnterNodeDepth; }
+
 	// Adds the node as visited in the current dialogue memory
 	virtual void SetNodeVisited(int32 NodeIndex, const FGuid& NodeGUID);
 
@@ -616,4 +619,8 @@ protected:
 
 	// cache the result of the last ChooseOption call
 	bool bDialogueEnded = false;
+
+	// Depth of the current EnterNode() recursion (proxies, selectors, virtual parents) and the max reached so far
+	int32 EnterNodeDepth = 0;
+	int32 MaxEnterNodeDepth = 0;
 };
@@ -4,6 +4,7 @@
 #include "UObject/DevObjectVersion.h"
 #include "HAL/FileManager.h"
 #include "Misc/Paths.h"
+#include "Hash/CityHash.h"
 
 #if WITH_EDITOR
 #include "EdGraph/EdGraph.h"
@@ -15,6 +16,9 @@
 #include "IO/DlgConfigWriter.h"
 #include "IO/DlgJsonWriter.h"
 #include "IO/DlgJsonParser.h"
+#include "IO/DlgBinaryWriter.h"
+#include "IO/DlgBinaryParser.h"
+#include "IO/DlgHashWriter.h"
 #include "Nodes/DlgNode_Speech.h"
 #include "Nodes/DlgNode_End.h"
 #include "Nodes/DlgNode_Start.h"
@@ -65,7 +69,7 @@ void UDlgDialogue::PreSave(const class ITargetPlatform* TargetPlatform)
 
 	Name = GetDialogueFName();
 	bWasLoaded = true;
-	OnPreAssetSaved();
+	OnPreAssetSaved(bExportToFileOnSave);
 }
 
 void UDlgDialogue::Serialize(FArchive& Ar)
@@ -251,6 +255,7 @@ bool UDlgDialogue::Modify(bool bAlwaysMarkDirty)
 		return false;
 	}
 
+	InvalidateSearchDataTagValue();
 	const bool bWasSaved = Super::Modify(bAlwaysMarkDirty);
 	// if (StartNode)
 	// {
@@ -268,6 +273,7 @@ bool UDlgDialogue::Modify(bool bAlwaysMarkDirty)
 void UDlgDialogue::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
+	InvalidateSearchDataTagValue();
 
 	// Signal to the listeners
 	check(OnDialoguePropertyChanged.IsBound());
@@ -307,6 +313,45 @@ void UDlgDialogue::PostEditChangeChainProperty(struct FPropertyChangedChainEvent
 	Super::PostEditChangeChainProperty(PropertyChangedEvent);
 }
 
+const FString& UDlgDialogue::GetCachedSearchDataTagValue() const
+{
+	check(DialogueEditorAccess.IsValid());
+
+	// The GUID is part of the search data, it is changed without Modify (see RegenerateGUID)
+	if (!CachedSearchDataTagValue.IsSet() || CachedSearchDataTagGUID != GUID)
+	{
+		CachedSearchDataTagValue = DialogueEditorAccess->GetSearchDataTagValue(this);
+		CachedSearchDataTagGUID = GUID;
+	}
+	return CachedSearchDataTagValue.GetValue();
+}
+
+#if NY_ENGINE_VERSION >= 504
+void UDlgDialogue::GetAssetRegistryTags(FAssetRegistryTagsContext Context) const
+{
+	Super::GetAssetRegistryTags(Context);
+
+	// Only the editor module knows how to extract the search data from the graph
+	// The search data is only used by the editor, not needed in the cooked asset registry
+	if (DialogueEditorAccess.IsValid() && DlgGraph && !Context.IsCooking())
+	{
+		Context.AddTag(FAssetRegistryTag(GetSearchDataTagName(), GetCachedSearchDataTagValue(), FAssetRegistryTag::TT_Hidden));
+	}
+}
+#else
+void UDlgDialogue::GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const
+{
+	Super::GetAssetRegistryTags(OutTags);
+
+	// Only the editor module knows how to extract the search data from the graph
+	// The search data is only used by the editor, not needed in the cooked asset registry
+	if (DialogueEditorAccess.IsValid() && DlgGraph && !IsRunningCookCommandlet())
+	{
+		OutTags.Add(FAssetRegistryTag(GetSearchDataTagName(), GetCachedSearchDataTagValue(), FAssetRegistryTag::TT_Hidden));
+	}
+}
+#endif
+
 void UDlgDialogue::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
 {
 	// Add the graph to the list of referenced objects
@@ -472,6 +517,21 @@ void UDlgDialogue::ImportFromFileFormat(EDlgDialogueTextFormat TextFormat)
 		return;
 	}
 
+	// TODO(vampy): Check for errors
+	check(TextFormat != EDlgDialogueTextFormat::None);
+	TUniquePtr<IDlgParser> Parser = CreateTextFormatParser(TextFormat);
+	if (!Parser.IsValid())
+	{
+		checkNoEntry();
+		return;
+	}
+
+	Parser->InitializeParser(TextFileName);
+	ImportFromParser(*Parser, TextFileName);
+}
+
+void UDlgDialogue::ImportFromParser(IDlgParser& Parser, const FString& TextFileName)
+{
 	// Clear data first
 	StartNode_DEPRECATED = nullptr;
 	Nodes.Empty();
@@ -479,29 +539,7 @@ void UDlgDialogue::ImportFromFileFormat(EDlgDialogueTextFormat TextFormat)
 
 	// TODO handle Name == NAME_None or invalid filename
 	FDlgLogger::Get().Infof(TEXT("Reloading data for Dialogue = `%s` FROM file = `%s`"), *GetPathName(), *TextFileName);
-
-	// TODO(vampy): Check for errors
-	check(TextFormat != EDlgDialogueTextFormat::None);
-	switch (TextFormat)
-	{
-		case EDlgDialogueTextFormat::JSON:
-		{
-			FDlgJsonParser JsonParser;
-			JsonParser.InitializeParser(TextFileName);
-			JsonParser.ReadAllProperty(GetClass(), this, this);
-			break;
-		}
-		case EDlgDialogueTextFormat::DialogueDEPRECATED:
-		{
-			FDlgConfigParser Parser(TEXT("Dlg"));
-			Parser.InitializeParser(TextFileName);
-			Parser.ReadAllProperty(GetClass(), this, this);
-			break;
-		}
-		default:
-			checkNoEntry();
-			break;
-	}
+	Parser.ReadAllProperty(GetClass(), this, this);
 
 	if (IsValid(StartNode_DEPRECATED))
 	{
@@ -542,7 +580,7 @@ void UDlgDialogue::ImportFromFileFormat(EDlgDialogueTextFormat TextFormat)
 	UpdateAndRefreshData(true);
 }
 
-void UDlgDialogue::OnPreAssetSaved()
+void UDlgDialogue::OnPreAssetSaved(bool bExportToFile)
 {
 #if WITH_EDITOR
 	// Compile, graph data -> dialogue data
@@ -551,7 +589,10 @@ void UDlgDialogue::OnPreAssetSaved()
 
 	// Save file, dialogue data -> text file (.dlg)
 	UpdateAndRefreshData(true);
-	ExportToFile();
+	if (bExportToFile)
+	{
+		ExportToFileIfChanged();
+	}
 }
 
 void UDlgDialogue::ExportToFile() const
@@ -566,9 +607,62 @@ void UDlgDialogue::ExportToFile() const
 	ExportToFileFormat(TextFormat);
 }
 
-void UDlgDialogue::ExportToFileFormat(EDlgDialogueTextFormat TextFormat) const
+bool UDlgDialogue::ExportToFileIfChanged()
+{
+	const EDlgDialogueTextFormat TextFormat = GetDefault<UDlgSystemSettings>()->DialogueTextFormat;
+	if (TextFormat == EDlgDialogueTextFormat::None)
+	{
+		return false;
+	}
+
+#if WITH_EDITORONLY_DATA
+	// All is used for debugging, always export
+	if (TextFormat != EDlgDialogueTextFormat::All)
+	{
+		const uint64 ContentHash = ComputeTextFileContentHash(TextFormat);
+		if (ContentHash == TextFileContentHash && IFileManager::Get().FileExists(*GetTextFilePathName(TextFormat)))
+		{
+			FDlgLogger::Get().Debugf(TEXT("Skipped exporting Dialogue = `%s`, nothing changed since the last export"), *GetPathName());
+			return false;
+		}
+
+		if (!ExportToFileFormat(TextFormat))
+		{
+			return false;
+		}
+
+		UpdateTextFileContentHash(ContentHash);
+		return true;
+	}
+#endif
+
+	return ExportToFileFormat(TextFormat);
+}
+
+void UDlgDialogue::UpdateTextFileContentHash(uint64 ContentHash)
+{
+#if WITH_EDITORONLY_DATA
+	TextFileContentHash = ContentHash;
+#endif
+}
+
+uint64 UDlgDialogue::ComputeTextFileContentHash(EDlgDialogueTextFormat TextFormat) const
+{
+	// Exporting to another format or file must not be skipped
+	const FString TextFileName = GetTextFilePathName(TextFormat);
+	const uint64 Seed = CityHash64WithSeed(
+		reinterpret_cast<const char*>(*TextFileName),
+		TextFileName.Len() * sizeof(TCHAR),
+		static_cast<uint64>(TextFormat)
+	);
+
+	FDlgHashWriter HashWriter(Seed);
+	HashWriter.Write(GetClass(), this);
+	return HashWriter.GetHash();
+}
+
+bool UDlgDialogue::ExportToFileFormat(EDlgDialogueTextFormat TextFormat) const
 {
-	// TODO(vampy): Check for errors
 	const bool bHasExtension = UDlgSystemSettings::HasTextFileExtension(TextFormat);
 	const FString& TextFileName = GetTextFilePathName(TextFormat);
 	if (bHasExtension)
@@ -576,43 +670,77 @@ void UDlgDialogue::ExportToFileFormat(EDlgDialogueTextFormat TextFormat) const
 		FDlgLogger::Get().Infof(TEXT("Exporting data for Dialogue = `%s` TO file = `%s`"), *GetPathName(), *TextFileName);
 	}
 
-	switch (TextFormat)
+	if (TUniquePtr<IDlgWriter> Writer = CreateTextFormatWriter(TextFormat))
 	{
-		case EDlgDialogueTextFormat::JSON:
+		Writer->Write(GetClass(), this);
+		if (!Writer->ExportToFile(TextFileName))
 		{
-			FDlgJsonWriter JsonWriter;
-			JsonWriter.Write(GetClass(), this);
-			JsonWriter.ExportToFile(TextFileName);
-			break;
-		}
-		case EDlgDialogueTextFormat::DialogueDEPRECATED:
-		{
-			FDlgConfigWriter DlgWriter(TEXT("Dlg"));
-			DlgWriter.Write(GetClass(), this);
-			DlgWriter.ExportToFile(TextFileName);
-			break;
+			FDlgLogger::Get().Errorf(TEXT("Could not export Dialogue = `%s` TO file = `%s`"), *GetPathName(), *TextFileName);
+			return false;
 		}
+		return true;
+	}
+
+	switch (TextFormat)
+	{
 		case EDlgDialogueTextFormat::All:
 		{
 			// Useful for debugging
 			// Export to all  formats
+			bool bAllExported = true;
 			const int32 TextFormatsNum = static_cast<int32>(EDlgDialogueTextFormat::NumTextFormats);
 			for (int32 TextFormatIndex = static_cast<int32>(EDlgDialogueTextFormat::StartTextFormats);
 					   TextFormatIndex < TextFormatsNum; TextFormatIndex++)
 			{
 				const EDlgDialogueTextFormat CurrentTextFormat = static_cast<EDlgDialogueTextFormat>(TextFormatIndex);
-				ExportToFileFormat(CurrentTextFormat);
+				bAllExported &= ExportToFileFormat(CurrentTextFormat);
 			}
-			break;
+			return bAllExported;
 		}
 		default:
 			// It Should not have any extension
 			check(!bHasExtension);
-			break;
+			return false;
+	}
+}
+
+TUniquePtr<IDlgWriter> UDlgDialogue::CreateTextFormatWriter(EDlgDialogueTextFormat TextFormat)
+{
+	switch (TextFormat)
+	{
+		case EDlgDialogueTextFormat::JSON:
+			return MakeUnique<FDlgJsonWriter>();
+
+		case EDlgDialogueTextFormat::Binary:
+			return MakeUnique<FDlgBinaryWriter>();
+
+		case EDlgDialogueTextFormat::DialogueDEPRECATED:
+			return MakeUnique<FDlgConfigWriter>(TEXT("Dlg"));
+
+		default:
+			return nullptr;
 	}
 }
 
-FDlgParticipantData& UDlgDialogue::GetParticipantDataEntry(FName ParticipantName, FName FallbackParticipantName, bool bCheckNone, const FString& ContextMessage)
+TUniquePtr<IDlgParser> UDlgDialogue::CreateTextFormatParser(EDlgDialogueTextFormat TextFormat)
+{
+	switch (TextFormat)
+	{
+		case EDlgDialogueTextFormat::JSON:
+			return MakeUnique<FDlgJsonParser>();
+
+		case EDlgDialogueTextFormat::Binary:
+			return MakeUnique<FDlgBinaryParser>();
+
+		case EDlgDialogueTextFormat::DialogueDEPRECATED:
+			return MakeUnique<FDlgConfigParser>(TEXT("Dlg"));
+
+		default:
+			return nullptr;
+	}
+}
+
+FDlgParticipantData& UDlgDialogue::GetParticipantDataEntry(FName ParticipantName, FName FallbackParticipantName, bool bCheckNone, TFunctionRef<FString()> GetContextMessage)
 {
 	// Used to ignore some participants
 	static FDlgParticipantData BlackHoleParticipant;
@@ -623,10 +751,13 @@ FDlgParticipantData& UDlgDialogue::GetParticipantDataEntry(FName ParticipantName
 	// Parent/child is not valid, simply do nothing
 	if (bCheckNone && ValidParticipantName == NAME_None)
 	{
-		FDlgLogger::Get().Warningf(
-			TEXT("Ignoring ParticipantName = None, Context = `%s`. Either your node participant name is None or your participant name is None."),
-			*ContextMessage
-		);
+		FDlgLogger::Get().WarningLazy([&GetContextMessage]()
+		{
+			return FString::Printf(
+				TEXT("Ignoring ParticipantName = None, Context = `%s`. Either your node participant name is None or your participant name is None."),
+				*GetContextMessage()
+			);
+		});
 		return BlackHoleParticipant;
 	}
 
@@ -635,7 +766,11 @@ FDlgParticipantData& UDlgDialogue::GetParticipantDataEntry(FName ParticipantName
 
 void UDlgDialogue::AddConditionsDataFromNodeEdges(const UDlgNode* Node, int32 NodeIndex)
 {
-	const FString NodeContext = FString::Printf(TEXT("Node %s"), NodeIndex > INDEX_NONE ? *FString::FromInt(NodeIndex) : TEXT("Start") );
+	// Only formatted if there is something to warn about
+	auto GetNodeContext = [NodeIndex]()
+	{
+		return FString::Printf(TEXT("Node %s"), NodeIndex > INDEX_NONE ? *FString::FromInt(NodeIndex) : TEXT("Start"));
+	};
 	const FName FallbackParticipantName = Node->GetNodeParticipantName();
 
 	for (const FDlgEdge& Edge : Node->GetNodeChildren())
@@ -646,15 +781,17 @@ void UDlgDialogue::AddConditionsDataFromNodeEdges(const UDlgNode* Node, int32 No
 		{
 			if (Condition.IsParticipantInvolved())
 			{
-				const FString ContextMessage = FString::Printf(TEXT("Adding Edge primary condition data from %s to Node %d"), *NodeContext, TargetIndex);
-				GetParticipantDataEntry(Condition.ParticipantName, FallbackParticipantName, true, ContextMessage)
-					.AddConditionPrimaryData(Condition);
+				GetParticipantDataEntry(Condition.ParticipantName, FallbackParticipantName, true, [&GetNodeContext, TargetIndex]()
+				{
+					return FString::Printf(TEXT("Adding Edge primary condition data from %s to Node %d"), *GetNodeContext(), TargetIndex);
+				}).AddConditionPrimaryData(Condition);
 			}
 			if (Condition.IsSecondParticipantInvolved())
 			{
-				const FString ContextMessage = FString::Printf(TEXT("Adding Edge secondary condition data from %s to Node %d"), *NodeContext, TargetIndex);
-				GetParticipantDataEntry(Condition.OtherParticipantName, FallbackParticipantName, true, ContextMessage)
-					.AddConditionSecondaryData(Condition);
+				GetParticipantDataEntry(Condition.OtherParticipantName, FallbackParticipantName, true, [&GetNodeContext, TargetIndex]()
+				{
+					return FString::Printf(TEXT("Adding Edge secondary condition data from %s to Node %d"), *GetNodeContext(), TargetIndex);
+				}).AddConditionSecondaryData(Condition);
 			}
 		}
 	}
@@ -680,7 +817,7 @@ void UDlgDialogue::RebuildAndUpdateNode(UDlgNode* Node, const UDlgSystemSettings
 
 void UDlgDialogue::UpdateAndRefreshData(bool bUpdateTextsNamespacesAndKeys)
 {
-	FDlgLogger::Get().Infof(TEXT("Refreshing data for Dialogue = `%s`"), *GetPathName());
+	FDlgLogger::Get().InfoLazy([this]() { return FString::Printf(TEXT("Refreshing data for Dialogue = `%s`"), *GetPathName()); });
 
 	const UDlgSystemSettings* Settings = GetDefault<UDlgSystemSettings>();
 	ParticipantsData.Empty();
@@ -697,7 +834,8 @@ void UDlgDialogue::UpdateAndRefreshData(bool bUpdateTextsNamespacesAndKeys)
 	const int32 NodesNum = Nodes.Num();
 	for (int32 NodeIndex = 0; NodeIndex < NodesNum; NodeIndex++)
 	{
-		const FString NodeContext = FString::Printf(TEXT("Node %d"), NodeIndex);
+		// Only formatted if there is something to warn about
+		auto GetNodeContext = [NodeIndex]() { return FString::Printf(TEXT("Node %d"), NodeIndex); };
 		UDlgNode* Node = Nodes[NodeIndex];
 		const FName NodeParticipantName = Node->GetNodeParticipantName();
 
@@ -723,15 +861,17 @@ void UDlgDialogue::UpdateAndRefreshData(bool bUpdateTextsNamespacesAndKeys)
 		{
 			if (Condition.IsParticipantInvolved())
 			{
-				const FString ContextMessage = FString::Printf(TEXT("Adding primary condition data for %s"), *NodeContext);
-				GetParticipantDataEntry(Condition.ParticipantName, NodeParticipantName, true, ContextMessage)
-					.AddConditionPrimaryData(Condition);
+				GetParticipantDataEntry(Condition.ParticipantName, NodeParticipantName, true, [&GetNodeContext]()
+				{
+					return FString::Printf(TEXT("Adding primary condition data for %s"), *GetNodeContext());
+				}).AddConditionPrimaryData(Condition);
 			}
 			if (Condition.IsSecondParticipantInvolved())
 			{
-				const FString ContextMessage = FString::Printf(TEXT("Adding secondary condition data for %s"), *NodeContext);
-				GetParticipantDataEntry(Condition.OtherParticipantName, NodeParticipantName, true, ContextMessage)
-					.AddConditionSecondaryData(Condition);
+				GetParticipantDataEntry(Condition.OtherParticipantName, NodeParticipantName, true, [&GetNodeContext]()
+				{
+					return FString::Printf(TEXT("Adding secondary condition data for %s"), *GetNodeContext());
+				}).AddConditionSecondaryData(Condition);
 			}
 		}
 
@@ -753,26 +893,29 @@ void UDlgDialogue::UpdateAndRefreshData(bool bUpdateTextsNamespacesAndKeys)
 			// Text arguments are rebuild from the Node
 			for (const FDlgTextArgument& TextArgument : Edge.GetTextArguments())
 			{
-				const FString ContextMessage = FString::Printf(TEXT("Adding Edge text arguments data from %s, to Node %d"), *NodeContext, TargetIndex);
-				GetParticipantDataEntry(TextArgument.ParticipantName, NodeParticipantName, true, ContextMessage)
-					.AddTextArgumentData(TextArgument);
+				GetParticipantDataEntry(TextArgument.ParticipantName, NodeParticipantName, true, [&GetNodeContext, TargetIndex]()
+				{
+					return FString::Printf(TEXT("Adding Edge text arguments data from %s, to Node %d"), *GetNodeContext(), TargetIndex);
+				}).AddTextArgumentData(TextArgument);
 			}
 		}
 
 		// Events
 		for (const FDlgEvent& Event : Node->GetNodeEnterEvents())
 		{
-			const FString ContextMessage = FString::Printf(TEXT("Adding events data for %s"), *NodeContext);
-			GetParticipantDataEntry(Event.ParticipantName, NodeParticipantName, true, ContextMessage)
-				.AddEventData(Event);
+			GetParticipantDataEntry(Event.ParticipantName, NodeParticipantName, true, [&GetNodeContext]()
+			{
+				return FString::Printf(TEXT("Adding events data for %s"), *GetNodeContext());
+			}).AddEventData(Event);
 		}
 
 		// Text arguments
 		for (const FDlgTextArgument& TextArgument : Node->GetTextArguments())
 		{
-			const FString ContextMessage = FString::Printf(TEXT("Adding text arguments data for %s"), *NodeContext);
-			GetParticipantDataEntry(TextArgument.ParticipantName, NodeParticipantName, true, ContextMessage)
-				.AddTextArgumentData(TextArgument);
+			GetParticipantDataEntry(TextArgument.ParticipantName, NodeParticipantName, true, [&GetNodeContext]()
+			{
+				return FString::Printf(TEXT("Adding text arguments data for %s"), *GetNodeContext());
+			}).AddTextArgumentData(TextArgument);
 		}
 	}
 
@@ -13,10 +13,15 @@
 #if NY_ENGINE_VERSION >= 500
 #include "UObject/ObjectSaveContext.h"
 #endif
+#if NY_ENGINE_VERSION >= 504
+#include "UObject/AssetRegistryTagsContext.h"
+#endif
 
 #include "DlgDialogue.generated.h"
 
 class UDlgNode;
+class IDlgParser;
+class IDlgWriter;
 
 // Custom serialization version for changes made in Dev-Dialogues stream
 struct DLGSYSTEM_API FDlgDialogueObjectVersion
@@ -154,6 +159,16 @@ public:
 	 */
 	void PostEditChangeChainProperty(struct FPropertyChangedChainEvent& PropertyChangedEvent) override;
 
+	/**
+	 * Gathers a list of asset registry searchable tags. Adds the search data of this Dialogue as a hidden tag
+	 * so that the editor can search the Dialogue without loading it, see GetSearchDataTagName.
+	 */
+#if NY_ENGINE_VERSION >= 504
+	void GetAssetRegistryTags(FAssetRegistryTagsContext Context) const override;
+#else
+	void GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const override;
+#endif
+
 	/**
 	 * Callback used to allow object register its direct object references that are not already covered by
 	 * the token stream.
@@ -190,6 +205,17 @@ public:
 	static FName GetMemberNameParticipantsData() { return GET_MEMBER_NAME_CHECKED(UDlgDialogue, ParticipantsData); }
 	static FName GetMemberNameNodes() { return GET_MEMBER_NAME_CHECKED(UDlgDialogue, Nodes); }
 
+	// Name of the hidden asset registry tag with the search data of the Dialogue. Used by the DlgSystemEditor module.
+	static FName GetSearchDataTagName()
+	{
+		static const FName TagName(TEXT("DlgSearchData"));
+		return TagName;
+	}
+
+	// The search data tag is built once and reused until this is called, the search data of the Dialogue changed.
+	// Called by Modify, PostEditChangeProperty and the DlgSystemEditor module when a graph node or a node changes.
+	void InvalidateSearchDataTagValue() { CachedSearchDataTagValue.Reset(); }
+
 	// Create the basic dialogue graph.
 	void CreateGraph();
 
@@ -647,8 +673,8 @@ public:
 	// Check if a text file in the same folder with the same name (Name) exists and loads the data from that file.
 	void ImportFromFile();
 
-	// Method to handle when this asset is going to be saved. Compiles the dialogue and saves to the text file.
-	void OnPreAssetSaved();
+	// Method to handle when this asset is going to be saved. Compiles the dialogue and, if bExportToFile, saves to the text file.
+	void OnPreAssetSaved(bool bExportToFile = true);
 
 	// Useful for initially reloading the data from the text file so that the dialogue is always in sync.
 	void InitialSyncWithTextFile()
@@ -665,6 +691,33 @@ public:
 	// Exports this dialogue data into it's corresponding ".dlg" text file with the same name as this (Name).
 	void ExportToFile() const;
 
+	/**
+	 * Same as ExportToFile but skips the serialization and the file write if nothing exportable changed since the last export.
+	 * Compares the hash of the exported data (see FDlgHashWriter), it is computed without building the text.
+	 * @return True if the file was written
+	 */
+	bool ExportToFileIfChanged();
+
+	// Hash of the data that ExportToFileFormat would write for TextFormat, includes the text format and the file path
+	uint64 ComputeTextFileContentHash(EDlgDialogueTextFormat TextFormat) const;
+
+	// Call only after the text file was written successfully, ContentHash is the ComputeTextFileContentHash of the written data.
+	// Used by every export (ExportToFileIfChanged, the batch exports) so that the next ExportToFileIfChanged knows what is in the file.
+	void UpdateTextFileContentHash(uint64 ContentHash);
+
+	// Replaces the data of this dialogue with the data read by the Parser, initialized with the TextFileName.
+	void ImportFromParser(IDlgParser& Parser, const FString& TextFileName);
+
+	// The writer/parser of the TextFormat, nullptr for the formats without a file (None, All)
+	static TUniquePtr<IDlgWriter> CreateTextFormatWriter(EDlgDialogueTextFormat TextFormat);
+	static TUniquePtr<IDlgParser> CreateTextFormatParser(EDlgDialogueTextFormat TextFormat);
+
+	// Enables/disables the export to the text file when this dialogue is saved.
+	// Used by the batch saves that export the text files of all the saved dialogues at once, see FDlgEditorUtilities::SaveDialogues.
+	void EnableExportToFileOnSave() { bExportToFileOnSave = true; }
+	void DisableExportToFileOnSave() { bExportToFileOnSave = false; }
+	bool IsExportToFileOnSaveEnabled() const { return bExportToFileOnSave; }
+
 	// Updates the data of some nodes
 	// Fills the DlgData with the updated data
 	// NOTE: this can do a dialogue data -> graph node data update
@@ -704,17 +757,24 @@ private:
 	void AddConditionsDataFromNodeEdges(const UDlgNode* Node, int32 NodeIndex);
 
 	// Gets the map entry - creates it first if it is not yet there
-	FDlgParticipantData& GetParticipantDataEntry(FName ParticipantName, FName FallbackParticipantName, bool bCheckNone, const FString& ContextMessage);
+	// GetContextMessage is only called if a warning is logged
+	FDlgParticipantData& GetParticipantDataEntry(FName ParticipantName, FName FallbackParticipantName, bool bCheckNone, TFunctionRef<FString()> GetContextMessage);
 
 	// Rebuild & Update and node and its edges
 	void RebuildAndUpdateNode(UDlgNode* Node, const UDlgSystemSettings& Settings, bool bUpdateTextsNamespacesAndKeys);
 
 	void ImportFromFileFormat(EDlgDialogueTextFormat TextFormat);
-	void ExportToFileFormat(EDlgDialogueTextFormat TextFormat) const;
+	// Returns true if the file(s) were written
+	bool ExportToFileFormat(EDlgDialogueTextFormat TextFormat) const;
 
 	// Updates NodesGUIDToIndexMap with Node
 	void UpdateGUIDToIndexMap(const UDlgNode* Node, int32 NodeIndex);
 
+#if WITH_EDITOR
+	// Value of the GetSearchDataTagName tag, built only if the cached one is invalid
+	const FString& GetCachedSearchDataTagValue() const;
+#endif
+
 protected:
 	// Used to keep track of the version in text  file too, besides being written in the .uasset file.
 	UPROPERTY()
@@ -768,6 +828,15 @@ protected:
 	UPROPERTY(Meta = (DlgNoExport))
 	TObjectPtr<UEdGraph> DlgGraph;
 
+	// Hash of the data last exported into the text file, see ExportToFileIfChanged
+	UPROPERTY(Meta = (DlgNoExport))
+	uint64 TextFileContentHash = 0;
+
+	// Value of the GetSearchDataTagName tag, extracting, compressing and encoding it on every GetAssetRegistryTags is too slow
+	// (every FAssetData of the Dialogue asks for it). See InvalidateSearchDataTagValue.
+	mutable TOptional<FString> CachedSearchDataTagValue;
+	mutable FGuid CachedSearchDataTagGUID;
+
 	// Ptr to interface to dialogue editor operations. See function SetDialogueEditorAccess for more details.
 	static TSharedPtr<IDlgEditorAccess> DialogueEditorAccess;
 
@@ -784,6 +853,9 @@ protected:
 	// Flag that indicates that This Was Loaded was called
 	bool bWasLoaded = false;
 
+	// See DisableExportToFileOnSave
+	bool bExportToFileOnSave = true;
+
 public:
 	/** Array of user data stored with the asset (for IInterface_AssetUserData implementation) */
 	UPROPERTY(EditAnywhere, AdvancedDisplay, Instanced, Category = "Asset User Data")
@@ -21,10 +21,13 @@ void FDlgEvent::Call(UDlgContext& Context, const FString& ContextString, UObject
 	{
 		if (CustomEvent == nullptr)
 		{
-			FDlgLogger::Get().Warningf(
-				TEXT("Custom Event is empty (not valid). Ignoring. Context:\n\t%s, Participant = %s"),
-				*Context.GetContextString(), Participant ? *Participant->GetPathName() : TEXT("INVALID")
-			);
+			FDlgLogger::Get().WarningLazy([&]()
+			{
+				return FString::Printf(
+					TEXT("Custom Event is empty (not valid). Ignoring. Context:\n\t%s, Participant = %s"),
+					*Context.GetContextString(), Participant ? *Participant->GetPathName() : TEXT("INVALID")
+				);
+			});
 			return;
 		}
 
@@ -151,17 +154,23 @@ bool FDlgEvent::ValidateIsParticipantValid(const UDlgContext& Context, const FSt
 
 	if (MustHaveParticipant())
 	{
-		FDlgLogger::Get().Errorf(
-			TEXT("%s - Event FAILED because the PARTICIPANT is INVALID. \nContext:\n\t%s, \n\tParticipantName = %s, EventType = %s, EventName = %s, CustomEvent = %s"),
-			*ContextString, *Context.GetContextString(), *ParticipantName.ToString(), *EventTypeToString(EventType), *EventName.ToString(), *GetCustomEventName()
-		);
+		FDlgLogger::Get().ErrorLazy([&]()
+		{
+			return FString::Printf(
+				TEXT("%s - Event FAILED because the PARTICIPANT is INVALID. \nContext:\n\t%s, \n\tParticipantName = %s, EventType = %s, EventName = %s, CustomEvent = %s"),
+				*ContextString, *Context.GetContextString(), *ParticipantName.ToString(), *EventTypeToString(EventType), *EventName.ToString(), *GetCustomEventName()
+			);
+		});
 	}
 	else
 	{
-		FDlgLogger::Get().Warningf(
-			TEXT("%s - Event WARNING because the PARTICIPANT is INVALID. The call will NOT FAIL, but the participant is not present. \nContext:\n\t%s, \n\tParticipantName = %s, EventType = %s, EventName = %s, CustomEvent = %s"),
-			*ContextString, *Context.GetContextString(), *ParticipantName.ToString(), *EventTypeToString(EventType), *EventName.ToString(), *GetCustomEventName()
-		);
+		FDlgLogger::Get().WarningLazy([&]()
+		{
+			return FString::Printf(
+				TEXT("%s - Event WARNING because the PARTICIPANT is INVALID. The call will NOT FAIL, but the participant is not present. \nContext:\n\t%s, \n\tParticipantName = %s, EventType = %s, EventName = %s, CustomEvent = %s"),
+				*ContextString, *Context.GetContextString(), *ParticipantName.ToString(), *EventTypeToString(EventType), *EventName.ToString(), *GetCustomEventName()
+			);
+		});
 	}
 
 	return false;
@@ -187,9 +196,12 @@ void FDlgEvent::CallUnrealFunction(UDlgContext& Context, const FString& ContextS
 	}
 	else
 	{
-		FDlgLogger::Get().Warningf(
-			TEXT("Unreal Function %s Not Found. Ignoring. Context:\n\t%s, Participant = %s"),
-			*EventName.ToString(), *Context.GetContextString(), Participant ? *Participant->GetPathName() : TEXT("INVALID")
-		);
+		FDlgLogger::Get().WarningLazy([&]()
+		{
+			return FString::Printf(
+				TEXT("Unreal Function %s Not Found. Ignoring. Context:\n\t%s, Participant = %s"),
+				*EventName.ToString(), *Context.GetContextString(), Participant ? *Participant->GetPathName() : TEXT("INVALID")
+			);
+		});
 	}
 }
@@ -27,6 +27,8 @@
 #include "GameplayDebugger/SDlgDataDisplay.h"
 #include "Logging/DlgLogger.h"
 #include "DlgHelper.h"
+#include "IO/DlgClassNameIndex.h"
+#include "IO/DlgSerializationPlan.h"
 
 #define LOCTEXT_NAMESPACE "FDlgSystemModule"
 
@@ -53,6 +55,15 @@ void FDlgSystemModule::StartupModule()
 	OnAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &Self::HandleOnAssetRemoved);
 	OnAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &Self::HandleOnAssetRenamed);
 
+	// Listen for new or reloaded classes, the class name lookups and serialization plans of the IO have to be rebuilt
+	OnModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &Self::HandleOnModulesChanged);
+#if NY_ENGINE_VERSION >= 500
+	OnReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &Self::HandleOnReloadComplete);
+#endif
+#if WITH_EDITOR
+	OnObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddRaw(this, &Self::HandleOnObjectsReplaced);
+#endif
+
 #if WITH_GAMEPLAY_DEBUGGER
 	// If the gameplay debugger is available, register the category and notify the editor about the changes
 	IGameplayDebugger& GameplayDebuggerModule = IGameplayDebugger::Get();
@@ -130,6 +141,23 @@ void FDlgSystemModule::ShutdownModule()
 		}
 	}
 
+	if (OnModulesChangedHandle.IsValid())
+	{
+		FModuleManager::Get().OnModulesChanged().Remove(OnModulesChangedHandle);
+	}
+#if NY_ENGINE_VERSION >= 500
+	if (OnReloadCompleteHandle.IsValid())
+	{
+		FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(OnReloadCompleteHandle);
+	}
+#endif
+#if WITH_EDITOR
+	if (OnObjectsReplacedHandle.IsValid())
+	{
+		FCoreUObjectDelegates::OnObjectsReplaced.Remove(OnObjectsReplacedHandle);
+	}
+#endif
+
 	if (OnPreLoadMapHandle.IsValid())
 	{
 		FCoreUObjectDelegates::PreLoadMap.Remove(OnPreLoadMapHandle);
@@ -319,6 +347,31 @@ void FDlgSystemModule::HandleDialogueRenamed(UDlgDialogue* RenamedDialogue, cons
 	}
 }
 
+void FDlgSystemModule::HandleOnModulesChanged(FName ModuleName, EModuleChangeReason ChangeReason)
+{
+	if (ChangeReason == EModuleChangeReason::ModuleLoaded || ChangeReason == EModuleChangeReason::ModuleUnloaded)
+	{
+		FDlgClassNameIndex::Get().Invalidate();
+		FDlgSerializationPlanCache::Get().Invalidate();
+	}
+}
+
+#if NY_ENGINE_VERSION >= 500
+void FDlgSystemModule::HandleOnReloadComplete(EReloadCompleteReason Reason)
+{
+	FDlgClassNameIndex::Get().Invalidate();
+	FDlgSerializationPlanCache::Get().Invalidate();
+}
+#endif
+
+#if WITH_EDITOR
+void FDlgSystemModule::HandleOnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+	// Blueprint classes and user defined structs are recompiled in place, their properties are new
+	FDlgSerializationPlanCache::Get().Invalidate();
+}
+#endif
+
 void FDlgSystemModule::HandleOnPreLoadMap(const FString& MapName)
 {
 	// NOTE: only in NON editor game
@@ -5,6 +5,8 @@
 #include "UObject/WeakObjectPtr.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 
+#include "NYEngineVersionHelpers.h"
+
 class UDlgDialogue;
 class SWidget;
 struct FAssetData;
@@ -51,6 +53,19 @@ private:
 	// Handle the event after the Dialogue was renamed. Rename the text file(s).
 	void HandleDialogueRenamed(UDlgDialogue* RenamedDialogue, const FString& OldObjectPath);
 
+	// Handle the event for when a module is loaded or unloaded, the classes could have changed
+	void HandleOnModulesChanged(FName ModuleName, EModuleChangeReason ChangeReason);
+
+#if NY_ENGINE_VERSION >= 500
+	// Handle the event after a hot reload or live coding patch, the classes could have been reinstanced
+	void HandleOnReloadComplete(EReloadCompleteReason Reason);
+#endif
+
+#if WITH_EDITOR
+	// Handle the event after objects were reinstanced (e.g. Blueprint compile), the serialization plans have to be rebuilt
+	void HandleOnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+#endif
+
 	// Handle event when a new map is loaded.
 	void HandleOnPreLoadMap(const FString& MapName);
 
@@ -80,4 +95,7 @@ private:
 	FDelegateHandle OnInMemoryAssetDeletedHandle;
 	FDelegateHandle OnAssetRemovedHandle;
 	FDelegateHandle OnAssetRenamedHandle;
+	FDelegateHandle OnModulesChangedHandle;
+	FDelegateHandle OnReloadCompleteHandle;
+	FDelegateHandle OnObjectsReplacedHandle;
 };
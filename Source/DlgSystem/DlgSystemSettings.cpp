@@ -141,6 +141,9 @@ FString UDlgSystemSettings::GetTextFileExtension(EDlgDialogueTextFormat TextForm
 		case EDlgDialogueTextFormat::JSON:
 			return TEXT(".dlg.json");
 
+		case EDlgDialogueTextFormat::Binary:
+			return TEXT(".dlg.bin");
+
 		case EDlgDialogueTextFormat::DialogueDEPRECATED:
 			return TEXT(".dlg");
 
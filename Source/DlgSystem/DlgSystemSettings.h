@@ -40,6 +40,9 @@ enum class EDlgDialogueTextFormat : uint8
 	// The JSON format.
 	JSON				UMETA(DisplayName = "JSON"),
 
+	// Compact binary format, faster to read and write but not human readable.
+	Binary				UMETA(DisplayName = "Binary"),
+
 	// Hidden, represents the number of text formats */
 	NumTextFormats 		UMETA(Hidden),
 };
@@ -398,6 +401,24 @@ public:
 	UPROPERTY(Category = "Logger", Config, EditAnywhere, AdvancedDisplay)
 	ENYLoggerLogLevel OpenMessageLogLevelsHigherThan = ENYLoggerLogLevel::NoLogging;
 
+	// Messages with a log level higher than this are ignored without being formatted.
+	// NOTE: the levels compiled out by NY_LOGGER_COMPILED_LOG_LEVEL (by default everything above Warning in shipping) are ignored regardless of this
+	UPROPERTY(Category = "Logger", Config, EditAnywhere, AdvancedDisplay)
+	ENYLoggerLogLevel MaxLogLevel = ENYLoggerLogLevel::Trace;
+
+	// Queue the log messages and write them once per frame instead of on the calling thread.
+	// Identical messages logged in the same frame are merged and each message is rate limited, useful if a broken dialogue spams errors every frame.
+	UPROPERTY(Category = "Logger", Config, EditAnywhere, AdvancedDisplay)
+	bool bAsyncLogging = false;
+
+	// Messages logged after this many in the same frame are dropped
+	UPROPERTY(Category = "Logger", Config, EditAnywhere, AdvancedDisplay, meta = (EditCondition = "bAsyncLogging", ClampMin = "1"))
+	int32 AsyncLoggingMaxQueuedMessages = 4096;
+
+	// How many times the same message can be written per second, the rest are counted and reported with the next message. A value <= 0 means no limit
+	UPROPERTY(Category = "Logger", Config, EditAnywhere, AdvancedDisplay, meta = (EditCondition = "bAsyncLogging"))
+	int32 AsyncLoggingMaxMessagesPerSecond = 10;
+
 
 	// Should we hide the categories in the Dialogue browser that do not have any children?
 	UPROPERTY(Category = "Browser", Config, EditAnywhere)
@@ -17,10 +17,13 @@ FFormatArgumentValue FDlgTextArgument::ConstructFormatArgumentValue(const UDlgCo
 	const UObject* Participant = Context.GetParticipant(ValidParticipantName);
 	if (Participant == nullptr)
 	{
-		FDlgLogger::Get().Errorf(
-			TEXT("FAILED to construct text argument because the PARTICIPANT is INVALID (Supplied Participant = %s). \nContext:\n\t%s, DisplayString = %s, ParticipantName = %s, ArgumentType = %s"),
-			*ValidParticipantName.ToString(), *Context.GetContextString(), *DisplayString, *ParticipantName.ToString(), *ArgumentTypeToString(Type)
-		);
+		FDlgLogger::Get().ErrorLazy([&]()
+		{
+			return FString::Printf(
+				TEXT("FAILED to construct text argument because the PARTICIPANT is INVALID (Supplied Participant = %s). \nContext:\n\t%s, DisplayString = %s, ParticipantName = %s, ArgumentType = %s"),
+				*ValidParticipantName.ToString(), *Context.GetContextString(), *DisplayString, *ParticipantName.ToString(), *ArgumentTypeToString(Type)
+			);
+		});
 		return FFormatArgumentValue(FText::FromString(TEXT("[CustomTextArgument is INVALID. Missing Participant. Check log]")));
 	}
 
@@ -50,10 +53,13 @@ FFormatArgumentValue FDlgTextArgument::ConstructFormatArgumentValue(const UDlgCo
 		case EDlgTextArgumentType::Custom:
 			if (CustomTextArgument == nullptr)
 			{
-				FDlgLogger::Get().Errorf(
-					TEXT("Custom Text Argument is INVALID. Returning Error Text. Context:\n\t%s, Participant = %s"),
-					*Context.GetContextString(), Participant ? *Participant->GetPathName() : TEXT("INVALID")
-				);
+				FDlgLogger::Get().ErrorLazy([&]()
+				{
+					return FString::Printf(
+						TEXT("Custom Text Argument is INVALID. Returning Error Text. Context:\n\t%s, Participant = %s"),
+						*Context.GetContextString(), Participant ? *Participant->GetPathName() : TEXT("INVALID")
+					);
+				});
 				return FFormatArgumentValue(FText::FromString(TEXT("[CustomTextArgument is INVALID. Missing Custom Text Argument. Check log]")));
 			}
 
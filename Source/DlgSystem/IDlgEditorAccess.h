@@ -39,5 +39,8 @@ public:
 
 	// Tries to set the new outer for Object to the closes UDlgNode from UEdGraphNode
 	virtual void SetNewOuterForObjectFromGraphNode(UObject* Object, UEdGraphNode* GraphNode) const = 0;
+
+	// Extracts the searchable data of the Dialogue into an asset registry tag value, see UDlgDialogue::GetSearchDataTagName
+	virtual FString GetSearchDataTagValue(const UDlgDialogue* Dialogue) const = 0;
 };
 #endif // WITH_EDITOR
@@ -0,0 +1,575 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgBinaryParser.h"
+
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+
+#include "DlgSystem/NYEngineVersionHelpers.h"
+#include "DlgSystem/NYReflectionHelper.h"
+
+DEFINE_LOG_CATEGORY(LogDlgBinaryParser);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgBinaryParser::InitializeParser(const FString& FilePath)
+{
+	TArray<uint8> FileBytes;
+	if (!FFileHelper::LoadFileToArray(FileBytes, *FilePath))
+	{
+		UE_LOG(LogDlgBinaryParser, Error, TEXT("Failed to load the file = `%s`"), *FilePath);
+		FileBytes.Empty();
+	}
+
+	InitializeParserFromBytes(MoveTemp(FileBytes));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgBinaryParser::InitializeParserFromString(const FString& Text)
+{
+	TArray<uint8> DecodedBytes;
+	if (!FBase64::Decode(Text, DecodedBytes))
+	{
+		UE_LOG(LogDlgBinaryParser, Error, TEXT("InitializeParserFromString - The text is not valid Base64"));
+		DecodedBytes.Empty();
+	}
+
+	InitializeParserFromBytes(MoveTemp(DecodedBytes));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgBinaryParser::InitializeParserFromBytes(TArray<uint8>&& InBytes)
+{
+	Bytes = MoveTemp(InBytes);
+	ReadHeader();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgBinaryParser::ReadHeader()
+{
+	bIsValidFile = false;
+	BodyOffset = 0;
+	FileVersion = 0;
+	Strings.Reset();
+	Names.Reset();
+
+	// No string can be bigger than the whole file
+	FMemoryReader Reader(Bytes, true);
+	Reader.ArMaxSerializeSize = Bytes.Num();
+	uint32 Magic = 0;
+	Reader << Magic;
+	Reader << FileVersion;
+	if (Reader.IsError() || Magic != DLG_BINARY_FORMAT_MAGIC)
+	{
+		UE_LOG(LogDlgBinaryParser, Error, TEXT("ReadHeader - The data is not in the Dialogue binary format"));
+		return;
+	}
+	if (FileVersion < FDlgBinaryFormatVersion::Initial || FileVersion > FDlgBinaryFormatVersion::LatestVersion)
+	{
+		UE_LOG(
+			LogDlgBinaryParser,
+			Error,
+			TEXT("ReadHeader - Unsupported version = %d, the latest known version is %d"),
+			FileVersion, static_cast<int32>(FDlgBinaryFormatVersion::LatestVersion)
+		);
+		return;
+	}
+
+	// Each string has at least its length
+	int32 NumStrings = 0;
+	if (!ReadNum(Reader, NumStrings, sizeof(int32)))
+	{
+		return;
+	}
+	Strings.Reserve(NumStrings);
+	for (int32 Index = 0; Index < NumStrings && !Reader.IsError(); Index++)
+	{
+		Reader << Strings.AddDefaulted_GetRef();
+	}
+	if (Reader.IsError())
+	{
+		UE_LOG(LogDlgBinaryParser, Error, TEXT("ReadHeader - The string table is corrupted"));
+		Strings.Reset();
+		return;
+	}
+
+	Names.SetNum(NumStrings);
+	BodyOffset = Reader.Tell();
+	bIsValidFile = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgBinaryParser::ReadAllProperty(const UStruct* ReferenceClass, void* TargetObject, UObject* InDefaultObjectOuter)
+{
+	if (!bIsValidFile)
+	{
+		UE_LOG(LogDlgBinaryParser, Error, TEXT("ReadAllProperty - The parser is not initialized with a valid file"));
+		return;
+	}
+
+	DefaultObjectOuter = InDefaultObjectOuter;
+	FMemoryReader Reader(Bytes, true);
+	Reader.ArMaxSerializeSize = Bytes.Num();
+	Reader.Seek(BodyOffset);
+	if (!ReadStructBlock(Reader, ReferenceClass, TargetObject))
+	{
+		UE_LOG(LogDlgBinaryParser, Error, TEXT("ReadAllProperty - Could not read everything, the data is corrupted"));
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgBinaryParser::ReadStructBlock(FArchive& Ar, const UStruct* StructDefinition, void* ContainerPtr)
+{
+	check(StructDefinition);
+	check(ContainerPtr);
+
+	// Handle UObject inheritance (children of class)
+	if (StructDefinition->IsA<UClass>())
+	{
+		StructDefinition = static_cast<UObject*>(ContainerPtr)->GetClass();
+	}
+
+	// Each field has at least the name index and the size
+	int32 NumFields = 0;
+	if (!ReadNum(Ar, NumFields, 2 * sizeof(int32)))
+	{
+		return false;
+	}
+
+	const FDlgSerializationPlanRef Plan = FDlgSerializationPlanCache::Get().FindOrBuild(StructDefinition);
+
+	for (int32 FieldIndex = 0; FieldIndex < NumFields; FieldIndex++)
+	{
+		int32 NameIndex = INDEX_NONE;
+		int32 Size = 0;
+		if (!ReadStringIndex(Ar, NameIndex) || !ReadNum(Ar, Size))
+		{
+			return false;
+		}
+		const int64 ValueEndPosition = Ar.Tell() + Size;
+
+		// Removed or renamed property
+		const FDlgSerializationPlanProperty* Entry = Plan->FindProperty(GetName(NameIndex));
+		if (Entry == nullptr)
+		{
+			if (bLogVerbose)
+			{
+				UE_LOG(
+					LogDlgBinaryParser,
+					Verbose,
+					TEXT("ReadStructBlock - Property = `%s` does not exist in Struct = `%s`. Skipped"),
+					*Strings[NameIndex], *StructDefinition->GetPathName()
+				);
+			}
+			Ar.Seek(ValueEndPosition);
+			continue;
+		}
+		FProperty* Property = Entry->Property;
+		if (bLogVerbose)
+		{
+			UE_LOG(LogDlgBinaryParser, Verbose, TEXT("ReadStructBlock, Property = `%s`"), *Property->GetPathName());
+		}
+
+		// Static arrays, the files before FDlgBinaryFormatVersion::StaticArrays only have the first element
+		bool bSuccess = true;
+		for (int32 ArrayIndex = 0; bSuccess && ArrayIndex < Entry->ArrayDim && Ar.Tell() < ValueEndPosition; ArrayIndex++)
+		{
+			bSuccess = ReadValue(Ar, Property, Entry->GetValuePtr(ContainerPtr, ArrayIndex));
+		}
+		if (Ar.IsError())
+		{
+			return false;
+		}
+
+		// Changed type or could not read it, the size tells us where the next one starts
+		if (!bSuccess || Ar.Tell() != ValueEndPosition)
+		{
+			UE_LOG(
+				LogDlgBinaryParser,
+				Warning,
+				TEXT("ReadStructBlock - Could not read Property = `%s`, it might have changed its type. Skipped"),
+				*Property->GetPathName()
+			);
+			Ar.Seek(ValueEndPosition);
+		}
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgBinaryParser::ReadValue(FArchive& Ar, FProperty* Property, void* ValuePtr)
+{
+	check(Property);
+
+	// Enum
+	if (auto* EnumProperty = FNYReflectionHelper::CastProperty<FEnumProperty>(Property))
+	{
+		int64 Value = 0;
+		if (!ReadEnumValue(Ar, EnumProperty->GetEnum(), Property, Value))
+		{
+			return false;
+		}
+		EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(ValuePtr, Value);
+		return true;
+	}
+
+	// Numeric, int, float, possible enum
+	if (auto* NumericProperty = FNYReflectionHelper::CastProperty<FNumericProperty>(Property))
+	{
+		if (const UEnum* Enum = NumericProperty->GetIntPropertyEnum())
+		{
+			int64 Value = 0;
+			if (!ReadEnumValue(Ar, Enum, Property, Value))
+			{
+				return false;
+			}
+			NumericProperty->SetIntPropertyValue(ValuePtr, Value);
+		}
+		else if (NumericProperty->IsFloatingPoint())
+		{
+			double Value = 0.0;
+			Ar << Value;
+			NumericProperty->SetFloatingPointPropertyValue(ValuePtr, Value);
+		}
+		else
+		{
+			int64 Value = 0;
+			Ar << Value;
+			NumericProperty->SetIntPropertyValue(ValuePtr, Value);
+		}
+		return true;
+	}
+
+	// Bool
+	if (auto* BoolProperty = FNYReflectionHelper::CastProperty<FBoolProperty>(Property))
+	{
+		uint8 Value = 0;
+		Ar << Value;
+		BoolProperty->SetPropertyValue(ValuePtr, Value != 0);
+		return true;
+	}
+
+	// FString
+	if (FNYReflectionHelper::CastProperty<FStrProperty>(Property) != nullptr)
+	{
+		Ar << *static_cast<FString*>(ValuePtr);
+		return true;
+	}
+
+	// FName
+	if (auto* NameProperty = FNYReflectionHelper::CastProperty<FNameProperty>(Property))
+	{
+		int32 NameIndex = INDEX_NONE;
+		if (!ReadStringIndex(Ar, NameIndex))
+		{
+			return false;
+		}
+		NameProperty->SetPropertyValue(ValuePtr, GetName(NameIndex));
+		return true;
+	}
+
+	// FText
+	if (auto* TextProperty = FNYReflectionHelper::CastProperty<FTextProperty>(Property))
+	{
+		int32 StringIndex = INDEX_NONE;
+		if (!ReadStringIndex(Ar, StringIndex))
+		{
+			return false;
+		}
+		TextProperty->SetPropertyValue(ValuePtr, FText::FromString(Strings[StringIndex]));
+		return true;
+	}
+
+	// TArray
+	if (auto* ArrayProperty = FNYReflectionHelper::CastProperty<FArrayProperty>(Property))
+	{
+		int32 Num = 0;
+		if (!ReadNum(Ar, Num))
+		{
+			return false;
+		}
+
+		FScriptArrayHelper Helper(ArrayProperty, ValuePtr);
+		Helper.EmptyValues();
+		Helper.Resize(Num);
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			if (!ReadValue(Ar, ArrayProperty->Inner, Helper.GetRawPtr(Index)))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// TSet
+	if (auto* SetProperty = FNYReflectionHelper::CastProperty<FSetProperty>(Property))
+	{
+		int32 Num = 0;
+		if (!ReadNum(Ar, Num))
+		{
+			return false;
+		}
+
+		FScriptSetHelper Helper(SetProperty, ValuePtr);
+		Helper.EmptyElements(Num);
+		bool bSuccess = true;
+		for (int32 Index = 0; Index < Num && bSuccess; Index++)
+		{
+			const int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
+			bSuccess = ReadValue(Ar, SetProperty->ElementProp, Helper.GetElementPtr(NewIndex));
+		}
+
+		// Always rehash, the set must stay valid even if we stop in the middle
+		Helper.Rehash();
+		return bSuccess;
+	}
+
+	// TMap
+	if (auto* MapProperty = FNYReflectionHelper::CastProperty<FMapProperty>(Property))
+	{
+		int32 Num = 0;
+		if (!ReadNum(Ar, Num))
+		{
+			return false;
+		}
+
+		FScriptMapHelper Helper(MapProperty, ValuePtr);
+		Helper.EmptyValues(Num);
+		bool bSuccess = true;
+		for (int32 Index = 0; Index < Num && bSuccess; Index++)
+		{
+			const int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
+			bSuccess = ReadValue(Ar, MapProperty->KeyProp, Helper.GetKeyPtr(NewIndex))
+				&& ReadValue(Ar, MapProperty->ValueProp, Helper.GetValuePtr(NewIndex));
+		}
+
+		// Always rehash, the map must stay valid even if we stop in the middle
+		Helper.Rehash();
+		return bSuccess;
+	}
+
+	// UStruct
+	if (auto* StructProperty = FNYReflectionHelper::CastProperty<FStructProperty>(Property))
+	{
+		return ReadStruct(Ar, StructProperty, ValuePtr);
+	}
+
+	// UObject
+	if (auto* ObjectProperty = FNYReflectionHelper::CastProperty<FObjectProperty>(Property))
+	{
+		return ReadObject(Ar, ObjectProperty, ValuePtr);
+	}
+
+	return ReadExportedText(Ar, Property, ValuePtr);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgBinaryParser::ReadEnumValue(FArchive& Ar, const UEnum* Enum, const FProperty* Property, int64& OutValue)
+{
+	check(Enum);
+	int32 NameIndex = INDEX_NONE;
+	if (!ReadStringIndex(Ar, NameIndex))
+	{
+		return false;
+	}
+
+	OutValue = Enum->GetValueByName(GetName(NameIndex));
+	if (OutValue == INDEX_NONE)
+	{
+		UE_LOG(
+			LogDlgBinaryParser,
+			Error,
+			TEXT("ReadEnumValue - Unable import enum `%s` from value `%s` for property `%s`"),
+			*Enum->CppType, *Strings[NameIndex], *Property->GetNameCPP()
+		);
+		return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgBinaryParser::ReadStruct(FArchive& Ar, FStructProperty* StructProperty, void* ValuePtr)
+{
+	// Same decision as in FDlgBinaryWriter::WriteStruct
+	UScriptStruct::ICppStructOps* TheCppStructOps = StructProperty->Struct->GetCppStructOps();
+	if (!TheCppStructOps || !TheCppStructOps->HasExportTextItem())
+	{
+		return ReadStructBlock(Ar, StructProperty->Struct, ValuePtr);
+	}
+
+	FString ValueString;
+	Ar << ValueString;
+	const TCHAR* ImportTextPtr = *ValueString;
+	if (TheCppStructOps->HasImportTextItem()
+		&& TheCppStructOps->ImportTextItem(ImportTextPtr, ValuePtr, PPF_None, nullptr, static_cast<FOutputDevice*>(GWarn)))
+	{
+		return true;
+	}
+
+	// Fall back to trying the tagged property approach if custom ImportTextItem couldn't get it done
+	ImportTextPtr = *ValueString;
+#if NY_ENGINE_VERSION >= 501
+	return StructProperty->ImportText_Direct(ImportTextPtr, ValuePtr, nullptr, PPF_None) != nullptr;
+#else
+	return StructProperty->ImportText(ImportTextPtr, ValuePtr, PPF_None, nullptr) != nullptr;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgBinaryParser::ReadObject(FArchive& Ar, FObjectProperty* ObjectProperty, void* ValuePtr)
+{
+	uint8 Tag = 0;
+	Ar << Tag;
+	switch (static_cast<EDlgBinaryObjectTag>(Tag))
+	{
+		case EDlgBinaryObjectTag::Null:
+		{
+			ObjectProperty->SetObjectPropertyValue(ValuePtr, nullptr);
+			return true;
+		}
+
+		case EDlgBinaryObjectTag::Reference:
+		{
+			FString Path;
+			Ar << Path;
+
+			UObject* Object = nullptr;
+			if (!Path.IsEmpty())
+			{
+				Object = StaticLoadObject(UObject::StaticClass(), DefaultObjectOuter, *Path);
+			}
+			if (Object != nullptr && !Object->IsA(ObjectProperty->PropertyClass))
+			{
+				UE_LOG(
+					LogDlgBinaryParser,
+					Error,
+					TEXT("ReadObject - Object = `%s` is not a `%s` for FObjectProperty = `%s`. Ignored"),
+					*Path, *ObjectProperty->PropertyClass->GetName(), *ObjectProperty->GetNameCPP()
+				);
+				Object = nullptr;
+			}
+
+			ObjectProperty->SetObjectPropertyValue(ValuePtr, Object);
+			return true;
+		}
+
+		case EDlgBinaryObjectTag::Instanced:
+		{
+			int32 ClassNameIndex = INDEX_NONE;
+			if (!ReadStringIndex(Ar, ClassNameIndex))
+			{
+				return false;
+			}
+
+			const UClass* ChildClass = GetChildClassFromName(ObjectProperty->PropertyClass, Strings[ClassNameIndex]);
+			if (ChildClass == nullptr)
+			{
+				UE_LOG(
+					LogDlgBinaryParser,
+					Error,
+					TEXT("ReadObject - Could not find class `%s` for FObjectProperty = `%s`. Ignored"),
+					*Strings[ClassNameIndex], *ObjectProperty->GetNameCPP()
+				);
+				ObjectProperty->SetObjectPropertyValue(ValuePtr, nullptr);
+				return false;
+			}
+
+			UObject* Object = CreateNewUObject(ChildClass, DefaultObjectOuter);
+			if (Object == nullptr || !Object->IsValidLowLevelFast())
+			{
+				UE_LOG(
+					LogDlgBinaryParser,
+					Error,
+					TEXT("ReadObject - PropertyName = `%s` Is a FObjectProperty but could not build any valid UObject"),
+					*ObjectProperty->GetNameCPP()
+				);
+				ObjectProperty->SetObjectPropertyValue(ValuePtr, nullptr);
+				return false;
+			}
+
+			ObjectProperty->SetObjectPropertyValue(ValuePtr, Object);
+			return ReadStructBlock(Ar, ChildClass, Object);
+		}
+
+		default:
+			UE_LOG(LogDlgBinaryParser, Error, TEXT("ReadObject - Unknown object tag = %d"), Tag);
+			return false;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgBinaryParser::ReadExportedText(FArchive& Ar, FProperty* Property, void* ValuePtr)
+{
+	FString ValueString;
+	Ar << ValueString;
+
+#if NY_ENGINE_VERSION >= 501
+	if (Property->ImportText_Direct(*ValueString, ValuePtr, nullptr, PPF_None) == nullptr)
+#else
+	if (Property->ImportText(*ValueString, ValuePtr, PPF_None, nullptr) == nullptr)
+#endif
+	{
+		UE_LOG(
+			LogDlgBinaryParser,
+			Error,
+			TEXT("ReadExportedText - Unable import property type %s from string value for property %s"),
+			*Property->GetClass()->GetName(), *Property->GetNameCPP()
+		);
+		return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgBinaryParser::ReadStringIndex(FArchive& Ar, int32& OutIndex)
+{
+	Ar << OutIndex;
+	if (Ar.IsError() || !Strings.IsValidIndex(OutIndex))
+	{
+		UE_LOG(LogDlgBinaryParser, Error, TEXT("ReadStringIndex - Invalid string table index = %d"), OutIndex);
+		return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgBinaryParser::ReadNum(FArchive& Ar, int32& OutNum, int64 MinElementSize)
+{
+	check(MinElementSize > 0);
+	Ar << OutNum;
+
+	// This guards against allocating huge containers for corrupted data
+	if (Ar.IsError() || OutNum < 0 || OutNum > (Ar.TotalSize() - Ar.Tell()) / MinElementSize)
+	{
+		UE_LOG(LogDlgBinaryParser, Error, TEXT("ReadNum - Invalid number of elements = %d"), OutNum);
+		return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FName FDlgBinaryParser::GetName(int32 Index)
+{
+	FName& Name = Names[Index];
+	if (Name.IsNone())
+	{
+		// FName asserts on names that are too long, texts can be in the table too
+		const FString& String = Strings[Index];
+		if (String.Len() >= NAME_SIZE)
+		{
+			UE_LOG(LogDlgBinaryParser, Warning, TEXT("GetName - The string at index = %d is too long to be a name (%d characters)"), Index, String.Len());
+			return NAME_None;
+		}
+
+		Name = FName(*String);
+	}
+
+	return Name;
+}
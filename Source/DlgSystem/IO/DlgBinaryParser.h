@@ -0,0 +1,86 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+#include "UObject/UnrealType.h"
+
+#include "IDlgParser.h"
+#include "DlgBinaryTypes.h"
+#include "DlgSerializationPlan.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDlgBinaryParser, All, All);
+
+class FArchive;
+
+/**
+ * Reads the compact binary format written by FDlgBinaryWriter, see DlgBinaryTypes.h for the layout.
+ * Properties that do not exist anymore or that could not be read are skipped, the rest of the file is still read.
+ * See IDlgParser for properties and METADATA specifiers.
+ */
+class DLGSYSTEM_API FDlgBinaryParser : public IDlgParser
+{
+public:
+	FDlgBinaryParser() {};
+
+	// IDlgParser Interface
+	void InitializeParser(const FString& FilePath) override;
+
+	// Expects the Base64 string from FDlgBinaryWriter::GetAsString
+	void InitializeParserFromString(const FString& Text) override;
+
+	void InitializeParserFromBytes(TArray<uint8>&& InBytes);
+
+	bool IsValidFile() const override { return bIsValidFile; }
+
+	void ReadAllProperty(const UStruct* ReferenceClass, void* TargetObject, UObject* InDefaultObjectOuter = nullptr) override;
+
+	// Version of the read file
+	int32 GetFileVersion() const { return FileVersion; }
+
+private:
+	// Reads the header and the string table, sets bIsValidFile
+	void ReadHeader();
+
+	// Reads a struct block into the struct/object, returns false if the rest of the block can't be read
+	bool ReadStructBlock(FArchive& Ar, const UStruct* StructDefinition, void* ContainerPtr);
+
+	// Reads the value of a property, ValuePtr points directly to the value
+	bool ReadValue(FArchive& Ar, FProperty* Property, void* ValuePtr);
+
+	bool ReadEnumValue(FArchive& Ar, const UEnum* Enum, const FProperty* Property, int64& OutValue);
+	bool ReadStruct(FArchive& Ar, FStructProperty* StructProperty, void* ValuePtr);
+	bool ReadObject(FArchive& Ar, FObjectProperty* ObjectProperty, void* ValuePtr);
+
+	// Fallback for everything else
+	bool ReadExportedText(FArchive& Ar, FProperty* Property, void* ValuePtr);
+
+	// Reads an index into the string table
+	bool ReadStringIndex(FArchive& Ar, int32& OutIndex);
+
+	// Reads the number of elements of a container or struct block, each element takes at least MinElementSize bytes
+	// so there can't be more than the remaining bytes allow
+	bool ReadNum(FArchive& Ar, int32& OutNum, int64 MinElementSize = 1);
+
+	// The string at Index as FName, created on the first use. NAME_None if the string is too long to be a FName.
+	FName GetName(int32 Index);
+
+private:
+	// The whole file
+	TArray<uint8> Bytes;
+
+	// Position of the top level struct block in Bytes
+	int64 BodyOffset = 0;
+
+	int32 FileVersion = 0;
+	bool bIsValidFile = false;
+
+	// String table
+	TArray<FString> Strings;
+
+	// Same as Strings as FNames, NAME_None means not created yet
+	TArray<FName> Names;
+
+	// Used for UObject construction if necessary
+	UObject* DefaultObjectOuter = nullptr;
+};
@@ -0,0 +1,73 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * The compact binary variant of the text formats, see FDlgBinaryWriter and FDlgBinaryParser.
+ *
+ * Layout, all numbers are little endian:
+ *	- Header: Magic (uint32), Version (int32)
+ *	- String table: Num (int32), then Num FStrings. Property names, FNames, FTexts, enum names and class names
+ *	  are written once here and referenced everywhere else by their index.
+ *	- Body: the top level struct block
+ *
+ * Struct block: NumFields (int32), then each field is
+ *	- NameIndex (int32): index of the property name in the string table
+ *	- Size (int32): size of the value in bytes, unknown or changed properties are skipped with it
+ *	- Value, or ArrayDim values for static arrays (e.g. int32 Values[4])
+ *
+ * Values, depending on the property type:
+ *	- bool: uint8
+ *	- integer: int64, floating point: double
+ *	- enum, FName, FText: string index (int32)
+ *	- FString: FString
+ *	- TArray, TSet: Num (int32), then the elements
+ *	- TMap: Num (int32), then key and value for each pair
+ *	- UStruct: struct block, or the exported text (FString) if the struct has a native ExportTextItem
+ *	- UObject: EDlgBinaryObjectTag (uint8), then the path (FString) for references
+ *	  or the class name index (int32) and the struct block for the instanced objects
+ *	- Everything else: the exported text (FString)
+ */
+
+// "DLGB"
+static constexpr uint32 DLG_BINARY_FORMAT_MAGIC = 0x42474C44;
+
+// Version of the binary format, written in the header
+struct FDlgBinaryFormatVersion
+{
+	enum Type
+	{
+		Initial = 1,
+
+		// Static arrays write all their elements, before only the first one was written
+		StaticArrays,
+
+		// -----<new versions can be added above this line>-------------------------------------------------
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+
+private:
+	FDlgBinaryFormatVersion() {}
+};
+
+// How an UObject property value is written
+enum class EDlgBinaryObjectTag : uint8
+{
+	Null = 0,
+
+	// Path to the object, see IDlgWriter::CanSaveAsReference
+	Reference,
+
+	// Class name and the properties of the object
+	Instanced
+};
+
+// Key funcs for TMap<FString, int32> that compare the strings case sensitive, the default ones ignore the case
+struct FDlgBinaryStringKeyFuncs : BaseKeyFuncs<TPair<FString, int32>, FString, false>
+{
+	static const FString& GetSetKey(const TPair<FString, int32>& Element) { return Element.Key; }
+	static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+	static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+};
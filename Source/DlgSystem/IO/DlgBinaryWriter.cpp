@@ -0,0 +1,349 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgBinaryWriter.h"
+
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+
+#include "DlgSystem/DlgHelper.h"
+#include "DlgSystem/NYReflectionHelper.h"
+
+DEFINE_LOG_CATEGORY(LogDlgBinaryWriter);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgBinaryWriter::Write(const UStruct* StructDefinition, const void* Object)
+{
+	Bytes.Reset();
+	Strings.Reset();
+	StringToIndex.Reset();
+	bHasBase64String = false;
+
+	// The body goes first, the string table is only complete after it
+	TArray<uint8> Body;
+	FMemoryWriter BodyWriter(Body, true);
+	WriteStructBlock(BodyWriter, StructDefinition, Object);
+
+	FMemoryWriter Writer(Bytes, true);
+	uint32 Magic = DLG_BINARY_FORMAT_MAGIC;
+	int32 Version = FDlgBinaryFormatVersion::LatestVersion;
+	Writer << Magic;
+	Writer << Version;
+
+	int32 NumStrings = Strings.Num();
+	Writer << NumStrings;
+	for (FString& String : Strings)
+	{
+		Writer << String;
+	}
+
+	Writer.Serialize(Body.GetData(), Body.Num());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgBinaryWriter::ExportToFile(const FString& FileName)
+{
+	return FFileHelper::SaveArrayToFile(Bytes, *FileName);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+const FString& FDlgBinaryWriter::GetAsString() const
+{
+	if (!bHasBase64String)
+	{
+		Base64String = FBase64::Encode(Bytes);
+		bHasBase64String = true;
+	}
+
+	return Base64String;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgBinaryWriter::WriteStructBlock(FArchive& Ar, const UStruct* StructDefinition, const void* ContainerPtr)
+{
+	const int64 NumFieldsPosition = BeginSizePrefix(Ar);
+	if (StructDefinition == nullptr || ContainerPtr == nullptr)
+	{
+		return;
+	}
+
+	// Handle UObject inheritance (children of class)
+	if (StructDefinition->IsA<UClass>())
+	{
+		const UObject* UnrealObject = static_cast<const UObject*>(ContainerPtr);
+		if (!UnrealObject->IsValidLowLevelFast())
+		{
+			UE_LOG(
+				LogDlgBinaryWriter,
+				Error,
+				TEXT("WriteStructBlock: StructDefinition = `%s` is a UClass and expected ContainerPtr to be an UObject. Memory corruption?"),
+				*StructDefinition->GetPathName()
+			);
+			return;
+		}
+
+		StructDefinition = UnrealObject->GetClass();
+	}
+
+	int32 NumFields = 0;
+	const FDlgSerializationPlanRef Plan = FDlgSerializationPlanCache::Get().FindOrBuild(StructDefinition);
+	for (const FDlgSerializationPlanProperty& Entry : Plan->GetProperties())
+	{
+		if (Entry.bSkipOnWrite)
+		{
+			continue;
+		}
+		if (bLogVerbose)
+		{
+			UE_LOG(LogDlgBinaryWriter, Verbose, TEXT("WriteStructBlock, Property = `%s`"), *Entry.Property->GetPathName());
+		}
+
+		int32 NameIndex = GetNameIndex(Entry.Name);
+		Ar << NameIndex;
+
+		const int64 SizePosition = BeginSizePrefix(Ar);
+		for (int32 ArrayIndex = 0; ArrayIndex < Entry.ArrayDim; ArrayIndex++)
+		{
+			WriteValue(Ar, Entry.Property, Entry.GetValuePtr(ContainerPtr, ArrayIndex));
+		}
+		EndSizePrefix(Ar, SizePosition);
+		NumFields++;
+	}
+
+	PatchInt32(Ar, NumFieldsPosition, NumFields);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgBinaryWriter::WriteValue(FArchive& Ar, const FProperty* Property, const void* ValuePtr)
+{
+	check(Property);
+
+	// Enum, written by name so that reordering the enum does not break the files
+	if (const auto* EnumProperty = FNYReflectionHelper::CastProperty<FEnumProperty>(Property))
+	{
+		const int64 Value = EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr);
+		int32 NameIndex = GetNameIndex(EnumProperty->GetEnum()->GetNameByValue(Value));
+		Ar << NameIndex;
+		return;
+	}
+
+	// Numeric, int, float, possible enum
+	if (const auto* NumericProperty = FNYReflectionHelper::CastProperty<FNumericProperty>(Property))
+	{
+		if (const UEnum* Enum = NumericProperty->GetIntPropertyEnum())
+		{
+			int32 NameIndex = GetNameIndex(Enum->GetNameByValue(NumericProperty->GetSignedIntPropertyValue(ValuePtr)));
+			Ar << NameIndex;
+		}
+		else if (NumericProperty->IsFloatingPoint())
+		{
+			double Value = NumericProperty->GetFloatingPointPropertyValue(ValuePtr);
+			Ar << Value;
+		}
+		else
+		{
+			int64 Value = NumericProperty->GetSignedIntPropertyValue(ValuePtr);
+			Ar << Value;
+		}
+		return;
+	}
+
+	// Bool
+	if (const auto* BoolProperty = FNYReflectionHelper::CastProperty<FBoolProperty>(Property))
+	{
+		uint8 Value = BoolProperty->GetPropertyValue(ValuePtr) ? 1 : 0;
+		Ar << Value;
+		return;
+	}
+
+	// FString, saving does not modify it
+	if (FNYReflectionHelper::CastProperty<FStrProperty>(Property) != nullptr)
+	{
+		Ar << *const_cast<FString*>(static_cast<const FString*>(ValuePtr));
+		return;
+	}
+
+	// FName
+	if (FNYReflectionHelper::CastProperty<FNameProperty>(Property) != nullptr)
+	{
+		int32 NameIndex = GetNameIndex(*static_cast<const FName*>(ValuePtr));
+		Ar << NameIndex;
+		return;
+	}
+
+	// FText, same as the other formats only the string is kept
+	if (const auto* TextProperty = FNYReflectionHelper::CastProperty<FTextProperty>(Property))
+	{
+		int32 StringIndex = GetStringIndex(TextProperty->GetPropertyValue(ValuePtr).ToString());
+		Ar << StringIndex;
+		return;
+	}
+
+	// TArray
+	if (const auto* ArrayProperty = FNYReflectionHelper::CastProperty<FArrayProperty>(Property))
+	{
+		const FDlgConstScriptArrayHelper Helper(ArrayProperty, ValuePtr);
+		int32 Num = Helper.Num();
+		Ar << Num;
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			WriteValue(Ar, ArrayProperty->Inner, Helper.GetConstRawPtr(Index));
+		}
+		return;
+	}
+
+	// TSet
+	if (const auto* SetProperty = FNYReflectionHelper::CastProperty<FSetProperty>(Property))
+	{
+		const FScriptSetHelper Helper(SetProperty, ValuePtr);
+		int32 Num = Helper.Num();
+		Ar << Num;
+
+		// GetMaxIndex() instead of Num() - the container is not contiguous
+		// elements are in [0, GetMaxIndex[, some of them are invalid (Num() returns with the valid element num)
+		for (int32 Index = 0; Index < Helper.GetMaxIndex(); Index++)
+		{
+			if (Helper.IsValidIndex(Index))
+			{
+				WriteValue(Ar, SetProperty->ElementProp, Helper.GetElementPtr(Index));
+			}
+		}
+		return;
+	}
+
+	// TMap
+	if (const auto* MapProperty = FNYReflectionHelper::CastProperty<FMapProperty>(Property))
+	{
+		const FDlgConstScriptMapHelper Helper(MapProperty, ValuePtr);
+		int32 Num = Helper.Num();
+		Ar << Num;
+		for (int32 Index = 0; Index < Helper.GetMaxIndex(); Index++)
+		{
+			if (Helper.IsValidIndex(Index))
+			{
+				WriteValue(Ar, MapProperty->KeyProp, Helper.GetConstKeyPtr(Index));
+				WriteValue(Ar, MapProperty->ValueProp, Helper.GetConstValuePtr(Index));
+			}
+		}
+		return;
+	}
+
+	// UStruct
+	if (const auto* StructProperty = FNYReflectionHelper::CastProperty<FStructProperty>(Property))
+	{
+		WriteStruct(Ar, StructProperty, ValuePtr);
+		return;
+	}
+
+	// UObject
+	if (const auto* ObjectProperty = FNYReflectionHelper::CastProperty<FObjectProperty>(Property))
+	{
+		WriteObject(Ar, ObjectProperty, ValuePtr);
+		return;
+	}
+
+	WriteExportedText(Ar, Property, ValuePtr);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgBinaryWriter::WriteStruct(FArchive& Ar, const FStructProperty* StructProperty, const void* ValuePtr)
+{
+	// Structs with native text export know best how to write themselves, same as in the JSON writer
+	UScriptStruct::ICppStructOps* TheCppStructOps = StructProperty->Struct->GetCppStructOps();
+	if (TheCppStructOps && TheCppStructOps->HasExportTextItem())
+	{
+		FString ValueString;
+		TheCppStructOps->ExportTextItem(ValueString, ValuePtr, ValuePtr, nullptr, PPF_None, nullptr);
+		Ar << ValueString;
+		return;
+	}
+
+	WriteStructBlock(Ar, StructProperty->Struct, ValuePtr);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgBinaryWriter::WriteObject(FArchive& Ar, const FObjectProperty* ObjectProperty, const void* ValuePtr)
+{
+	const UObject* Object = ObjectProperty->GetObjectPropertyValue(ValuePtr);
+	if (Object == nullptr || !Object->IsValidLowLevelFast())
+	{
+		uint8 Tag = static_cast<uint8>(EDlgBinaryObjectTag::Null);
+		Ar << Tag;
+		return;
+	}
+
+	// Special case were we want just to save a reference to the object location
+	if (CanSaveAsReference(ObjectProperty, Object))
+	{
+		uint8 Tag = static_cast<uint8>(EDlgBinaryObjectTag::Reference);
+		FString Path = Object->GetPathName();
+		Ar << Tag;
+		Ar << Path;
+		return;
+	}
+
+	// The class is written because of inheritance
+	uint8 Tag = static_cast<uint8>(EDlgBinaryObjectTag::Instanced);
+	int32 ClassNameIndex = GetNameIndex(Object->GetClass()->GetFName());
+	Ar << Tag;
+	Ar << ClassNameIndex;
+	WriteStructBlock(Ar, Object->GetClass(), Object);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgBinaryWriter::WriteExportedText(FArchive& Ar, const FProperty* Property, const void* ValuePtr)
+{
+	FString ValueString;
+#if NY_ENGINE_VERSION >= 501
+	Property->ExportTextItem_Direct(ValueString, ValuePtr, ValuePtr, nullptr, PPF_None);
+#else
+	Property->ExportTextItem(ValueString, ValuePtr, ValuePtr, nullptr, PPF_None);
+#endif
+
+	Ar << ValueString;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int32 FDlgBinaryWriter::GetNameIndex(FName Name)
+{
+	return GetStringIndex(Name.ToString());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int32 FDlgBinaryWriter::GetStringIndex(const FString& String)
+{
+	if (const int32* Index = StringToIndex.Find(String))
+	{
+		return *Index;
+	}
+
+	const int32 Index = Strings.Add(String);
+	StringToIndex.Add(String, Index);
+	return Index;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int64 FDlgBinaryWriter::BeginSizePrefix(FArchive& Ar)
+{
+	const int64 Position = Ar.Tell();
+	int32 Placeholder = 0;
+	Ar << Placeholder;
+	return Position;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgBinaryWriter::PatchInt32(FArchive& Ar, int64 Position, int32 Value)
+{
+	const int64 EndPosition = Ar.Tell();
+	Ar.Seek(Position);
+	Ar << Value;
+	Ar.Seek(EndPosition);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgBinaryWriter::EndSizePrefix(FArchive& Ar, int64 Position)
+{
+	const int64 Size = Ar.Tell() - Position - static_cast<int64>(sizeof(int32));
+	PatchInt32(Ar, Position, static_cast<int32>(Size));
+}
@@ -0,0 +1,85 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+#include "UObject/UnrealType.h"
+
+#include "IDlgWriter.h"
+#include "DlgBinaryTypes.h"
+#include "DlgSerializationPlan.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDlgBinaryWriter, All, All);
+
+class FArchive;
+
+/**
+ * Writes the reflected data in the compact binary format, see DlgBinaryTypes.h for the layout.
+ * Reads back with FDlgBinaryParser.
+ * See IDlgWriter for properties and METADATA specifiers.
+ */
+class DLGSYSTEM_API FDlgBinaryWriter : public IDlgWriter
+{
+public:
+	FDlgBinaryWriter() {};
+
+	// IDlgWriter Interface
+	void Write(const UStruct* StructDefinition, const void* Object) override;
+
+	/**
+	 * Save the binary data to a file
+	 * @param FileName: Full path + file name + extension
+	 * @return	False on failure to write
+	 */
+	bool ExportToFile(const FString& FileName) override;
+
+	/**
+	 * The binary data as a Base64 string, for the users of the string interface like the tests.
+	 * FDlgBinaryParser::InitializeParserFromString reads it back.
+	 */
+	const FString& GetAsString() const override;
+
+	// The written binary data
+	const TArray<uint8>& GetAsBytes() const { return Bytes; }
+
+private:
+	// Writes the properties of the struct/object as a struct block
+	void WriteStructBlock(FArchive& Ar, const UStruct* StructDefinition, const void* ContainerPtr);
+
+	// Writes the value of a property, ValuePtr points directly to the value
+	void WriteValue(FArchive& Ar, const FProperty* Property, const void* ValuePtr);
+
+	void WriteStruct(FArchive& Ar, const FStructProperty* StructProperty, const void* ValuePtr);
+	void WriteObject(FArchive& Ar, const FObjectProperty* ObjectProperty, const void* ValuePtr);
+
+	// Fallback for everything else
+	static void WriteExportedText(FArchive& Ar, const FProperty* Property, const void* ValuePtr);
+
+	// Index of the string in the string table
+	int32 GetNameIndex(FName Name);
+	int32 GetStringIndex(const FString& String);
+
+	// Writes an int32 placeholder and returns its position, see EndSizePrefix
+	static int64 BeginSizePrefix(FArchive& Ar);
+
+	// Writes Value in the placeholder at Position
+	static void PatchInt32(FArchive& Ar, int64 Position, int32 Value);
+
+	// Writes the size of everything written since BeginSizePrefix
+	static void EndSizePrefix(FArchive& Ar, int64 Position);
+
+private:
+	// The written file
+	TArray<uint8> Bytes;
+
+	// Lazily built in GetAsString
+	mutable FString Base64String;
+	mutable bool bHasBase64String = false;
+
+	// String table
+	TArray<FString> Strings;
+
+	// Case sensitive, used for the names and the texts.
+	// NOTE: not keyed by FName, the FName comparison ignores the case and names that only differ in case would share the same entry
+	TMap<FString, int32, FDefaultSetAllocator, FDlgBinaryStringKeyFuncs> StringToIndex;
+};
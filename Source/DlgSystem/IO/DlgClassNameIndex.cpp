@@ -0,0 +1,115 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgClassNameIndex.h"
+
+#include "Misc/ScopeLock.h"
+#include "UObject/Class.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/UObjectHash.h"
+
+#include "DlgSystem/NYEngineVersionHelpers.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+const UClass* FDlgClassNameIndex::FindChildClass(const UClass* ParentClass, const FString& Name)
+{
+	if (ParentClass == nullptr || Name.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	// Every class name is in the name table, if the name is not there the class does not exist
+	const FName ClassName(*Name, FNAME_Find);
+	if (ClassName.IsNone())
+	{
+		return nullptr;
+	}
+
+	FScopeLock Lock(&CriticalSection);
+	TMap<FName, TWeakObjectPtr<UClass>>* NameToClass = Indices.Find(ParentClass);
+	if (NameToClass == nullptr)
+	{
+		NameToClass = &Indices.Add(ParentClass);
+		BuildIndex(ParentClass, *NameToClass);
+	}
+
+	if (const TWeakObjectPtr<UClass>* ClassPtr = NameToClass->Find(ClassName))
+	{
+		// Garbage collected or replaced by a reload since the index was built
+		UClass* Class = ClassPtr->Get();
+		if (IsValidChildClass(Class, ParentClass))
+		{
+			return Class;
+		}
+		NameToClass->Remove(ClassName);
+	}
+
+#if NY_ENGINE_VERSION >= 500
+	// A class registered since the last search could have one of the names
+	const uint64 ClassesVersion = GetRegisteredClassesVersionNumber();
+	if (ClassesVersion != NotFoundClassesVersion)
+	{
+		NotFoundNames.Empty();
+		NotFoundClassesVersion = ClassesVersion;
+	}
+#endif
+
+	TSet<FName>& NotFound = NotFoundNames.FindOrAdd(ParentClass);
+	if (NotFound.Contains(ClassName))
+	{
+		return nullptr;
+	}
+
+	// Not in the index, the class could have been loaded after the index was built (e.g. a Blueprint class)
+	UClass* Class = FindChildClassSlow(ParentClass, ClassName);
+	if (Class != nullptr)
+	{
+		NameToClass->Add(ClassName, Class);
+	}
+	else
+	{
+		NotFound.Add(ClassName);
+	}
+	return Class;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgClassNameIndex::Invalidate()
+{
+	FScopeLock Lock(&CriticalSection);
+	Indices.Empty();
+	NotFoundNames.Empty();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgClassNameIndex::IsValidChildClass(const UClass* Class, const UClass* ParentClass)
+{
+	return Class != nullptr
+		&& Class->IsChildOf(ParentClass)
+		&& !Class->HasAnyClassFlags(CLASS_Abstract | CLASS_NewerVersionExists);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgClassNameIndex::BuildIndex(const UClass* ParentClass, TMap<FName, TWeakObjectPtr<UClass>>& NameToClass)
+{
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		// The first one wins if there are more classes with the same name, like in FindChildClassSlow
+		if (IsValidChildClass(*It, ParentClass) && !NameToClass.Contains(It->GetFName()))
+		{
+			NameToClass.Add(It->GetFName(), *It);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+UClass* FDlgClassNameIndex::FindChildClassSlow(const UClass* ParentClass, FName Name)
+{
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		if (It->GetFName() == Name && IsValidChildClass(*It, ParentClass))
+		{
+			return *It;
+		}
+	}
+
+	return nullptr;
+}
@@ -0,0 +1,61 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/WeakObjectPtr.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UClass;
+
+/**
+ * Name -> UClass index used by the parsers to find the class of an object from its type name.
+ * There is one index per parent class, built the first time a class is looked up with that parent,
+ * and shared between all the parsers.
+ * The indices are dropped when modules are loaded or code is reloaded, see FDlgSystemModule.
+ * The names that are not found are remembered too, until the indices are dropped or a new class is registered.
+ */
+class DLGSYSTEM_API FDlgClassNameIndex
+{
+public:
+	static FDlgClassNameIndex& Get()
+	{
+		static FDlgClassNameIndex Instance;
+		return Instance;
+	}
+
+	/**
+	 * Finds the not abstract class that inherits from ParentClass
+	 *
+	 * @param ParentClass: the class we are looking for has to inherit from this class
+	 * @param Name: the name of the class we are looking for (without engine pretags, e.g. Actor for AActor)
+	 *
+	 * @return the class, or nullptr if it does not exist
+	 */
+	const UClass* FindChildClass(const UClass* ParentClass, const FString& Name);
+
+	// Drops all the indices, they are rebuilt on the next lookup
+	void Invalidate();
+
+private:
+	// Can the class be returned for ParentClass
+	static bool IsValidChildClass(const UClass* Class, const UClass* ParentClass);
+
+	// Adds all the current child classes of ParentClass to NameToClass
+	static void BuildIndex(const UClass* ParentClass, TMap<FName, TWeakObjectPtr<UClass>>& NameToClass);
+
+	// Searches all the classes, used when the class is not in the index
+	static UClass* FindChildClassSlow(const UClass* ParentClass, FName Name);
+
+private:
+	// Parent class -> (child class name -> child class)
+	TMap<const UClass*, TMap<FName, TWeakObjectPtr<UClass>>> Indices;
+
+	// Parent class -> child class names FindChildClassSlow did not find, so they are not searched again
+	TMap<const UClass*, TSet<FName>> NotFoundNames;
+
+	// GetRegisteredClassesVersionNumber when NotFoundNames was checked, a class registered since could be one of them
+	uint64 NotFoundClassesVersion = 0;
+
+	FCriticalSection CriticalSection;
+};
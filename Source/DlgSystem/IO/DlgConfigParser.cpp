@@ -1,6 +1,7 @@
 // Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
 #include "DlgConfigParser.h"
 
+#include "Algo/BinarySearch.h"
 #include "Logging/LogMacros.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
@@ -9,6 +10,8 @@
 #include "UObject/TextProperty.h"
 
 #include "DlgSystem/NYReflectionHelper.h"
+#include "DlgTextFileReader.h"
+#include "DlgSerializationPlan.h"
 
 DEFINE_LOG_CATEGORY(LogDlgConfigParser);
 
@@ -33,8 +36,9 @@ void FDlgConfigParser::InitializeParser(const FString& FilePath)
 	From = 0;
 	Len = 0;
 	bHasValidWord = false;
+	bHasLineTable = false;
 
-	if (!FFileHelper::LoadFileToString(String, *FilePath))
+	if (!FDlgTextFileReader::LoadFileToString(String, FilePath))
 	{
 		UE_LOG(LogDlgConfigParser, Error, TEXT("Failed to load config file %s"), *FilePath)
 	}
@@ -55,6 +59,7 @@ void FDlgConfigParser::InitializeParserFromString(const FString& Text)
 	From = 0;
 	Len = 0;
 	bHasValidWord = false;
+	bHasLineTable = false;
 	FindNextWord();
 }
 
@@ -82,8 +87,8 @@ bool FDlgConfigParser::ReadProperty(const UStruct* ReferenceClass, void* TargetO
 	}
 	check(From < String.Len());
 
-	const FString PropertyName = GetActiveWord();
-	auto* PropertyBase = ReferenceClass->FindPropertyByName(*PropertyName);
+	// NOTE: words that are not property names do not have to be added to the name table
+	auto* PropertyBase = FindPropertyByName(ReferenceClass, GetActiveWordAsName(FNAME_Find));
 	if (PropertyBase != nullptr)
 	{
 		// check primitive types and enums
@@ -107,7 +112,7 @@ bool FDlgConfigParser::ReadProperty(const UStruct* ReferenceClass, void* TargetO
 		}
 	}
 
-	auto* ComplexPropBase = ReferenceClass->FindPropertyByName(*PropertyName);
+	auto* ComplexPropBase = PropertyBase;
 
 	// struct
 	if (auto* StructProperty = FNYReflectionHelper::SmartCastProperty<FStructProperty>(ComplexPropBase))
@@ -120,6 +125,7 @@ bool FDlgConfigParser::ReadProperty(const UStruct* ReferenceClass, void* TargetO
 	}
 
 	// check complex object - type name has to be here as well (dynamic array)
+	const FString PropertyName = GetActiveWord();
 	const FString TypeName = PreTag + PropertyName;
 	if (!FindNextWord("block name"))
 	{
@@ -127,7 +133,6 @@ bool FDlgConfigParser::ReadProperty(const UStruct* ReferenceClass, void* TargetO
 	}
 
 	const bool bLoadByRef = IsNextWordString();
-	const FString VariableName = GetActiveWord();
 
 	// check if it is stored as reference
 	if (bLoadByRef)
@@ -138,6 +143,7 @@ bool FDlgConfigParser::ReadProperty(const UStruct* ReferenceClass, void* TargetO
 			return false;
 		}
 
+		const FString VariableName = GetActiveWord();
 		auto* ObjectPtrPtr = static_cast<UObject**>(ComplexPropBase->template ContainerPtrToValuePtr<void>(TargetObject));
 		*ObjectPtrPtr = nullptr; // reset first
 		if (!VariableName.TrimStartAndEnd().IsEmpty()) // null reference?
@@ -151,13 +157,9 @@ bool FDlgConfigParser::ReadProperty(const UStruct* ReferenceClass, void* TargetO
 	// UObject is in the format:
 	// - not nullptr - UObjectType PropertyName
 	// - nullptr - PropertyName ""
-	if (bHasNullptr)
+	if (!bHasNullptr)
 	{
-		ComplexPropBase = ReferenceClass->FindPropertyByName(*PropertyName);
-	}
-	else
-	{
-		ComplexPropBase = ReferenceClass->FindPropertyByName(*VariableName);
+		ComplexPropBase = FindPropertyByName(ReferenceClass, GetActiveWordAsName(FNAME_Find));
 	}
 	if (auto* ObjectProperty = FNYReflectionHelper::SmartCastProperty<FObjectProperty>(ComplexPropBase))
 	{
@@ -186,7 +188,8 @@ bool FDlgConfigParser::ReadPurePropertyBlock(void* TargetObject, const UStruct*
 
 	// parse precondition properties
 	FindNextWord();
-	while (!CheckIfBlockEnd(ReferenceClass->GetName()))
+	const FString BlockName = ReferenceClass->GetName();
+	while (!CheckIfBlockEnd(BlockName))
 	{
 		if (!bHasValidWord)
 		{
@@ -208,13 +211,13 @@ bool FDlgConfigParser::GetActiveWordAsFloat(float& FloatValue) const
 		return false;
 	}
 
-	const FString FloatString = String.Mid(From, Len);
-	if (FloatString.Len() == 0 || !FloatString.IsNumeric())
+	if (!IsActiveWordNumeric())
 	{
 		return false;
 	}
 
-	FloatValue = FCString::Atof(*FloatString);
+	// The word is followed by a whitespace, '"' or the end of the string, conversion stops there
+	FloatValue = FCString::Atof(&String[From]);
 	return true;
 }
 
@@ -226,13 +229,13 @@ bool FDlgConfigParser::GetActiveWordAsDouble(double& DoubleValue) const
 		return false;
 	}
 
-	const FString DoubleString = String.Mid(From, Len);
-	if (DoubleString.Len() == 0 || !DoubleString.IsNumeric())
+	if (!IsActiveWordNumeric())
 	{
 		return false;
 	}
 
-	DoubleValue = FCString::Atod(*DoubleString);
+	// The word is followed by a whitespace, '"' or the end of the string, conversion stops there
+	DoubleValue = FCString::Atod(&String[From]);
 	return true;
 }
 
@@ -282,87 +285,94 @@ bool FDlgConfigParser::FindNextWord()
 	}
 	bActiveIsString = false;
 
-	// Skip whitespaces
-	while (From < String.Len() && FChar::IsWhitespace(String[From]))
-	{
-		From++;
-	}
-
-	// Oh noeeeees
-	if (From >= String.Len())
-	{
-		bHasValidWord = false;
-		return false;
-	}
-
-	// Handle "" as special empty string
-	if (From + 1 < String.Len() && String[From] == '"' && String[From + 1] == '"')
-	{
-		From += 2; // skip both characters for the next string
-		Len = 0;
-		bHasValidWord = true;
-		bHasNullptr = true;
-		return true;
-	}
+	const int32 StringLen = String.Len();
+	const TCHAR* Chars = *String;
 
-	// Handle special string case - read everything between two "
-	if (String[From] == '"')
+	// Only loops to skip the comments
+	while (true)
 	{
-		Len = 1;
-		bActiveIsString = true;
-		// Find the closing "
-		while (From + Len < String.Len() && String[From + Len] != '"')
+		// Skip whitespaces
+		while (From < StringLen && FChar::IsWhitespace(Chars[From]))
 		{
-			Len++;
+			From++;
 		}
 
-		// Do not include the "" in the range
-		From += 1;
-		Len -= 1;
-
-		// Something very bad happened
-		if (Len <= 0)
+		// Oh noeeeees
+		if (From >= StringLen)
 		{
 			bHasValidWord = false;
 			return false;
 		}
 
-		bHasValidWord = true;
-		return true;
-	}
-
-	Len = 0;
-	// Is block begin/end
-	if (String[From] == '{' || String[From] == '}')
-	{
-		Len = 1;
-	}
-	else
-	{
-		// Count until we reach a whitespace char OR EOF
-		while (From + Len < String.Len() && !FChar::IsWhitespace(String[From + Len]))
+		// Handle "" as special empty string
+		if (From + 1 < StringLen && Chars[From] == '"' && Chars[From + 1] == '"')
 		{
-			Len++;
+			From += 2; // skip both characters for the next string
+			Len = 0;
+			bHasValidWord = true;
+			bHasNullptr = true;
+			return true;
 		}
-	}
 
-	// Skip comments //
-	if (Len > 1 && String[From] == '/' && String[From + 1] == '/')
-	{
-		// Advance past this line
-		while (From < String.Len() && String[From] != '\n' && String[From] != '\r')
+		// Handle special string case - read everything between two "
+		if (Chars[From] == '"')
 		{
-			From++;
+			Len = 1;
+			bActiveIsString = true;
+			// Find the closing "
+			while (From + Len < StringLen && Chars[From + Len] != '"')
+			{
+				Len++;
+			}
+
+			// Do not include the "" in the range
+			From += 1;
+			Len -= 1;
+
+			// Something very bad happened
+			if (Len <= 0)
+			{
+				bHasValidWord = false;
+				return false;
+			}
+
+			bHasValidWord = true;
+			return true;
 		}
 
-		// Use recursion to go to the next line
 		Len = 0;
-		return FindNextWord();
-	}
+		// Is block begin/end
+		if (Chars[From] == '{' || Chars[From] == '}')
+		{
+			Len = 1;
+		}
+		else
+		{
+			// Count until we reach a whitespace char OR EOF
+			while (From + Len < StringLen && !FChar::IsWhitespace(Chars[From + Len]))
+			{
+				Len++;
+			}
+		}
 
-	// Phew, valid word
-	bHasValidWord = true;
-	return true;
+		// Skip comments //
+		if (Len > 1 && Chars[From] == '/' && Chars[From + 1] == '/')
+		{
+			// Advance past this line
+			while (From < StringLen && Chars[From] != '\n' && Chars[From] != '\r')
+			{
+				From++;
+			}
+
+			// Go to the next line
+			Len = 0;
+			continue;
+		}
+
+		// Phew, valid word
+		bHasValidWord = true;
+		return true;
+	}
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -380,7 +390,7 @@ bool FDlgConfigParser::FindNextWord(const FString& ExpectedStuff)
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 bool FDlgConfigParser::FindNextWordAndCheckIfBlockStart(const FString& BlockName)
 {
-	if (!FindNextWord() || !CompareToActiveWord("{"))
+	if (!FindNextWord() || !CompareToActiveWord(TEXT("{")))
 	{
 		UE_LOG(LogDlgConfigParser, Warning, TEXT("Block start signal expected but not found for %s block in script %s (line: %d)"),
 											*BlockName, *FileName, GetActiveLineNumber());
@@ -414,16 +424,15 @@ bool FDlgConfigParser::CheckIfBlockEnd(const FString& BlockName)
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-bool FDlgConfigParser::CompareToActiveWord(const FString& StringToCompare) const
+bool FDlgConfigParser::CompareToActiveWord(const TCHAR* StringToCompare) const
 {
-	// Length differs?
-	if (!bHasValidWord || StringToCompare.Len() != Len)
+	if (!bHasValidWord)
 	{
 		return false;
 	}
 
-	// Content differs?
-	const TCHAR* SubStr = &String[From];
+	// Content differs? Also stops at the end of StringToCompare
+	const TCHAR* SubStr = *String + From;
 	for (int32 i = 0; i < Len; ++i)
 	{
 		if (SubStr[i] != StringToCompare[i])
@@ -432,6 +441,58 @@ bool FDlgConfigParser::CompareToActiveWord(const FString& StringToCompare) const
 		}
 	}
 
+	// Length differs?
+	return StringToCompare[Len] == '\0';
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FName FDlgConfigParser::GetActiveWordAsName(EFindName FindType) const
+{
+	if (!bHasValidWord || Len <= 0 || Len >= NAME_SIZE)
+	{
+		return NAME_None;
+	}
+
+#if NY_ENGINE_VERSION >= 423
+	return FName(Len, *String + From, FindType);
+#else
+	return FName(*String.Mid(From, Len), FindType);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgConfigParser::IsActiveWordNumeric() const
+{
+	if (!bHasValidWord || Len <= 0)
+	{
+		return false;
+	}
+
+	// Same as FCString::IsNumeric
+	const TCHAR* Word = *String + From;
+	int32 Index = 0;
+	if (Word[Index] == '-' || Word[Index] == '+')
+	{
+		Index++;
+	}
+
+	bool bHasDot = false;
+	for (; Index < Len; Index++)
+	{
+		if (Word[Index] == '.')
+		{
+			if (bHasDot)
+			{
+				return false;
+			}
+			bHasDot = true;
+		}
+		else if (!FChar::IsDigit(Word[Index]))
+		{
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -443,17 +504,32 @@ int32 FDlgConfigParser::GetActiveLineNumber() const
 		return INDEX_NONE;
 	}
 
-	int32 LineCount = 1;
-	for (int32 i = 0; i < String.Len() && i < From; ++i)
+	if (!bHasLineTable)
+	{
+		BuildLineTable();
+	}
+
+	// Every new line that starts before the word
+	return 1 + Algo::LowerBound(NewLineOffsets, From);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgConfigParser::BuildLineTable() const
+{
+	NewLineOffsets.Reset();
+	for (int32 i = 0; i < String.Len(); ++i)
 	{
 		switch (String[i])
 		{
 			case '\r':
+				NewLineOffsets.Add(i);
 				// let's handle '\r\n too
 				if (i + 1 < String.Len() && String[i + 1] == '\n')
 					++i;
+				break;
+
 			case '\n':
-				++LineCount;
+				NewLineOffsets.Add(i);
 				break;
 
 			default:
@@ -461,7 +537,7 @@ int32 FDlgConfigParser::GetActiveLineNumber() const
 		}
 	}
 
-	return LineCount;
+	bHasLineTable = true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -528,7 +604,8 @@ bool FDlgConfigParser::TryToReadEnum(void* Target, FProperty* PropertyBase)
 		}
 		else
 		{
-			Value = FName(*String.Mid(From, Len));
+			// Names that do not exist can't be enum values either
+			Value = GetActiveWordAsName(FNAME_Find);
 		}
 
 		auto* Prop = FNYReflectionHelper::SmartCastProperty<FEnumProperty>(PropertyBase);
@@ -636,7 +713,7 @@ bool FDlgConfigParser::ReadMap(void* TargetObject, FMapProperty& Property, UObje
 			auto* StructVal = FNYReflectionHelper::CastProperty<FStructProperty>(Props[i]);
 			if (StructVal != nullptr)
 			{
-				if (!CompareToActiveWord("{"))
+				if (!CompareToActiveWord(TEXT("{")))
 				{
 					UE_LOG(LogDlgConfigParser, Warning, TEXT("Syntax error: missing struct block start '{' in script %s(:%d)"),
 							*FileName, GetActiveLineNumber());
@@ -706,6 +783,19 @@ const UClass* FDlgConfigParser::SmartGetPropertyClass(FProperty* Property, const
 	return Class;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FProperty* FDlgConfigParser::FindPropertyByName(const UStruct* Struct, FName PropertyName)
+{
+	if (Struct == nullptr || PropertyName.IsNone())
+	{
+		return nullptr;
+	}
+
+	const FDlgSerializationPlanRef Plan = FDlgSerializationPlanCache::Get().FindOrBuild(Struct);
+	const FDlgSerializationPlanProperty* Found = Plan->FindProperty(PropertyName);
+	return Found ? Found->Property : nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 void FDlgConfigParser::OnInvalidValue(const FString& PropType) const
 {
@@ -723,9 +813,9 @@ void FDlgConfigParser::OnInvalidValue(const FString& PropType) const
 bool FDlgConfigParser::GetAsBool() const
 {
 	bool bValue = false;
-	if (CompareToActiveWord("True"))
+	if (CompareToActiveWord(TEXT("True")))
 		bValue = true;
-	else if (!CompareToActiveWord("False"))
+	else if (!CompareToActiveWord(TEXT("False")))
 		OnInvalidValue("Bool");
 	return bValue;
 }
@@ -750,11 +840,10 @@ double FDlgConfigParser::GetAsDouble() const
 int32 FDlgConfigParser::GetAsInt32() const
 {
 	int32 Value = 0;
-	const FString IntString = String.Mid(From, Len);
-	if (IntString.Len() == 0 || (!IntString.IsNumeric()))
+	if (!IsActiveWordNumeric())
 		OnInvalidValue("int32");
 	else
-		Value = FCString::Atoi(*IntString);
+		Value = FCString::Atoi(&String[From]);
 	return Value;
 }
 
@@ -762,11 +851,10 @@ int32 FDlgConfigParser::GetAsInt32() const
 int64 FDlgConfigParser::GetAsInt64() const
 {
 	int64 Value = 0;
-	const FString IntString = String.Mid(From, Len);
-	if (IntString.Len() == 0 || (!IntString.IsNumeric()))
+	if (!IsActiveWordNumeric())
 		OnInvalidValue("int64");
 	else
-		Value = FCString::Atoi64(*IntString);
+		Value = FCString::Atoi64(&String[From]);
 	return Value;
 }
 
@@ -777,7 +865,7 @@ FName FDlgConfigParser::GetAsName() const
 	if (Len <= 0)
 		OnInvalidValue("FName");
 	else
-		Value = FName(*String.Mid(From, Len));
+		Value = GetActiveWordAsName(FNAME_Add);
 	return Value;
 }
 
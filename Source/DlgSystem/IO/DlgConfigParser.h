@@ -147,15 +147,18 @@ private:
 	 *
 	 * @return Whether the word and the strings are equal
 	 */
-	bool CompareToActiveWord(const FString& StringToCompare) const;
+	bool CompareToActiveWord(const TCHAR* StringToCompare) const;
 
 	/**
 	 * Calculates the line count for the current word
-	 * TODO: could be counted on the fly
+	 * The offsets of the new lines are only searched once per file, on the first call
 	 * @return Active line index, or INDEX_NONE if there is no valid word
 	 */
 	int32 GetActiveLineNumber() const;
 
+	// Fills NewLineOffsets
+	void BuildLineTable() const;
+
 	// @return false if the file could not be read or if the end of file is reached
 	bool HasValidWord() const { return bHasValidWord; }
 
@@ -165,6 +168,15 @@ private:
 	 */
 	FString GetActiveWord() const { return bHasValidWord ? String.Mid(From, Len) : ""; }
 
+	/**
+	 * Converts the active word without copying it first
+	 * @param FindType: use FNAME_Find if the name is only looked up, returns NAME_None if it does not exist
+	 */
+	FName GetActiveWordAsName(EFindName FindType) const;
+
+	/** Same as FString::IsNumeric for the active word, without copying it first */
+	bool IsActiveWordNumeric() const;
+
 	/**
 	 * @param FloatValue: out float value if the call succeeds
 	 * @return the active word converted, or an empty string if there isn't any
@@ -251,6 +263,9 @@ private:
 	/** gets the UClass from an UObject or from an array of UObjects */
 	const UClass* SmartGetPropertyClass(FProperty* Property, const FString& TypeName);
 
+	/** Same as UStruct::FindPropertyByName but the properties of each struct are only iterated once, see FDlgSerializationPlan */
+	FProperty* FindPropertyByName(const UStruct* Struct, FName PropertyName);
+
 private:
 
 	/** file path stored for log messages */
@@ -272,6 +287,10 @@ private:
 
 	/** used to skip the closing '"' */
 	bool bActiveIsString = false;
+
+	/** Offset of the first character of each new line ("\n", "\r" or "\r\n") in String, see GetActiveLineNumber */
+	mutable TArray<int32> NewLineOffsets;
+	mutable bool bHasLineTable = false;
 };
 
 
@@ -298,10 +317,11 @@ bool FDlgConfigParser::ReadPrimitiveProperty(void* Target,
 
 		TArray<Type>* Array = ArrayProp->ContainerPtrToValuePtr<TArray<Type>>(Target);
 		Array->Empty();
-		if (FindNextWordAndCheckIfBlockStart(TypeName + "Array"))
+		const FString BlockName = TypeName + "Array";
+		if (FindNextWordAndCheckIfBlockStart(BlockName))
 		{
 			// read values until the block ends
-			while (!FindNextWordAndCheckIfBlockEnd(TypeName + "Array"))
+			while (!FindNextWordAndCheckIfBlockEnd(BlockName))
 			{
 				if (!bHasValidWord && !bCanBeEmpty)
 				{
@@ -352,12 +372,13 @@ bool FDlgConfigParser::ReadComplexProperty(void* Target,
 		// Array
 		FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<uint8>(Target));
 		Helper.EmptyValues();
-		if (!FindNextWordAndCheckIfBlockStart(ReferenceType->GetName() + "Array element") || !FindNextWord("{ or }"))
+		const FString BlockName = ReferenceType->GetName() + "Array element";
+		if (!FindNextWordAndCheckIfBlockStart(BlockName) || !FindNextWord("{ or }"))
 		{
 			return false;
 		}
 
-		while (!CheckIfBlockEnd(ReferenceType->GetName() + "Array element"))
+		while (!CheckIfBlockEnd(BlockName))
 		{
 			const UClass* ReferenceClass = Cast<UClass>(ReferenceType);
 			if (ReferenceClass != nullptr)
@@ -386,7 +407,7 @@ bool FDlgConfigParser::ReadComplexProperty(void* Target,
 					return false;
 				}
 			}
-			else if (!CompareToActiveWord("{"))
+			else if (!CompareToActiveWord(TEXT("{")))
 			{
 				if (!bHasValidWord)
 				{
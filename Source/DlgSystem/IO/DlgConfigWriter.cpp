@@ -14,6 +14,7 @@ const TCHAR* FDlgConfigWriter::EOL_LF = TEXT("\n");
 const TCHAR* FDlgConfigWriter::EOL_CRLF = TEXT("\r\n");
 const TCHAR* FDlgConfigWriter::EOL = EOL_LF;
 const FString FDlgConfigWriter::EOL_String{EOL};
+const FString FDlgConfigWriter::SpaceString{TEXT(" ")};
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,15 +44,6 @@ void FDlgConfigWriter::WriteComplexMembersToString(const UStruct* StructDefiniti
 		return;
 	}
 
-	// order
-	TArray<const FProperty*> Primitives;
-	TArray<const FProperty*> PrimitiveContainers;
-	TArray<const FProperty*> ComplexElements;
-	TArray<const FProperty*> ComplexContainers;
-
-	constexpr int32 PropCategoryNum = 4;
-	TArray<const FProperty*>* PropCategory[PropCategoryNum] = { &Primitives, &PrimitiveContainers, &ComplexElements, &ComplexContainers };
-
 	// Handle UObject inheritance (children of class)
 	if (StructDefinition->IsA<UClass>())
 	{
@@ -68,40 +60,17 @@ void FDlgConfigWriter::WriteComplexMembersToString(const UStruct* StructDefiniti
 		return;
 	}
 
-	// Populate categories
-	for (TFieldIterator<FProperty> It(StructDefinition); It; ++It)
-	{
-		const auto* Property = *It;
-		if (IsPrimitive(Property))
-		{
-			Primitives.Add(Property);
-		}
-		else if (IsContainer(Property))
-		{
-			if (IsPrimitiveContainer(Property))
-			{
-				PrimitiveContainers.Add(Property);
-			}
-			else
-			{
-				ComplexContainers.Add(Property);
-			}
-		}
-		else
-		{
-			ComplexElements.Add(Property);
-		}
-	}
-
+	// Keep a reference, the plans can be invalidated while writing
+	const FDlgSerializationPlanRef Plan = FDlgSerializationPlanCache::Get().FindOrBuild(StructDefinition);
 	constexpr bool bContainerElement = false;
-	for (int32 i = 0; i < PropCategoryNum; ++i)
+	for (const FDlgSerializationPlanProperty* Entry : Plan->GetGroupedProperties())
 	{
-		for (const auto* Prop : *PropCategory[i])
+		if (Entry->bSkipOnWrite)
 		{
-			WritePropertyToString(Prop, Object, bContainerElement, PreString, PostString, false, Target);
+			continue;
 		}
+		WritePropertyToString(Entry->Property, Object, bContainerElement, PreString, PostString, false, Target);
 	}
-
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -207,7 +176,11 @@ bool FDlgConfigWriter::WritePrimitiveElementToString(const FProperty* Property,
 		{
 			const void* Value = EnumProp->ContainerPtrToValuePtr<uint8>(Object);
 			const FName EnumName = EnumProp->GetEnum()->GetNameByIndex(EnumProp->GetUnderlyingProperty()->GetSignedIntPropertyValue(Value));
-			Target += PreS + Property->GetName() + " " + NameToString(EnumName) + PostS;
+			Target += PreS;
+			Property->GetFName().AppendString(Target);
+			Target += TEXT(" ");
+			Target += NameToString(EnumName);
+			Target += PostS;
 			return true;
 		}
 	}
@@ -306,14 +279,16 @@ bool FDlgConfigWriter::WriteComplexElementToString(const FProperty* Property,
 		const FString Path = *ObjPtrPtr != nullptr ? (*ObjPtrPtr)->GetPathName() : "";
 		auto WritePathName = [&]()
 		{
-			if (bContainerElement)
-			{
-				Target += PreString + "\"" + Path + "\"" + PostString;
-			}
-			else
+			Target += PreString;
+			if (!bContainerElement)
 			{
-				Target += PreString + Property->GetName() + " \"" + Path + "\"" + PostString;
+				Property->GetFName().AppendString(Target);
+				Target += TEXT(" ");
 			}
+			Target += TEXT("\"");
+			Target += Path;
+			Target += TEXT("\"");
+			Target += PostString;
 		};
 
 		if (CanSaveAsReference(ObjectProperty, *ObjPtrPtr) || bPointerAsRef)
@@ -369,33 +344,42 @@ void FDlgConfigWriter::WriteComplexToString(const UStruct* StructDefinition,
 
 	// WARNING: bWriteType implicates objectproperty, if that changes this code (cause of the object cast) should be updated accordingly
 	const FString TypeString = bWriteType ? GetNameWithoutPrefix(Property, UnrealObject) + " ": "";
-	if (bContainerElement)
+	Target += PreString;
+	Target += TypeString;
+	if (!bContainerElement)
 	{
-		if (TypeString.Len() > 0)
-		{
-			Target += PreString + TypeString + (bLinePerMember ? EOL + PreString + "{" + EOL : "{ ");
-		}
-		else
+		Property->GetFName().AppendString(Target);
+	}
+
+	// Only a nameless and typeless element has its bracket on the same line when written line per member
+	if (bLinePerMember)
+	{
+		if (!bContainerElement || TypeString.Len() > 0)
 		{
-			Target += PreString + (bLinePerMember ? "{" + EOL_String : "{ ");
+			Target += EOL;
+			Target += PreString;
 		}
+		Target += TEXT("{");
+		Target += EOL;
 	}
 	else
 	{
-		Target += PreString + TypeString + Property->GetName() + (bLinePerMember ? EOL + PreString + "{" + EOL : " { ");
+		Target += bContainerElement ? TEXT("{ ") : TEXT(" { ");
 	}
 
 	// Write the properties of the Struct/Object
-	WriteComplexMembersToString(StructDefinition, Object, (bLinePerMember ? PreString + "\t" : " "), (bLinePerMember ? EOL_String : ""), Target);
-
 	if (bLinePerMember)
 	{
-		Target += PreString + "}" + PostString;
+		WriteComplexMembersToString(StructDefinition, Object, PreString + TEXT("\t"), EOL_String, Target);
+		Target += PreString;
+		Target += TEXT("}");
 	}
 	else
 	{
-		Target += " }" + PostString;
+		WriteComplexMembersToString(StructDefinition, Object, TEXT(" "), FString(), Target);
+		Target += TEXT(" }");
 	}
+	Target += PostString;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -431,28 +415,39 @@ bool FDlgConfigWriter::WriteComplexArrayToString(const FProperty* Property,
 		TypeText = GetStringWithoutPrefix(ObjProp->PropertyClass->GetName()) + " ";
 	}
 
+	const bool bPointerAsRef = CanSaveAsReference(ArrayProp, nullptr);
+	Target += PreString;
+	Target += TypeText;
+	ArrayProp->Inner->GetFName().AppendString(Target);
 	if (Helper.Num() == 1 && !WouldWriteNonPrimitive(GetComplexType(ArrayProp->Inner), Helper.GetConstRawPtr(0)))
 	{
-		Target += PreString + TypeText + ArrayProp->Inner->GetName() + " {";
-		for (int32 i = 0; i < Helper.Num(); ++i)
-		{
-			WriteComplexElementToString(ArrayProp->Inner, Helper.GetConstRawPtr(i), true, " ", "", CanSaveAsReference(ArrayProp, nullptr), Target);
-		}
-		Target += " }" + PostString;
+		Target += TEXT(" {");
+		WriteComplexElementToString(ArrayProp->Inner, Helper.GetConstRawPtr(0), true, TEXT(" "), FString(), bPointerAsRef, Target);
+		Target += TEXT(" }");
+		Target += PostString;
 	}
 	else
 	{
-		Target += PreString + TypeText + ArrayProp->Inner->GetName() + EOL;
-		Target += PreString + "{" + EOL;
+		Target += EOL;
+		Target += PreString;
+		Target += TEXT("{");
+		Target += EOL;
+
+		const FString SubPreString = PreString + TEXT("\t");
 		for (int32 i = 0; i < Helper.Num(); ++i)
 		{
 			if (bWriteIndex)
 			{
-				Target += PreString + "\t// " + FString::FromInt(i) + EOL;
+				Target += SubPreString;
+				Target += TEXT("// ");
+				Target.AppendInt(i);
+				Target += EOL;
 			}
-			WriteComplexElementToString(ArrayProp->Inner, Helper.GetConstRawPtr(i), true, PreString + "\t", EOL, CanSaveAsReference(ArrayProp, nullptr), Target);
+			WriteComplexElementToString(ArrayProp->Inner, Helper.GetConstRawPtr(i), true, SubPreString, EOL_String, bPointerAsRef, Target);
 		}
-		Target += PreString + "}" + EOL;
+		Target += PreString;
+		Target += TEXT("}");
+		Target += EOL;
 	}
 
 	return true;
@@ -482,7 +477,9 @@ bool FDlgConfigWriter::WriteMapToString(const FProperty* Property,
 	if (IsPrimitive(MapProp->KeyProp) && IsPrimitive(MapProp->ValueProp))
 	{
 		// Both Key and Value are primitives
-		Target += PreString + MapProp->GetName() + " { ";
+		Target += PreString;
+		MapProp->GetFName().AppendString(Target);
+		Target += TEXT(" { ");
 
 		// GetMaxIndex() instead of Num() - the container is not contiguous
 		// elements are in [0, GetMaxIndex[, some of them are invalid (Num() returns with the valid element num)
@@ -493,16 +490,24 @@ bool FDlgConfigWriter::WriteMapToString(const FProperty* Property,
 				continue;
 			}
 
-			WritePrimitiveElementToString(MapProp->KeyProp, Helper.GetPairPtr(i), true, "", " ", Target);
-			WritePrimitiveElementToString(MapProp->ValueProp, Helper.GetPairPtr(i), true, "", " ", Target);
+			WritePrimitiveElementToString(MapProp->KeyProp, Helper.GetPairPtr(i), true, FString(), SpaceString, Target);
+			WritePrimitiveElementToString(MapProp->ValueProp, Helper.GetPairPtr(i), true, FString(), SpaceString, Target);
 		}
-		Target += "}" + PostString;
+		Target += TEXT("}");
+		Target += PostString;
 	}
 	else
 	{
 		// Either Key or Value is not a primitive
-		Target += PreString + MapProp->GetName() + EOL;
-		Target += PreString + "{" + EOL;
+		Target += PreString;
+		MapProp->GetFName().AppendString(Target);
+		Target += EOL;
+		Target += PreString;
+		Target += TEXT("{");
+		Target += EOL;
+
+		const FString SubPreString = PreString + TEXT("\t");
+		const bool bPointerAsRef = CanSaveAsReference(MapProp, nullptr);
 
 		// GetMaxIndex() instead of Num() - the container is not contiguous
 		// elements are in [0, GetMaxIndex[, some of them are invalid (Num() returns with the valid element num)
@@ -513,10 +518,12 @@ bool FDlgConfigWriter::WriteMapToString(const FProperty* Property,
 				continue;
 			}
 
-			WritePropertyToString(MapProp->KeyProp, Helper.GetPairPtr(i), true, PreString + "\t", EOL, CanSaveAsReference(MapProp, nullptr), Target);
-			WritePropertyToString(MapProp->ValueProp, Helper.GetPairPtr(i), true, PreString + "\t", EOL, CanSaveAsReference(MapProp, nullptr), Target);
+			WritePropertyToString(MapProp->KeyProp, Helper.GetPairPtr(i), true, SubPreString, EOL_String, bPointerAsRef, Target);
+			WritePropertyToString(MapProp->ValueProp, Helper.GetPairPtr(i), true, SubPreString, EOL_String, bPointerAsRef, Target);
 		}
-		Target += PreString + "}" + EOL;
+		Target += PreString;
+		Target += TEXT("}");
+		Target += EOL;
 	}
 
 	return true;
@@ -547,15 +554,14 @@ bool FDlgConfigWriter::WriteSetToString(const FProperty* Property,
 	{
 		const bool bLinePerItem = CanWriteOneLinePerItem(SetProp);
 
-		// Add space indentation
-		FString SubPreString = PreString;
-		for (int32 i = 0; i < SetProp->GetName().Len() + 3; ++i)
-		{
-			SubPreString += " ";
-		}
+		// Add space indentation, the new line is part of it because the elements have no PostString
+		const FString PropertyName = SetProp->GetName();
+		const FString SubPreString = EOL_String + PreString + FString::ChrN(PropertyName.Len() + 3, TEXT(' '));
 
 		// SetName {
-		Target += PreString + SetProp->GetName() + " {";
+		Target += PreString;
+		Target += PropertyName;
+		Target += TEXT(" {");
 		if (!bLinePerItem)
 		{
 			// Add space because there is no new line
@@ -573,16 +579,21 @@ bool FDlgConfigWriter::WriteSetToString(const FProperty* Property,
 
 			if (bLinePerItem)
 			{
-				WritePrimitiveElementToString(SetProp->ElementProp, Helper.GetElementPtr(i), true, EOL + SubPreString, "", Target);
+				WritePrimitiveElementToString(SetProp->ElementProp, Helper.GetElementPtr(i), true, SubPreString, FString(), Target);
 			}
 			else
 			{
-				WritePrimitiveElementToString(SetProp->ElementProp, Helper.GetElementPtr(i), true, "", " ", Target);
+				WritePrimitiveElementToString(SetProp->ElementProp, Helper.GetElementPtr(i), true, FString(), SpaceString, Target);
 			}
 		}
 
 		// }
-		Target += (bLinePerItem ? " " : "") + FString("}") + PostString;
+		if (bLinePerItem)
+		{
+			Target += TEXT(" ");
+		}
+		Target += TEXT("}");
+		Target += PostString;
 	}
 	else
 	{
@@ -662,63 +673,58 @@ bool FDlgConfigWriter::WouldWriteNonPrimitive(const UStruct* StructDefinition, c
 		return false;
 	}
 
-	for (TFieldIterator<const FProperty> It(StructDefinition); It; ++It)
+	// Ignore primitives
+	const FDlgSerializationPlanRef Plan = FDlgSerializationPlanCache::Get().FindOrBuild(StructDefinition);
+	const TArray<const FDlgSerializationPlanProperty*>& Properties = Plan->GetGroupedProperties();
+	for (int32 Index = Plan->GetNumPrimitives(); Index < Properties.Num(); Index++)
 	{
-		const auto* Property = *It;
-
-		// Ignore primitives
-		if (IsPrimitive(Property))
+		const FDlgSerializationPlanProperty& Entry = *Properties[Index];
+		const FProperty* Property = Entry.Property;
+		switch (Entry.Kind)
 		{
-			continue;
-		}
-
-		if (IsContainer(Property))
-		{
-			// Map
-			if (const auto* MapProperty = FNYReflectionHelper::CastProperty<FMapProperty>(Property))
+			case EDlgPropertyKind::Map:
 			{
-				const FScriptMapHelper Helper(MapProperty, Property->ContainerPtrToValuePtr<uint8>(Owner));
+				const FScriptMapHelper Helper(FNYReflectionHelper::CastProperty<FMapProperty>(Property), Entry.GetValuePtr(Owner));
 				if (Helper.Num() > 0)
 				{
 					return true;
 				}
+				break;
 			}
-
-			// Array
-			if (const auto* ArrayProperty = FNYReflectionHelper::CastProperty<FArrayProperty>(Property))
+			case EDlgPropertyKind::Array:
 			{
-				const FScriptArrayHelper Helper(ArrayProperty, Property->ContainerPtrToValuePtr<uint8>(Owner));
+				const FScriptArrayHelper Helper(FNYReflectionHelper::CastProperty<FArrayProperty>(Property), Entry.GetValuePtr(Owner));
 				if (Helper.Num() > 0)
 				{
 					return true;
 				}
+				break;
 			}
-
-			// Set
-			if (const auto* SetProperty = FNYReflectionHelper::CastProperty<FSetProperty>(Property))
+			case EDlgPropertyKind::Set:
 			{
-				const FScriptSetHelper Helper(SetProperty, Property->ContainerPtrToValuePtr<uint8>(Owner));
+				const FScriptSetHelper Helper(FNYReflectionHelper::CastProperty<FSetProperty>(Property), Entry.GetValuePtr(Owner));
 				if (Helper.Num() > 0)
 				{
 					return true;
 				}
+				break;
 			}
-		}
-		else
-		{
-			if (FNYReflectionHelper::CastProperty<FStructProperty>(Property) != nullptr)
-			{
+			case EDlgPropertyKind::Struct:
 				return true;
-			}
 
-			if (const auto* ObjectProperty = FNYReflectionHelper::CastProperty<FObjectProperty>(Property))
+			case EDlgPropertyKind::Object:
 			{
-				UObject** ObjPtrPtr = ((UObject**)ObjectProperty->ContainerPtrToValuePtr<void>(Owner, 0));
-				if (ObjPtrPtr != nullptr && !CanSaveAsReference(Property, *ObjPtrPtr))
+				const UObject* const* ObjPtrPtr = static_cast<const UObject* const*>(Entry.GetValuePtr(Owner));
+				if (!CanSaveAsReference(Property, *ObjPtrPtr))
+				{
 					return true;
+				}
+				break;
 			}
-		}
 
+			default:
+				break;
+		}
 	}
 
 	return false;
@@ -7,6 +7,7 @@
 #include "Misc/FileHelper.h"
 
 #include "IDlgWriter.h"
+#include "DlgSerializationPlan.h"
 #include "DlgSystem/NYReflectionHelper.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogDlgConfigWriter, Log, All);
@@ -144,7 +145,7 @@ protected:
 	bool WritePrimitiveElementToStringTemplated(const FProperty* Property,
 												const void* Object,
 												bool bContainerElement,
-												std::function<FString(const VariableType&)> GetAsString,
+												const std::function<FString(const VariableType&)>& GetAsString,
 												const FString& PreString,
 												const FString& PostString,
 												FString& Target)
@@ -152,10 +153,14 @@ protected:
 		const PropertyType* CastedProperty = FNYReflectionHelper::CastProperty<PropertyType>(Property);
 		if (CastedProperty != nullptr)
 		{
-			Target += PreString +
-					  (bContainerElement ? "" : (CastedProperty->GetName() + " ")) +
-					  GetAsString(CastedProperty->GetPropertyValue_InContainer(Object, 0)) +
-					  PostString;
+			Target += PreString;
+			if (!bContainerElement)
+			{
+				CastedProperty->GetFName().AppendString(Target);
+				Target += TEXT(" ");
+			}
+			Target += GetAsString(CastedProperty->GetPropertyValue_InContainer(Object, 0));
+			Target += PostString;
 			return true;
 		}
 
@@ -166,7 +171,7 @@ protected:
 	template <typename PropertyType, typename VariableType>
 	bool WritePrimitiveArrayToStringTemplated(const FArrayProperty* ArrayProp,
 											  const void* Object,
-											  std::function<FString(const VariableType&)> ToString,
+											  const std::function<FString(const VariableType&)>& ToString,
 											  const FString& PreString,
 											  const FString& PostString,
 											  FString& Target)
@@ -184,37 +189,45 @@ protected:
 		const bool bLinePerItem = CanWriteOneLinePerItem(ArrayProp);
 
 		// Empty array
-		const TArray<VariableType> Array = *ArrayPtr;
+		const TArray<VariableType>& Array = *ArrayPtr;
 		if (Array.Num() == 0 && bDontWriteEmptyContainer)
 		{
 			return true;
 		}
 
 		// Establish indentation to be the same as the ArrayName.len + 3 spaces
-		FString SubPreString = PreString;
-		for (int32 i = 0; i < ArrayProp->GetName().Len() + 3; ++i)
-		{
-			SubPreString += " ";
-		}
+		const FString PropertyName = ArrayProp->GetName();
+		const FString SubPreString = PreString + FString::ChrN(PropertyName.Len() + 3, TEXT(' '));
 
 		// ArrayName {
-		Target += PreString + ArrayProp->GetName() + " {" + (bLinePerItem ? EOL_String : " ");
+		Target += PreString;
+		Target += PropertyName;
+		Target += TEXT(" {");
+		Target += bLinePerItem ? EOL : TEXT(" ");
 
 		// Array content
-		for (int32 i = 0; i < Array.Num(); ++i)
+		for (const VariableType& Item : Array)
 		{
 			if (bLinePerItem)
 			{
-				Target += SubPreString + ToString(Array[i]) + EOL;
+				Target += SubPreString;
+				Target += ToString(Item);
+				Target += EOL;
 			}
 			else
 			{
-				Target += ToString(Array[i]) + " ";
+				Target += ToString(Item);
+				Target += TEXT(" ");
 			}
 		}
 
 		// }
-		Target += (bLinePerItem ? PreString : "") + "}" + PostString;
+		if (bLinePerItem)
+		{
+			Target += PreString;
+		}
+		Target += TEXT("}");
+		Target += PostString;
 
 		return true;
 	}
@@ -224,7 +237,7 @@ protected:
 	bool WritePrimitiveToStringTemplated(const FProperty* Property,
 										 const void* Object,
 										 bool bContainerElement,
-										 std::function<FString(const VariableType&)> GetAsString,
+										 const std::function<FString(const VariableType&)>& GetAsString,
 										 const FString& PreString,
 										 const FString& PostString,
 										 FString& Target)
@@ -232,10 +245,14 @@ protected:
 		const PropertyType* CastedProperty = FNYReflectionHelper::CastProperty<PropertyType>(Property);
 		if (CastedProperty != nullptr)
 		{
-			Target += PreString +
-					  (bContainerElement ? "" : (CastedProperty->GetName() + " ")) +
-					  GetAsString(*((VariableType*)(Object))) +
-					  PostString;
+			Target += PreString;
+			if (!bContainerElement)
+			{
+				CastedProperty->GetFName().AppendString(Target);
+				Target += TEXT(" ");
+			}
+			Target += GetAsString(*((VariableType*)(Object)));
+			Target += PostString;
 			return true;
 		}
 
@@ -256,6 +273,7 @@ private:
 
 	// Helper strings
 	static const FString EOL_String;
+	static const FString SpaceString;
 
 	FString ConfigText = "";
 
@@ -0,0 +1,251 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgHashWriter.h"
+
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+
+#include "DlgSystem/DlgHelper.h"
+#include "DlgSystem/NYReflectionHelper.h"
+#include "DlgSerializationPlan.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgHashWriter::Write(const UStruct* StructDefinition, const void* Object)
+{
+	Hash = Seed;
+	HashAsString.Empty();
+	HashStruct(StructDefinition, Object);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgHashWriter::ExportToFile(const FString& FileName)
+{
+	return FFileHelper::SaveStringToFile(GetAsString(), *FileName);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+const FString& FDlgHashWriter::GetAsString() const
+{
+	if (HashAsString.IsEmpty())
+	{
+		HashAsString = FString::Printf(TEXT("%016llx"), Hash);
+	}
+
+	return HashAsString;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgHashWriter::HashStruct(const UStruct* StructDefinition, const void* ContainerPtr)
+{
+	if (StructDefinition == nullptr || ContainerPtr == nullptr)
+	{
+		HashInt(INDEX_NONE);
+		return;
+	}
+
+	// Handle UObject inheritance (children of class)
+	if (StructDefinition->IsA<UClass>())
+	{
+		StructDefinition = static_cast<const UObject*>(ContainerPtr)->GetClass();
+	}
+
+	const FDlgSerializationPlanRef Plan = FDlgSerializationPlanCache::Get().FindOrBuild(StructDefinition);
+	for (const FDlgSerializationPlanProperty& Entry : Plan->GetProperties())
+	{
+		if (Entry.bSkipOnWrite)
+		{
+			continue;
+		}
+
+		HashName(Entry.Name);
+		for (int32 Index = 0; Index < Entry.ArrayDim; Index++)
+		{
+			HashValue(Entry.Property, Entry.GetValuePtr(ContainerPtr, Index));
+		}
+	}
+
+	// End of the struct, so that the fields of nested structs can't be mistaken for the fields of the parent
+	HashInt(INDEX_NONE);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgHashWriter::HashValue(const FProperty* Property, const void* ValuePtr)
+{
+	check(Property);
+
+	// Enum, int, float, the value is enough, the writers only change the representation
+	if (const auto* EnumProperty = FNYReflectionHelper::CastProperty<FEnumProperty>(Property))
+	{
+		HashInt(EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr));
+		return;
+	}
+	if (const auto* NumericProperty = FNYReflectionHelper::CastProperty<FNumericProperty>(Property))
+	{
+		if (NumericProperty->IsFloatingPoint())
+		{
+			const double Value = NumericProperty->GetFloatingPointPropertyValue(ValuePtr);
+			HashBytes(&Value, sizeof(Value));
+		}
+		else
+		{
+			HashInt(NumericProperty->GetSignedIntPropertyValue(ValuePtr));
+		}
+		return;
+	}
+
+	// Bool, can be a bitfield
+	if (const auto* BoolProperty = FNYReflectionHelper::CastProperty<FBoolProperty>(Property))
+	{
+		HashInt(BoolProperty->GetPropertyValue(ValuePtr) ? 1 : 0);
+		return;
+	}
+
+	// FString, FName, FText
+	if (FNYReflectionHelper::CastProperty<FStrProperty>(Property) != nullptr)
+	{
+		HashString(*static_cast<const FString*>(ValuePtr));
+		return;
+	}
+	if (FNYReflectionHelper::CastProperty<FNameProperty>(Property) != nullptr)
+	{
+		HashName(*static_cast<const FName*>(ValuePtr));
+		return;
+	}
+	if (const auto* TextProperty = FNYReflectionHelper::CastProperty<FTextProperty>(Property))
+	{
+		HashString(TextProperty->GetPropertyValue(ValuePtr).ToString());
+		return;
+	}
+
+	// TArray
+	if (const auto* ArrayProperty = FNYReflectionHelper::CastProperty<FArrayProperty>(Property))
+	{
+		const FDlgConstScriptArrayHelper Helper(ArrayProperty, ValuePtr);
+		HashInt(Helper.Num());
+		for (int32 Index = 0; Index < Helper.Num(); Index++)
+		{
+			HashValue(ArrayProperty->Inner, Helper.GetConstRawPtr(Index));
+		}
+		return;
+	}
+
+	// TSet, same order as the writers
+	if (const auto* SetProperty = FNYReflectionHelper::CastProperty<FSetProperty>(Property))
+	{
+		const FScriptSetHelper Helper(SetProperty, ValuePtr);
+		HashInt(Helper.Num());
+		for (int32 Index = 0; Index < Helper.GetMaxIndex(); Index++)
+		{
+			if (Helper.IsValidIndex(Index))
+			{
+				HashValue(SetProperty->ElementProp, Helper.GetElementPtr(Index));
+			}
+		}
+		return;
+	}
+
+	// TMap, same order as the writers
+	if (const auto* MapProperty = FNYReflectionHelper::CastProperty<FMapProperty>(Property))
+	{
+		const FDlgConstScriptMapHelper Helper(MapProperty, ValuePtr);
+		HashInt(Helper.Num());
+		for (int32 Index = 0; Index < Helper.GetMaxIndex(); Index++)
+		{
+			if (Helper.IsValidIndex(Index))
+			{
+				HashValue(MapProperty->KeyProp, Helper.GetConstKeyPtr(Index));
+				HashValue(MapProperty->ValueProp, Helper.GetConstValuePtr(Index));
+			}
+		}
+		return;
+	}
+
+	// UStruct, the ones with native text export are exported as text by the writers
+	if (const auto* StructProperty = FNYReflectionHelper::CastProperty<FStructProperty>(Property))
+	{
+		UScriptStruct::ICppStructOps* TheCppStructOps = StructProperty->Struct->GetCppStructOps();
+		if (TheCppStructOps && TheCppStructOps->HasExportTextItem())
+		{
+			HashExportedText(Property, ValuePtr);
+		}
+		else
+		{
+			HashStruct(StructProperty->Struct, ValuePtr);
+		}
+		return;
+	}
+
+	// UObject
+	if (const auto* ObjectProperty = FNYReflectionHelper::CastProperty<FObjectProperty>(Property))
+	{
+		HashObject(ObjectProperty, ValuePtr);
+		return;
+	}
+
+	HashExportedText(Property, ValuePtr);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgHashWriter::HashObject(const FObjectProperty* ObjectProperty, const void* ValuePtr)
+{
+	const UObject* Object = ObjectProperty->GetObjectPropertyValue(ValuePtr);
+	if (Object == nullptr || !Object->IsValidLowLevelFast())
+	{
+		HashInt(0);
+		return;
+	}
+
+	// Only the path is exported
+	if (CanSaveAsReference(ObjectProperty, Object))
+	{
+		HashInt(1);
+		HashString(Object->GetPathName());
+		return;
+	}
+
+	HashInt(2);
+	HashName(Object->GetClass()->GetFName());
+	HashStruct(Object->GetClass(), Object);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgHashWriter::HashExportedText(const FProperty* Property, const void* ValuePtr)
+{
+	FString ValueString;
+#if NY_ENGINE_VERSION >= 501
+	Property->ExportTextItem_Direct(ValueString, ValuePtr, ValuePtr, nullptr, PPF_None);
+#else
+	Property->ExportTextItem(ValueString, ValuePtr, ValuePtr, nullptr, PPF_None);
+#endif
+
+	HashString(ValueString);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgHashWriter::HashBytes(const void* Data, int64 Size)
+{
+	Hash = CityHash64WithSeed(static_cast<const char*>(Data), static_cast<uint32>(Size), Hash);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgHashWriter::HashString(const FString& String)
+{
+	// The length first, so that the concatenation of two strings is different than the two strings
+	HashInt(String.Len());
+	HashBytes(*String, String.Len() * sizeof(TCHAR));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgHashWriter::HashName(FName Name)
+{
+	// The string because the FName indices are different in every session
+	uint64& NameHash = NameHashes.FindOrAdd(TPair<FNameEntryId, int32>(Name.GetDisplayIndex(), Name.GetNumber()));
+	if (NameHash == 0)
+	{
+		const FString NameString = Name.ToString();
+		NameHash = CityHash64(reinterpret_cast<const char*>(*NameString), NameString.Len() * sizeof(TCHAR));
+	}
+
+	HashInt(static_cast<int64>(NameHash));
+}
@@ -0,0 +1,53 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UnrealType.h"
+
+#include "IDlgWriter.h"
+
+/**
+ * Computes a 64 bit hash of the data the other writers would export, without building their output.
+ * Follows the same rules (skipped properties, references, structs with native ExportTextItem) so two objects have
+ * the same hash if they would be exported the same way. The hash does not depend on the session, it can be saved.
+ * See IDlgWriter for properties and METADATA specifiers.
+ */
+class DLGSYSTEM_API FDlgHashWriter : public IDlgWriter
+{
+public:
+	FDlgHashWriter(uint64 InSeed = 0) : Seed(InSeed) {}
+
+	// IDlgWriter Interface
+	void Write(const UStruct* StructDefinition, const void* Object) override;
+
+	// Saves the hash as hex string
+	bool ExportToFile(const FString& FileName) override;
+
+	// The hash as hex string
+	const FString& GetAsString() const override;
+
+	uint64 GetHash() const { return Hash; }
+
+private:
+	void HashStruct(const UStruct* StructDefinition, const void* ContainerPtr);
+	void HashValue(const FProperty* Property, const void* ValuePtr);
+	void HashObject(const FObjectProperty* ObjectProperty, const void* ValuePtr);
+	void HashExportedText(const FProperty* Property, const void* ValuePtr);
+
+	void HashBytes(const void* Data, int64 Size);
+	void HashInt(int64 Value) { HashBytes(&Value, sizeof(Value)); }
+	void HashString(const FString& String);
+	void HashName(FName Name);
+
+private:
+	uint64 Seed = 0;
+	uint64 Hash = 0;
+
+	// The hash of the string of each FName, FName::ToString allocates.
+	// NOTE: keyed by the display index and number, FName comparison ignores the case and names that only differ in case
+	// must have different hashes. The display index is case sensitive in the editor (WITH_CASE_PRESERVING_NAME).
+	TMap<TPair<FNameEntryId, int32>, uint64> NameHashes;
+
+	// Lazily built in GetAsString
+	mutable FString HashAsString;
+};
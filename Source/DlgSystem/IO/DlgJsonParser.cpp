@@ -12,12 +12,15 @@
 #include "UObject/PropertyPortFlags.h"
 #include "JsonObjectConverter.h"
 #include "JsonObjectWrapper.h"
+#include "Serialization/JsonSerializer.h"
 #include "Internationalization/CulturePointer.h"
 #include "Internationalization/Culture.h"
 #include "Misc/OutputDevice.h"
 #include "Misc/FeedbackContext.h"
 
 #include "DlgSystem/NYReflectionHelper.h"
+#include "DlgTextFileReader.h"
+#include "DlgSerializationPlan.h"
 
 
 DEFINE_LOG_CATEGORY(LogDlgJsonParser);
@@ -66,10 +69,33 @@ FString GetStringForJsonType(const EJson Type)
 	}
 }
 
+// Type of the JSON value that starts with this token
+EJson GetJsonTypeForNotation(const EJsonNotation Notation)
+{
+	switch (Notation)
+	{
+		case EJsonNotation::ObjectStart:
+			return EJson::Object;
+		case EJsonNotation::ArrayStart:
+			return EJson::Array;
+		case EJsonNotation::Boolean:
+			return EJson::Boolean;
+		case EJsonNotation::String:
+			return EJson::String;
+		case EJsonNotation::Number:
+			return EJson::Number;
+		case EJsonNotation::Null:
+			return EJson::Null;
+		default:
+			return EJson::None;
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 void FDlgJsonParser::InitializeParser(const FString& FilePath)
 {
-	if (FFileHelper::LoadFileToString(JsonString, *FilePath))
+	PreParsedJsonObject.Reset();
+	if (FDlgTextFileReader::LoadFileToString(JsonString, FilePath))
 	{
 		FileName = FPaths::GetBaseFilename(FilePath, true);
 		bIsValidFile = true;
@@ -89,6 +115,24 @@ void FDlgJsonParser::InitializeParserFromString(const FString& Text)
 	JsonString = Text;
 	bIsValidFile = true;
 	FileName = "";
+	PreParsedJsonObject.Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgJsonParser::PreParse()
+{
+	if (!IsValidFile() || PreParsedJsonObject.IsValid())
+	{
+		return;
+	}
+
+	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(JsonReader, PreParsedJsonObject) || !PreParsedJsonObject.IsValid())
+	{
+		UE_LOG(LogDlgJsonParser, Error, TEXT("PreParse - Unable to parse json=[%s]"), *JsonString);
+		PreParsedJsonObject.Reset();
+		bIsValidFile = false;
+	}
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -101,11 +145,23 @@ void FDlgJsonParser::ReadAllProperty( const UStruct* ReferenceClass, void* Targe
 
 	// TODO use DefaultObjectOuter;
 	DefaultObjectOuter = InDefaultObjectOuter;
-	bIsValidFile = JsonObjectStringToUStruct(ReferenceClass, TargetObject);
+	if (PreParsedJsonObject.IsValid())
+	{
+		bIsValidFile = JsonObjectToUStruct(PreParsedJsonObject.ToSharedRef(), ReferenceClass, TargetObject);
+		PreParsedJsonObject.Reset();
+	}
+	else if (bUseStreaming)
+	{
+		bIsValidFile = JsonStringToUStructStreaming(ReferenceClass, TargetObject);
+	}
+	else
+	{
+		bIsValidFile = JsonObjectStringToUStruct(ReferenceClass, TargetObject);
+	}
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValue>& JsonValue, FProperty* Property, void* ContainerPtr, void* ValuePtr)
+bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const FJsonValue& JsonValue, FProperty* Property, void* ContainerPtr, void* ValuePtr)
 {
 	check(Property);
 	if (bLogVerbose)
@@ -121,12 +177,12 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 	// Enum
 	if (auto* EnumProperty = FNYReflectionHelper::CastProperty<FEnumProperty>(Property))
 	{
-		if (JsonValue->Type == EJson::String)
+		if (JsonValue.Type == EJson::String)
 		{
 			// see if we were passed a string for the enum
 			const UEnum* Enum = EnumProperty->GetEnum();
 			check(Enum);
-			const FString StrValue = JsonValue->AsString();
+			const FString StrValue = JsonValue.AsString();
 			const int64 IntValue = Enum->GetValueByName(FName(*StrValue));
 			if (IntValue == INDEX_NONE)
 			{
@@ -142,7 +198,7 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 		{
 			// Numeric enum
 			// AsNumber will log an error for completely inappropriate types (then give us a default)
-			EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(ValuePtr, static_cast<int64>(JsonValue->AsNumber()));
+			EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(ValuePtr, static_cast<int64>(JsonValue.AsNumber()));
 		}
 
 		return true;
@@ -151,12 +207,12 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 	// Numeric, int, float, possible enum
 	if (auto* NumericProperty = FNYReflectionHelper::CastProperty<FNumericProperty>(Property))
 	{
-		if (NumericProperty->IsEnum() && JsonValue->Type == EJson::String)
+		if (NumericProperty->IsEnum() && JsonValue.Type == EJson::String)
 		{
 			// see if we were passed a string for the enum
 			const UEnum* Enum = NumericProperty->GetIntPropertyEnum();
 			check(Enum); // should be assured by IsEnum()
-			const FString StrValue = JsonValue->AsString();
+			const FString StrValue = JsonValue.AsString();
 			const int64 IntValue = Enum->GetValueByName(FName(*StrValue));
 			if (IntValue == INDEX_NONE)
 			{
@@ -172,21 +228,21 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 		}
 		else if (NumericProperty->IsInteger())
 		{
-			if (JsonValue->Type == EJson::String)
+			if (JsonValue.Type == EJson::String)
 			{
 				// parse string -> int64 ourselves so we don't lose any precision going through AsNumber (aka double)
-				NumericProperty->SetIntPropertyValue(ValuePtr, FCString::Atoi64(*JsonValue->AsString()));
+				NumericProperty->SetIntPropertyValue(ValuePtr, FCString::Atoi64(*JsonValue.AsString()));
 			}
 			else
 			{
 				// AsNumber will log an error for completely inappropriate types (then give us a default)
-				NumericProperty->SetIntPropertyValue(ValuePtr, static_cast<int64>(JsonValue->AsNumber()));
+				NumericProperty->SetIntPropertyValue(ValuePtr, static_cast<int64>(JsonValue.AsNumber()));
 			}
 		}
 		else if (NumericProperty->IsFloatingPoint())
 		{
 			// AsNumber will log an error for completely inappropriate types (then give us a default)
-			NumericProperty->SetFloatingPointPropertyValue(ValuePtr, JsonValue->AsNumber());
+			NumericProperty->SetFloatingPointPropertyValue(ValuePtr, JsonValue.AsNumber());
 		}
 		else
 		{
@@ -206,7 +262,7 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 	if (auto* BoolProperty = FNYReflectionHelper::CastProperty<FBoolProperty>(Property))
 	{
 		// AsBool will log an error for completely inappropriate types (then give us a default)
-		BoolProperty->SetPropertyValue(ValuePtr, JsonValue->AsBool());
+		BoolProperty->SetPropertyValue(ValuePtr, JsonValue.AsBool());
 		return true;
 	}
 
@@ -214,7 +270,7 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 	if (auto* StringProperty = FNYReflectionHelper::CastProperty<FStrProperty>(Property))
 	{
 		// Seems unsafe: AsString will log an error for completely inappropriate types (then give us a default)
-		FString String = JsonValue->AsString();
+		FString String = JsonValue.AsString();
 		StringProperty->SetPropertyValue(ValuePtr, String);
 		return true;
 	}
@@ -223,7 +279,7 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 	if (auto* NameProperty = FNYReflectionHelper::CastProperty<FNameProperty>(Property))
 	{
 		FString String;
-		const FName StringFName = FName(*JsonValue->AsString());
+		const FName StringFName = FName(*JsonValue.AsString());
 		NameProperty->SetPropertyValue(ValuePtr, StringFName);
 		return true;
 	}
@@ -231,15 +287,15 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 	// FText
 	if (auto* TextProperty = FNYReflectionHelper::CastProperty<FTextProperty>(Property))
 	{
-		if (JsonValue->Type == EJson::String)
+		if (JsonValue.Type == EJson::String)
 		{
 			// assume this string is already localized, so import as invariant
-			const FString String = JsonValue->AsString();
+			const FString String = JsonValue.AsString();
 			TextProperty->SetPropertyValue(ValuePtr, FText::FromString(String));
 		}
-		else if (JsonValue->Type == EJson::Object)
+		else if (JsonValue.Type == EJson::Object)
 		{
-			const TSharedPtr<FJsonObject> Obj = JsonValue->AsObject();
+			const TSharedPtr<FJsonObject> Obj = JsonValue.AsObject();
 			check(Obj.IsValid()); // should not fail if Type == EJson::Object
 
 			// import the subvalue as a culture invariant string
@@ -273,9 +329,9 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 	// TArray
 	if (auto* ArrayProperty = FNYReflectionHelper::CastProperty<FArrayProperty>(Property))
 	{
-		if (JsonValue->Type == EJson::Array)
+		if (JsonValue.Type == EJson::Array)
 		{
-			const TArray<TSharedPtr<FJsonValue>> ArrayValue = JsonValue->AsArray();
+			const TArray<TSharedPtr<FJsonValue>> ArrayValue = JsonValue.AsArray();
 			const int32 ArrayNum = ArrayValue.Num();
 
 			// make the output array size match
@@ -316,9 +372,9 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 	// Set
 	if (auto* SetProperty = FNYReflectionHelper::CastProperty<FSetProperty>(Property))
 	{
-		if (JsonValue->Type == EJson::Array)
+		if (JsonValue.Type == EJson::Array)
 		{
-			const TArray<TSharedPtr<FJsonValue>> ArrayValue = JsonValue->AsArray();
+			const TArray<TSharedPtr<FJsonValue>> ArrayValue = JsonValue.AsArray();
 			const int32 ArrayNum = ArrayValue.Num();
 
 			FScriptSetHelper Helper(SetProperty, ValuePtr);
@@ -354,7 +410,7 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 			LogDlgJsonParser,
 			Error,
 			TEXT("ConvertScalarJsonValueToProperty - Attempted to import TSet from non-array (JsonValue->Type = `%s`) JSON key for property %s"),
-			*GetStringForJsonType(JsonValue->Type), *Property->GetNameCPP()
+			*GetStringForJsonType(JsonValue.Type), *Property->GetNameCPP()
 		);
 		return false;
 	}
@@ -362,9 +418,9 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 	// TMap
 	if (auto* MapProperty = FNYReflectionHelper::CastProperty<FMapProperty>(Property))
 	{
-		if (JsonValue->Type == EJson::Object)
+		if (JsonValue.Type == EJson::Object)
 		{
-			const TSharedPtr<FJsonObject> ObjectValue = JsonValue->AsObject();
+			const TSharedPtr<FJsonObject> ObjectValue = JsonValue.AsObject();
 			FScriptMapHelper Helper(MapProperty, ValuePtr);
 			Helper.EmptyValues();
 
@@ -418,9 +474,9 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 		static const FName NAME_JSON_LinearColor(TEXT("LinearColor"));
 
 		// Default struct export
-		if (JsonValue->Type == EJson::Object)
+		if (JsonValue.Type == EJson::Object)
 		{
-			const TSharedPtr<FJsonObject> Obj = JsonValue->AsObject();
+			const TSharedPtr<FJsonObject> Obj = JsonValue.AsObject();
 			check(Obj.IsValid()); // should not fail if Type == EJson::Object
 			if (!JsonObjectToUStruct(Obj.ToSharedRef(), StructProperty->Struct, ValuePtr))
 			{
@@ -435,22 +491,22 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 		}
 
 		// Handle some structs that are exported to string in a special way
-		else if (JsonValue->Type == EJson::String && StructProperty->Struct->GetFName() == NAME_JSON_LinearColor)
+		else if (JsonValue.Type == EJson::String && StructProperty->Struct->GetFName() == NAME_JSON_LinearColor)
 		{
-			const FString ColorString = JsonValue->AsString();
+			const FString ColorString = JsonValue.AsString();
 			const FColor IntermediateColor = FColor::FromHex(ColorString);
 			FLinearColor& ColorOut = *static_cast<FLinearColor*>(ValuePtr);
 			ColorOut = IntermediateColor;
 		}
-		else if (JsonValue->Type == EJson::String && StructProperty->Struct->GetFName() == NAME_JSON_Color)
+		else if (JsonValue.Type == EJson::String && StructProperty->Struct->GetFName() == NAME_JSON_Color)
 		{
-			const FString ColorString = JsonValue->AsString();
+			const FString ColorString = JsonValue.AsString();
 			FColor& ColorOut = *static_cast<FColor*>(ValuePtr);
 			ColorOut = FColor::FromHex(ColorString);
 		}
-		else if (JsonValue->Type == EJson::String && StructProperty->Struct->GetFName() == NAME_JSON_DateTime)
+		else if (JsonValue.Type == EJson::String && StructProperty->Struct->GetFName() == NAME_JSON_DateTime)
 		{
-			const FString DateString = JsonValue->AsString();
+			const FString DateString = JsonValue.AsString();
 			FDateTime& DateTimeOut = *static_cast<FDateTime*>(ValuePtr);
 			if (DateString == TEXT("min"))
 			{
@@ -486,14 +542,14 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 				return false;
 			}
 		}
-		else if (JsonValue->Type == EJson::String &&
+		else if (JsonValue.Type == EJson::String &&
 				 StructProperty->Struct->GetCppStructOps() &&
 				 StructProperty->Struct->GetCppStructOps()->HasImportTextItem())
 		{
 			// Import as simple native string
 			UScriptStruct::ICppStructOps* TheCppStructOps = StructProperty->Struct->GetCppStructOps();
 
-			const FString ImportTextString = JsonValue->AsString();
+			const FString ImportTextString = JsonValue.AsString();
 			const TCHAR* ImportTextPtr = *ImportTextString;
 			if (!TheCppStructOps->ImportTextItem(ImportTextPtr, ValuePtr, PPF_None, nullptr, static_cast<FOutputDevice*>(GWarn)))
 			{
@@ -506,11 +562,11 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 
 			}
 		}
-		else if (JsonValue->Type == EJson::String)
+		else if (JsonValue.Type == EJson::String)
 		{
 			// Import as simple string
 			// UTextBuffer* ImportErrors = NewObject<UTextBuffer>();
-			const FString ImportTextString = JsonValue->AsString();
+			const FString ImportTextString = JsonValue.AsString();
 			const TCHAR* ImportTextPtr = *ImportTextString;
 #if NY_ENGINE_VERSION >= 501
 			Property->ImportText_Direct(ImportTextPtr, ValuePtr, nullptr, PPF_None);
@@ -558,7 +614,7 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 		}
 
 		// Nothing else to do
-		if (JsonValue->IsNull())
+		if (JsonValue.IsNull())
 		{
 			return true;
 		}
@@ -566,9 +622,9 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 
 		// Special case, load by reference, See CanSaveAsReference
 		// Handle some objects that are exported to string in a special way. Similar to the UStruct above.
-		if (JsonValue->Type == EJson::String)
+		if (JsonValue.Type == EJson::String)
 		{
-			const FString Path = JsonValue->AsString();
+			const FString Path = JsonValue.AsString();
 			if (!Path.TrimStartAndEnd().IsEmpty()) // null reference?
 			{
 				*ObjectPtrPtr = StaticLoadObject(UObject::StaticClass(), DefaultObjectOuter, *Path);
@@ -578,8 +634,8 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 
 		// Load the Normal JSON object
 		// Must have the type inside the Json Object
-		check(JsonValue->Type == EJson::Object);
-		const TSharedPtr<FJsonObject> JsonObject = JsonValue->AsObject();
+		check(JsonValue.Type == EJson::Object);
+		const TSharedPtr<FJsonObject> JsonObject = JsonValue.AsObject();
 		check(JsonObject.IsValid()); // should not fail if Type == EJson::Object
 
 		const FString SpecialKeyType = TEXT("__type__");
@@ -608,28 +664,8 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 			return false;
 		}
 
-		const UClass* ChildClass = GetChildClassFromName(ObjectClass, JsonObjectType);
-		if (ChildClass == nullptr)
+		if (!CreateUObjectFromType(ObjectProperty, JsonObjectType, ObjectPtrPtr))
 		{
-			UE_LOG(
-				LogDlgJsonParser,
-				Error,
-				TEXT("ConvertScalarJsonValueToProperty - Trying to load by string reference. Could not find class `%s` for FObjectProperty = `%s`. Ignored."),
-				*JsonObjectType, *Property->GetNameCPP()
-			);
-			return false;
-		}
-		*ObjectPtrPtr = CreateNewUObject(ChildClass, DefaultObjectOuter);
-
-		// Something is wrong
-		if (*ObjectPtrPtr == nullptr || !(*ObjectPtrPtr)->IsValidLowLevelFast())
-		{
-			UE_LOG(
-				LogDlgJsonParser,
-				Error,
-				TEXT("JsonValueToProperty - PropertyName = `%s` Is a FObjectProperty but could not build any valid UObject"),
-				*Property->GetNameCPP()
-			);
 			return false;
 		}
 
@@ -649,8 +685,8 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 	}
 
 	// Default to expect a string for everything else
-	check(JsonValue->Type != EJson::Object);
-	const FString Buffer = JsonValue->AsString();
+	check(JsonValue.Type != EJson::Object);
+	const FString Buffer = JsonValue.AsString();
 
 #if NY_ENGINE_VERSION >= 501
 	if (Property->ImportText_Direct(*Buffer, ValuePtr, nullptr, PPF_None) == nullptr)
@@ -669,6 +705,37 @@ bool FDlgJsonParser::ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValu
 	return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgJsonParser::CreateUObjectFromType(const FObjectProperty* ObjectProperty, const FString& JsonObjectType, UObject** ObjectPtrPtr)
+{
+	const UClass* ChildClass = GetChildClassFromName(ObjectProperty->PropertyClass, JsonObjectType);
+	if (ChildClass == nullptr)
+	{
+		UE_LOG(
+			LogDlgJsonParser,
+			Error,
+			TEXT("ConvertScalarJsonValueToProperty - Trying to load by string reference. Could not find class `%s` for FObjectProperty = `%s`. Ignored."),
+			*JsonObjectType, *ObjectProperty->GetNameCPP()
+		);
+		return false;
+	}
+	*ObjectPtrPtr = CreateNewUObject(ChildClass, DefaultObjectOuter);
+
+	// Something is wrong
+	if (*ObjectPtrPtr == nullptr || !(*ObjectPtrPtr)->IsValidLowLevelFast())
+	{
+		UE_LOG(
+			LogDlgJsonParser,
+			Error,
+			TEXT("JsonValueToProperty - PropertyName = `%s` Is a FObjectProperty but could not build any valid UObject"),
+			*ObjectProperty->GetNameCPP()
+		);
+		return false;
+	}
+
+	return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 bool FDlgJsonParser::JsonValueToProperty(const TSharedPtr<FJsonValue>& JsonValue, FProperty* Property, void* ContainerPtr, void* ValuePtr)
 {
@@ -716,14 +783,14 @@ bool FDlgJsonParser::JsonValueToProperty(const TSharedPtr<FJsonValue>& JsonValue
 			UE_LOG(LogDlgJsonParser, Warning, TEXT("[Property->ArrayDim != 1] Ignoring excess properties when deserializing %s"), *Property->GetNameCPP());
 		}
 
-		return ConvertScalarJsonValueToProperty(JsonValue, Property, ContainerPtr, ValuePtr);
+		return ConvertScalarJsonValueToProperty(*JsonValue, Property, ContainerPtr, ValuePtr);
 	}
 
 	// In practice, the ArrayDim == 1 check ought to be redundant, since nested arrays of UPropertys are not supported
 	if ((bArrayProperty || bSetProperty) && Property->ArrayDim == 1)
 	{
 		// Read into TArray/TSet
-		return ConvertScalarJsonValueToProperty(JsonValue, Property, ContainerPtr, ValuePtr);
+		return ConvertScalarJsonValueToProperty(*JsonValue, Property, ContainerPtr, ValuePtr);
 	}
 
 	// Array
@@ -747,7 +814,7 @@ bool FDlgJsonParser::JsonValueToProperty(const TSharedPtr<FJsonValue>& JsonValue
 		const int32 ElementSize = Property->ElementSize;
 #endif
 
-		bReturnStatus &= ConvertScalarJsonValueToProperty(ArrayValue[Index], Property, ContainerPtr, ValueIntPtr + Index * ElementSize);
+		bReturnStatus &= ConvertScalarJsonValueToProperty(*ArrayValue[Index], Property, ContainerPtr, ValueIntPtr + Index * ElementSize);
 	}
 	return bReturnStatus;
 }
@@ -802,41 +869,28 @@ bool FDlgJsonParser::JsonAttributesToUStruct(const FNYJsonAttributes& JsonAttrib
 	}
 
 	// iterate over the struct properties
-	for (TFieldIterator<FProperty> PropIt(StructDefinition); PropIt; ++PropIt)
+	const FNYJsonAttributesLookup JsonLookup(JsonAttributes);
+	const FDlgSerializationPlanRef Plan = FDlgSerializationPlanCache::Get().FindOrBuild(StructDefinition);
+	for (const FDlgSerializationPlanProperty& Entry : Plan->GetProperties())
 	{
-		auto* Property = *PropIt;
-		if (!ensure(Property))
-			continue;
-
-		const FString PropertyName = Property->GetName();
-
-		// Check to see if we should ignore this property
-		if (CheckFlags != 0 && !Property->HasAnyPropertyFlags(CheckFlags))
+		FProperty* Property = Entry.Property;
+		if (!CanReadProperty(Property))
 		{
 			continue;
 		}
-		// TODO skip property
 
 		// Find a JSON value matching this property name
-		TSharedPtr<FJsonValue> JsonValue;
-		for (auto& Elem : JsonAttributes)
-		{
-			// use case insensitive search since FName may change case strangely on us
-			// TODO does this break on struct/classes with properties of similar name?
-			if (PropertyName.Equals(FNYJsonObjectKeyToString(Elem.Key), ESearchCase::IgnoreCase))
-			{
-				JsonValue = Elem.Value;
-				break;
-			}
-		}
-		if (!JsonValue.IsValid())
+		// use case insensitive search since FName may change case strangely on us
+		// TODO does this break on struct/classes with properties of similar name?
+		const TSharedPtr<FJsonValue>* FoundJsonValue = JsonLookup.Find(Entry.NameString);
+		if (FoundJsonValue == nullptr || !FoundJsonValue->IsValid())
 		{
 			// we allow values to not be found since this mirrors the typical UObject mantra that all the fields are optional when deserializing
 			continue;
 		}
 
 		void* ValuePtr = nullptr;
-		if (Property->IsA<FObjectProperty>())
+		if (Entry.Kind == EDlgPropertyKind::Object)
 		{
 			// Handle pointers, only allowed to be UObjects (are already pointers to the Value)
 			ValuePtr = ContainerPtr;
@@ -848,13 +902,13 @@ bool FDlgJsonParser::JsonAttributesToUStruct(const FNYJsonAttributes& JsonAttrib
 		}
 
 		// Convert the JsonValue to the Property
-		if (!JsonValueToProperty(JsonValue, Property, ContainerPtr, ValuePtr))
+		if (!JsonValueToProperty(*FoundJsonValue, Property, ContainerPtr, ValuePtr))
 		{
 			UE_LOG(
 				LogDlgJsonParser,
 				Error,
 				TEXT("JsonObjectToUStruct - Unable to parse %s.%s from JSON"),
-				*StructDefinition->GetName(), *PropertyName
+				*StructDefinition->GetName(), *Entry.NameString
 			);
 			continue;
 		}
@@ -880,3 +934,656 @@ bool FDlgJsonParser::JsonObjectStringToUStruct(const UStruct* StructDefinition,
 	}
 	return true;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgJsonParser::JsonStringToUStructStreaming(const UStruct* StructDefinition, void* ContainerPtr)
+{
+	bStreamingError = false;
+
+	// Read directly from our string, no copy
+#if NY_ENGINE_VERSION >= 500
+	TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::CreateFromView(JsonString);
+#else
+	TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(JsonString);
+#endif
+
+	EJsonNotation Notation;
+	if (!ReadNextToken(*JsonReader, Notation))
+	{
+		return false;
+	}
+	if (Notation != EJsonNotation::ObjectStart)
+	{
+		UE_LOG(LogDlgJsonParser, Error, TEXT("JsonStringToUStructStreaming - Unable to parse json, FileName = `%s`. The root is not a JSON object"), *FileName);
+		return false;
+	}
+
+	if (!ReadStructFromReader(*JsonReader, StructDefinition, ContainerPtr) || bStreamingError)
+	{
+		UE_LOG(LogDlgJsonParser, Error, TEXT("JsonStringToUStructStreaming - Unable to deserialize, FileName = `%s`"), *FileName);
+		return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgJsonParser::ReadStructFromReader(TJsonReader<TCHAR>& Reader, const UStruct* StructDefinition, void* ContainerPtr)
+{
+	check(StructDefinition);
+	check(ContainerPtr);
+	if (bLogVerbose)
+	{
+		UE_LOG(LogDlgJsonParser, Verbose, TEXT("ReadStructFromReader, StructDefinition = `%s`"), *StructDefinition->GetPathName());
+	}
+
+	// Json Wrapper, needs the Object
+	if (StructDefinition == FJsonObjectWrapper::StaticStruct())
+	{
+		TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+		if (!ReadJsonObjectFieldsFromReader(Reader, *JsonObject))
+		{
+			return false;
+		}
+
+		FJsonObjectWrapper* ProxyObject = (FJsonObjectWrapper *)ContainerPtr;
+		ProxyObject->JsonObject = JsonObject;
+		return true;
+	}
+
+	// Handle UObject inheritance (children of class)
+	if (StructDefinition->IsA<UClass>())
+	{
+		// Structure points to the child
+		const UObject* UnrealObject = static_cast<const UObject*>(ContainerPtr);
+		if (!UnrealObject->IsValidLowLevelFast())
+		{
+			UE_LOG(
+				LogDlgJsonParser,
+				Error,
+				TEXT("ReadStructFromReader: StructDefinition = `%s` is a UClass and expected ContainerPtr to be an UObject. Memory corruption?"),
+				*StructDefinition->GetPathName()
+			);
+			Reader.SkipObject();
+			return false;
+		}
+		StructDefinition = UnrealObject->GetClass();
+	}
+	if (!StructDefinition->IsValidLowLevelFast())
+	{
+		UE_LOG(
+			LogDlgJsonParser,
+			Error,
+			TEXT("ReadStructFromReader: StructDefinition = `%s` is a UClass and expected ContainerPtr.Class to be valid. Memory corruption?"),
+			*StructDefinition->GetPathName()
+		);
+		Reader.SkipObject();
+		return false;
+	}
+
+	const FDlgSerializationPlanRef Plan = FDlgSerializationPlanCache::Get().FindOrBuild(StructDefinition);
+	EJsonNotation Notation;
+	while (ReadNextToken(Reader, Notation))
+	{
+		if (Notation == EJsonNotation::ObjectEnd)
+		{
+			return true;
+		}
+
+		// we allow values to not be found since this mirrors the typical UObject mantra that all the fields are optional when deserializing
+		// Property names are always in the name table, FName comparison is case insensitive like the attributes lookup
+		// FName asserts on names that are too long, those can't be properties anyway, same as FDlgConfigParser::GetActiveWordAsName
+		const FString& Identifier = Reader.GetIdentifier();
+		const FName PropertyName = Identifier.Len() < NAME_SIZE ? FName(*Identifier, FNAME_Find) : NAME_None;
+		const FDlgSerializationPlanProperty* FoundEntry = PropertyName.IsNone() ? nullptr : Plan->FindProperty(PropertyName);
+		if (FoundEntry == nullptr || !CanReadProperty(FoundEntry->Property))
+		{
+			if (!SkipValueFromReader(Reader, Notation))
+			{
+				return false;
+			}
+			continue;
+		}
+
+		const FDlgSerializationPlanProperty& Entry = *FoundEntry;
+		void* ValuePtr = nullptr;
+		if (Entry.Kind == EDlgPropertyKind::Object)
+		{
+			// Handle pointers, only allowed to be UObjects (are already pointers to the Value)
+			ValuePtr = ContainerPtr;
+		}
+		else
+		{
+			// Normal non pointer property
+			ValuePtr = Entry.Property->ContainerPtrToValuePtr<void>(ContainerPtr, 0);
+		}
+
+		if (!ReadValueToPropertyFromReader(Reader, Notation, Entry.Property, ContainerPtr, ValuePtr))
+		{
+			UE_LOG(
+				LogDlgJsonParser,
+				Error,
+				TEXT("JsonObjectToUStruct - Unable to parse %s.%s from JSON"),
+				*StructDefinition->GetName(), *Entry.NameString
+			);
+			if (bStreamingError)
+			{
+				return false;
+			}
+		}
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgJsonParser::ReadValueToPropertyFromReader(TJsonReader<TCHAR>& Reader, EJsonNotation Notation, FProperty* Property, void* ContainerPtr, void* ValuePtr)
+{
+	check(Property);
+	if (bLogVerbose)
+	{
+		UE_LOG(LogDlgJsonParser, Verbose, TEXT("ReadValueToPropertyFromReader, Property = `%s`"), *Property->GetPathName());
+	}
+
+	const bool bArrayProperty = Property->IsA<FArrayProperty>();
+	const bool bSetProperty = Property->IsA<FSetProperty>();
+
+	// Scalar only one property
+	if (Notation != EJsonNotation::ArrayStart)
+	{
+		if (bArrayProperty)
+		{
+			UE_LOG(
+				LogDlgJsonParser,
+				Error,
+				TEXT("JsonValueToProperty - Attempted to import TArray from non-array JSON type = `%s`"),
+				*GetStringForJsonType(GetJsonTypeForNotation(Notation))
+			);
+			SkipValueFromReader(Reader, Notation);
+			return false;
+		}
+		if (bSetProperty)
+		{
+			UE_LOG(
+				LogDlgJsonParser,
+				Error,
+				TEXT("JsonValueToProperty - Attempted to import TSet from non-array JSON type = `%s`"),
+				*GetStringForJsonType(GetJsonTypeForNotation(Notation))
+			);
+			SkipValueFromReader(Reader, Notation);
+			return false;
+		}
+
+		if (Property->ArrayDim != 1)
+		{
+			UE_LOG(LogDlgJsonParser, Warning, TEXT("[Property->ArrayDim != 1] Ignoring excess properties when deserializing %s"), *Property->GetNameCPP());
+		}
+
+		return ReadScalarToPropertyFromReader(Reader, Notation, Property, ContainerPtr, ValuePtr);
+	}
+
+	// In practice, the ArrayDim == 1 check ought to be redundant, since nested arrays of UPropertys are not supported
+	if ((bArrayProperty || bSetProperty) && Property->ArrayDim == 1)
+	{
+		// Read into TArray/TSet
+		return ReadScalarToPropertyFromReader(Reader, Notation, Property, ContainerPtr, ValuePtr);
+	}
+
+	// Static array, read each element
+#if NY_ENGINE_VERSION >= 505
+	const int32 ElementSize = Property->GetElementSize();
+#else
+	const int32 ElementSize = Property->ElementSize;
+#endif
+	auto* ValueIntPtr = static_cast<uint8*>(ValuePtr);
+	bool bReturnStatus = true;
+	bool bWarnedExcess = false;
+	int32 Index = 0;
+	EJsonNotation ElementNotation;
+	while (ReadNextToken(Reader, ElementNotation))
+	{
+		if (ElementNotation == EJsonNotation::ArrayEnd)
+		{
+			return bReturnStatus;
+		}
+
+		if (Index < Property->ArrayDim)
+		{
+			bReturnStatus &= ReadScalarToPropertyFromReader(Reader, ElementNotation, Property, ContainerPtr, ValueIntPtr + Index * ElementSize);
+		}
+		else
+		{
+			if (!bWarnedExcess)
+			{
+				UE_LOG(LogDlgJsonParser, Warning, TEXT("[Property->ArrayDim < ArrayValue.Num()] Ignoring excess properties when deserializing %s"), *Property->GetNameCPP());
+				bWarnedExcess = true;
+			}
+			SkipValueFromReader(Reader, ElementNotation);
+		}
+		if (bStreamingError)
+		{
+			return false;
+		}
+		Index++;
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgJsonParser::ReadScalarToPropertyFromReader(TJsonReader<TCHAR>& Reader, EJsonNotation Notation, FProperty* Property, void* ContainerPtr, void* ValuePtr)
+{
+	check(Property);
+	if (ValuePtr == nullptr)
+	{
+		// Nothing else to do
+		return SkipValueFromReader(Reader, Notation);
+	}
+
+	// Simple values, these do not allocate a JSON value on the heap
+	switch (Notation)
+	{
+		case EJsonNotation::String:
+		{
+			const FJsonValueString JsonValue(Reader.GetValueAsString());
+			return ConvertScalarJsonValueToProperty(JsonValue, Property, ContainerPtr, ValuePtr);
+		}
+		case EJsonNotation::Number:
+		{
+			// Same value type as FJsonSerializer creates
+#if NY_ENGINE_VERSION >= 500
+			const FJsonValueNumberString JsonValue(Reader.GetValueAsNumberString());
+#else
+			const FJsonValueNumber JsonValue(Reader.GetValueAsNumber());
+#endif
+			return ConvertScalarJsonValueToProperty(JsonValue, Property, ContainerPtr, ValuePtr);
+		}
+		case EJsonNotation::Boolean:
+		{
+			const FJsonValueBoolean JsonValue(Reader.GetValueAsBoolean());
+			return ConvertScalarJsonValueToProperty(JsonValue, Property, ContainerPtr, ValuePtr);
+		}
+		case EJsonNotation::Null:
+		{
+			const FJsonValueNull JsonValue;
+			return ConvertScalarJsonValueToProperty(JsonValue, Property, ContainerPtr, ValuePtr);
+		}
+
+		case EJsonNotation::ArrayStart:
+			if (auto* ArrayProperty = FNYReflectionHelper::CastProperty<FArrayProperty>(Property))
+			{
+				return ReadArrayFromReader(Reader, ArrayProperty, ContainerPtr, ValuePtr);
+			}
+			if (auto* SetProperty = FNYReflectionHelper::CastProperty<FSetProperty>(Property))
+			{
+				return ReadSetFromReader(Reader, SetProperty, ContainerPtr, ValuePtr);
+			}
+			break;
+
+		case EJsonNotation::ObjectStart:
+			if (auto* MapProperty = FNYReflectionHelper::CastProperty<FMapProperty>(Property))
+			{
+				return ReadMapFromReader(Reader, MapProperty, ContainerPtr, ValuePtr);
+			}
+			if (auto* StructProperty = FNYReflectionHelper::CastProperty<FStructProperty>(Property))
+			{
+				if (!ReadStructFromReader(Reader, StructProperty->Struct, ValuePtr))
+				{
+					UE_LOG(
+						LogDlgJsonParser,
+						Error,
+						TEXT("ConvertScalarJsonValueToProperty - JsonObjectToUStruct failed for property %s"),
+						*Property->GetNameCPP()
+					);
+					return false;
+				}
+				return true;
+			}
+			if (auto* ObjectProperty = FNYReflectionHelper::CastProperty<FObjectProperty>(Property))
+			{
+				return ReadUObjectFromReader(Reader, ObjectProperty, ContainerPtr, ValuePtr);
+			}
+			break;
+
+		default:
+			break;
+	}
+
+	// Everything else (FText from a culture object, unexpected JSON types) uses the JSON DOM, same as the non streaming path
+	const TSharedPtr<FJsonValue> JsonValue = ReadJsonValueFromReader(Reader, Notation);
+	if (!JsonValue.IsValid())
+	{
+		return false;
+	}
+	return ConvertScalarJsonValueToProperty(*JsonValue, Property, ContainerPtr, ValuePtr);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgJsonParser::ReadArrayFromReader(TJsonReader<TCHAR>& Reader, FArrayProperty* ArrayProperty, void* ContainerPtr, void* ValuePtr)
+{
+	FScriptArrayHelper Helper(ArrayProperty, ValuePtr);
+	Helper.EmptyValues();
+
+	bool bReturnStatus = true;
+	EJsonNotation Notation;
+	while (ReadNextToken(Reader, Notation))
+	{
+		if (Notation == EJsonNotation::ArrayEnd)
+		{
+			return bReturnStatus;
+		}
+
+		const int32 Index = Helper.AddValue();
+		if (!ReadValueToPropertyFromReader(Reader, Notation, ArrayProperty->Inner, ContainerPtr, Helper.GetRawPtr(Index)))
+		{
+			bReturnStatus = false;
+			UE_LOG(
+				LogDlgJsonParser,
+				Error,
+				TEXT("ConvertScalarJsonValueToProperty - Unable to deserialize array element [%d] for property %s"),
+				Index, *ArrayProperty->GetNameCPP()
+			);
+			if (bStreamingError)
+			{
+				return false;
+			}
+		}
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgJsonParser::ReadSetFromReader(TJsonReader<TCHAR>& Reader, FSetProperty* SetProperty, void* ContainerPtr, void* ValuePtr)
+{
+	FScriptSetHelper Helper(SetProperty, ValuePtr);
+	Helper.EmptyElements();
+
+	bool bReturnStatus = true;
+	int32 Index = 0;
+	EJsonNotation Notation;
+	while (true)
+	{
+		if (!ReadNextToken(Reader, Notation))
+		{
+			bReturnStatus = false;
+			break;
+		}
+		if (Notation == EJsonNotation::ArrayEnd)
+		{
+			break;
+		}
+
+		const int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
+		if (!ReadValueToPropertyFromReader(Reader, Notation, SetProperty->ElementProp, ContainerPtr, Helper.GetElementPtr(NewIndex)))
+		{
+			bReturnStatus = false;
+			UE_LOG(
+				LogDlgJsonParser,
+				Error,
+				TEXT("ConvertScalarJsonValueToProperty - Unable to deserialize set element [%d] for property %s"),
+				Index,
+				*SetProperty->GetNameCPP()
+			);
+			if (bStreamingError)
+			{
+				break;
+			}
+		}
+		Index++;
+	}
+
+	// Always leave the set in a valid state
+	Helper.Rehash();
+	return bReturnStatus;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgJsonParser::ReadMapFromReader(TJsonReader<TCHAR>& Reader, FMapProperty* MapProperty, void* ContainerPtr, void* ValuePtr)
+{
+	FScriptMapHelper Helper(MapProperty, ValuePtr);
+	Helper.EmptyValues();
+
+	bool bReturnStatus = true;
+	EJsonNotation Notation;
+	while (true)
+	{
+		if (!ReadNextToken(Reader, Notation))
+		{
+			bReturnStatus = false;
+			break;
+		}
+		if (Notation == EJsonNotation::ObjectEnd)
+		{
+			break;
+		}
+
+		const int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
+
+		// NOTE if key is a FStructProperty no need to Import the text item here as it will do that below in UStruct
+		// Add key, copied because reading the value changes the identifier
+		const FJsonValueString KeyAsString(Reader.GetIdentifier());
+		const bool bKeySuccess = ConvertScalarJsonValueToProperty(KeyAsString, Helper.GetKeyProperty(), ContainerPtr, Helper.GetKeyPtr(NewIndex));
+
+		// Add value
+		const bool bValueSuccess = ReadValueToPropertyFromReader(Reader, Notation, Helper.GetValueProperty(), ContainerPtr, Helper.GetValuePtr(NewIndex));
+
+		if (!bKeySuccess || !bValueSuccess)
+		{
+			Helper.RemoveAt(NewIndex);
+			bReturnStatus = false;
+			UE_LOG(
+				LogDlgJsonParser,
+				Error,
+				TEXT("ConvertScalarJsonValueToProperty - Unable to deserialize map element [key: %s] for property %s"),
+				*KeyAsString.AsString(), *MapProperty->GetNameCPP()
+			);
+			if (bStreamingError)
+			{
+				break;
+			}
+		}
+	}
+
+	// Always leave the map in a valid state
+	Helper.Rehash();
+	return bReturnStatus;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgJsonParser::ReadUObjectFromReader(TJsonReader<TCHAR>& Reader, FObjectProperty* ObjectProperty, void* ContainerPtr, void* ValuePtr)
+{
+	// NOTE: The Value here should be a pointer to a pointer
+	// Because the UObjects are pointers, we must deference it. So instead of it being a void** we want it to be a void*
+	auto* ObjectPtrPtr = static_cast<UObject**>(ObjectProperty->ContainerPtrToValuePtr<void>(ValuePtr, 0));
+	if (ObjectPtrPtr == nullptr)
+	{
+		UE_LOG(
+			LogDlgJsonParser,
+			Error,
+			TEXT("PropertyName = `%s` Is a FObjectProperty but can't get non null ContainerPtrToValuePtr from it's StructObject"),
+			*ObjectProperty->GetNameCPP()
+		);
+		Reader.SkipObject();
+		return false;
+	}
+
+	// NOTE: We must check one level up to check if it is a nullptr or not
+	// Reset first, if non nullptr
+	const UObject* ContainerObjectPtr = ObjectProperty->GetObjectPropertyValue_InContainer(ContainerPtr);
+	if (ContainerObjectPtr != nullptr)
+	{
+		*ObjectPtrPtr = nullptr;
+	}
+
+	// The FDlgJsonWriter always writes the __type__ first, we can create the object and stream the rest of the fields into it
+	static const FString SpecialKeyType = TEXT("__type__");
+	EJsonNotation Notation;
+	if (!ReadNextToken(Reader, Notation))
+	{
+		return false;
+	}
+	if (Notation == EJsonNotation::String && Reader.GetIdentifier() == SpecialKeyType)
+	{
+		if (!CreateUObjectFromType(ObjectProperty, Reader.GetValueAsString(), ObjectPtrPtr))
+		{
+			Reader.SkipObject();
+			return false;
+		}
+
+		// Write the rest of the json object
+		if (!ReadStructFromReader(Reader, ObjectProperty->PropertyClass, *ObjectPtrPtr))
+		{
+			UE_LOG(
+				LogDlgJsonParser,
+				Error,
+				TEXT("JsonValueToProperty - JsonObjectToUStruct failed for property %s"),
+				*ObjectProperty->GetNameCPP()
+			);
+			return false;
+		}
+
+		return true;
+	}
+
+	// Not written by us, build the whole object so that __type__ can be anywhere
+	TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	if (Notation != EJsonNotation::ObjectEnd)
+	{
+		const FString FirstIdentifier = Reader.GetIdentifier();
+		const TSharedPtr<FJsonValue> FirstValue = ReadJsonValueFromReader(Reader, Notation);
+		if (!FirstValue.IsValid())
+		{
+			return false;
+		}
+		JsonObject->Values.Add(FNYMakeJsonObjectKey(FirstIdentifier), FirstValue);
+
+		if (!ReadJsonObjectFieldsFromReader(Reader, *JsonObject))
+		{
+			return false;
+		}
+	}
+
+	const FJsonValueObject JsonValue(JsonObject);
+	return ConvertScalarJsonValueToProperty(JsonValue, ObjectProperty, ContainerPtr, ValuePtr);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+TSharedPtr<FJsonValue> FDlgJsonParser::ReadJsonValueFromReader(TJsonReader<TCHAR>& Reader, EJsonNotation Notation)
+{
+	switch (Notation)
+	{
+		case EJsonNotation::String:
+			return MakeShared<FJsonValueString>(Reader.GetValueAsString());
+
+		case EJsonNotation::Number:
+#if NY_ENGINE_VERSION >= 500
+			return MakeShared<FJsonValueNumberString>(Reader.GetValueAsNumberString());
+#else
+			return MakeShared<FJsonValueNumber>(Reader.GetValueAsNumber());
+#endif
+
+		case EJsonNotation::Boolean:
+			return MakeShared<FJsonValueBoolean>(Reader.GetValueAsBoolean());
+
+		case EJsonNotation::Null:
+			return MakeShared<FJsonValueNull>();
+
+		case EJsonNotation::ObjectStart:
+		{
+			TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+			if (!ReadJsonObjectFieldsFromReader(Reader, *JsonObject))
+			{
+				return nullptr;
+			}
+			return MakeShared<FJsonValueObject>(JsonObject);
+		}
+
+		case EJsonNotation::ArrayStart:
+		{
+			TArray<TSharedPtr<FJsonValue>> Values;
+			EJsonNotation ElementNotation;
+			while (ReadNextToken(Reader, ElementNotation))
+			{
+				if (ElementNotation == EJsonNotation::ArrayEnd)
+				{
+					return MakeShared<FJsonValueArray>(Values);
+				}
+
+				TSharedPtr<FJsonValue> Value = ReadJsonValueFromReader(Reader, ElementNotation);
+				if (!Value.IsValid())
+				{
+					return nullptr;
+				}
+				Values.Add(Value);
+			}
+			return nullptr;
+		}
+
+		default:
+			return nullptr;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgJsonParser::ReadJsonObjectFieldsFromReader(TJsonReader<TCHAR>& Reader, FJsonObject& OutJsonObject)
+{
+	EJsonNotation Notation;
+	while (ReadNextToken(Reader, Notation))
+	{
+		if (Notation == EJsonNotation::ObjectEnd)
+		{
+			return true;
+		}
+
+		// Copy, reading the value changes the identifier
+		const FString Identifier = Reader.GetIdentifier();
+		TSharedPtr<FJsonValue> Value = ReadJsonValueFromReader(Reader, Notation);
+		if (!Value.IsValid())
+		{
+			return false;
+		}
+		OutJsonObject.Values.Add(FNYMakeJsonObjectKey(Identifier), Value);
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgJsonParser::SkipValueFromReader(TJsonReader<TCHAR>& Reader, EJsonNotation Notation)
+{
+	bool bSuccess = true;
+	if (Notation == EJsonNotation::ObjectStart)
+	{
+		bSuccess = Reader.SkipObject();
+	}
+	else if (Notation == EJsonNotation::ArrayStart)
+	{
+		bSuccess = Reader.SkipArray();
+	}
+
+	if (!bSuccess)
+	{
+		UE_LOG(LogDlgJsonParser, Error, TEXT("SkipValueFromReader - Invalid json, FileName = `%s`, Error = `%s`"), *FileName, *Reader.GetErrorMessage());
+		bStreamingError = true;
+	}
+	return bSuccess;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgJsonParser::ReadNextToken(TJsonReader<TCHAR>& Reader, EJsonNotation& OutNotation)
+{
+	if (bStreamingError)
+	{
+		return false;
+	}
+
+	if (!Reader.ReadNext(OutNotation) || OutNotation == EJsonNotation::Error)
+	{
+		UE_LOG(LogDlgJsonParser, Error, TEXT("ReadNextToken - Invalid json, FileName = `%s`, Error = `%s`"), *FileName, *Reader.GetErrorMessage());
+		bStreamingError = true;
+		return false;
+	}
+
+	return true;
+}
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "Logging/LogMacros.h"
+#include "Serialization/JsonReader.h"
 
 #include "DlgJsonTypes.h"
 
@@ -27,6 +28,15 @@ class DLGSYSTEM_API FDlgJsonParser : public IDlgParser
 	 *							- ConvertScalarJsonValueToProperty
 	 *								- JsonValueToProperty
 	 *								- JsonObjectToUStruct
+	 *
+	 *  - Streaming (default), no JSON DOM is built
+	 *		- JsonStringToUStructStreaming
+	 *			- ReadStructFromReader
+	 *				- ReadValueToPropertyFromReader
+	 *					- ReadScalarToPropertyFromReader
+	 *						- ReadValueToPropertyFromReader
+	 *						- ReadStructFromReader
+	 *						- ConvertScalarJsonValueToProperty (simple values and the rare cases that need a JSON DOM)
 	 */
 
 public:
@@ -43,6 +53,15 @@ public:
 	bool IsValidFile() const override { return bIsValidFile; }
 	void ReadAllProperty(const UStruct* ReferenceClass, void* TargetObject, UObject* DefaultObjectOuter = nullptr) override;
 
+	// Builds the JSON DOM, ReadAllProperty uses it instead of streaming
+	void PreParse() override;
+
+	// Streaming assigns the properties directly from the JSON tokens, otherwise the whole JSON DOM is built first.
+	// Both produce the same result, the streaming one is faster and uses less memory.
+	// NOTE: on invalid JSON the streaming one keeps the properties read before the error.
+	void SetUseStreaming(bool bValue) { bUseStreaming = bValue; }
+	bool IsUsingStreaming() const { return bUseStreaming; }
+
 
 private: // JSON -> UStruct
 
@@ -50,7 +69,10 @@ private: // JSON -> UStruct
 	 * Convert JSON to property, assuming either the property is not an array or the value is an individual array element
 	 * Used by JsonValueToProperty
 	 */
-	bool ConvertScalarJsonValueToProperty(const TSharedPtr<FJsonValue>& JsonValue, FProperty* Property, void* ContainerPtr, void* ValuePtr);
+	bool ConvertScalarJsonValueToProperty(const FJsonValue& JsonValue, FProperty* Property, void* ContainerPtr, void* ValuePtr);
+
+	// Creates the UObject of class JsonObjectType (__type__) for the ObjectProperty into ObjectPtrPtr
+	bool CreateUObjectFromType(const FObjectProperty* ObjectProperty, const FString& JsonObjectType, UObject** ObjectPtrPtr);
 
 	/**
 	 * Converts a single JsonValue to the corresponding Property (this may recurse if the property is a UStruct for instance).
@@ -99,9 +121,55 @@ private: // JSON -> UStruct
 	 */
 	bool JsonObjectStringToUStruct(const UStruct* StructDefinition, void* ContainerPtr);
 
+	// Check to see if we should ignore this property
+	static bool CanReadProperty(const FProperty* Property)
+	{
+		return Property != nullptr && (CheckFlags == 0 || Property->HasAnyPropertyFlags(CheckFlags));
+	}
+
+private: // JSON tokens -> UStruct
+
+	// Same as JsonObjectStringToUStruct but without building the JSON DOM
+	bool JsonStringToUStructStreaming(const UStruct* StructDefinition, void* ContainerPtr);
+
+	// Same as JsonAttributesToUStruct, the ObjectStart token of the struct must be already read.
+	// Reads until (including) the ObjectEnd token.
+	bool ReadStructFromReader(TJsonReader<TCHAR>& Reader, const UStruct* StructDefinition, void* ContainerPtr);
+
+	// Same as JsonValueToProperty, Notation is the already read token of the value
+	bool ReadValueToPropertyFromReader(TJsonReader<TCHAR>& Reader, EJsonNotation Notation, FProperty* Property, void* ContainerPtr, void* ValuePtr);
+
+	// Same as ConvertScalarJsonValueToProperty, Notation is the already read token of the value
+	bool ReadScalarToPropertyFromReader(TJsonReader<TCHAR>& Reader, EJsonNotation Notation, FProperty* Property, void* ContainerPtr, void* ValuePtr);
+
+	// Containers and UObjects, the first token (ArrayStart/ObjectStart) is already read
+	bool ReadArrayFromReader(TJsonReader<TCHAR>& Reader, FArrayProperty* ArrayProperty, void* ContainerPtr, void* ValuePtr);
+	bool ReadSetFromReader(TJsonReader<TCHAR>& Reader, FSetProperty* SetProperty, void* ContainerPtr, void* ValuePtr);
+	bool ReadMapFromReader(TJsonReader<TCHAR>& Reader, FMapProperty* MapProperty, void* ContainerPtr, void* ValuePtr);
+	bool ReadUObjectFromReader(TJsonReader<TCHAR>& Reader, FObjectProperty* ObjectProperty, void* ContainerPtr, void* ValuePtr);
+
+	// Builds the JSON DOM of the value, only used for the values that can't be streamed (e.g. FText culture objects)
+	TSharedPtr<FJsonValue> ReadJsonValueFromReader(TJsonReader<TCHAR>& Reader, EJsonNotation Notation);
+	bool ReadJsonObjectFieldsFromReader(TJsonReader<TCHAR>& Reader, FJsonObject& OutJsonObject);
+
+	// Skips the value (including nested objects/arrays) of the already read token
+	bool SkipValueFromReader(TJsonReader<TCHAR>& Reader, EJsonNotation Notation);
+
+	// Reads the next token, returns false and logs the error if the JSON is not valid
+	bool ReadNextToken(TJsonReader<TCHAR>& Reader, EJsonNotation& OutNotation);
+
 private:
+	// See SetUseStreaming
+	bool bUseStreaming = true;
+
+	// Set when the streaming reader hits invalid JSON, stops everything
+	bool bStreamingError = false;
+
 	FString JsonString;
 	FString FileName;
+
+	// Built by PreParse
+	TSharedPtr<FJsonObject> PreParsedJsonObject;
 	bool bIsValidFile = false;
 
 	/** The default object outer used when creating new objects when using NewObject.  */
@@ -40,3 +40,50 @@ inline FString FNYJsonObjectKeyToString(const FNYJsonObjectKey& Key)
 	return Key;
 #endif
 }
+
+
+/**
+ * Case insensitive lookup of the attributes of a JSON object by property name.
+ * Built once per object so that matching all the properties of a struct is not O(properties * attributes).
+ */
+class FNYJsonAttributesLookup
+{
+public:
+	FNYJsonAttributesLookup(const FNYJsonAttributes& InJsonAttributes)
+		: JsonAttributes(InJsonAttributes)
+	{
+#if NY_ENGINE_VERSION >= 508
+		// The key type is not FString anymore, index the attributes by their FString names.
+		// On duplicates (same name with different case) keep the first, like a linear search would
+		KeyToValue.Reserve(JsonAttributes.Num());
+		for (const auto& Elem : JsonAttributes)
+		{
+			const FString Key = FNYJsonObjectKeyToString(Elem.Key);
+			if (!KeyToValue.Contains(Key))
+			{
+				KeyToValue.Add(Key, &Elem.Value);
+			}
+		}
+#endif
+	}
+
+	// Returns nullptr if the attribute does not exist
+	const TSharedPtr<FJsonValue>* Find(const FString& PropertyName) const
+	{
+#if NY_ENGINE_VERSION >= 508
+		const TSharedPtr<FJsonValue>* const* Found = KeyToValue.Find(PropertyName);
+		return Found ? *Found : nullptr;
+#else
+		// FString keys are hashed and compared case insensitive already
+		return JsonAttributes.Find(PropertyName);
+#endif
+	}
+
+private:
+	const FNYJsonAttributes& JsonAttributes;
+
+#if NY_ENGINE_VERSION >= 508
+	// NOTE: TMap with FString keys is case insensitive
+	TMap<FString, const TSharedPtr<FJsonValue>*> KeyToValue;
+#endif
+};
@@ -4,6 +4,7 @@
 #include "JsonObjectConverter.h"
 #include "JsonObjectWrapper.h"
 #include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
 #include "UObject/UnrealType.h"
 #include "UObject/EnumProperty.h"
 #include "UObject/TextProperty.h"
@@ -211,41 +212,7 @@ TSharedPtr<FJsonValue> FDlgJsonWriter::ConvertScalarPropertyToJsonValue(const FP
 			if (KeyElement.IsValid() && ValueElement.IsValid())
 			{
 				check(MapKeyPtr);
-
-				FString KeyString;
-				if (auto* KeyStructProperty = FNYReflectionHelper::CastProperty<FStructProperty>(MapProperty->KeyProp))
-				{
-					// Key is a struct
-#if NY_ENGINE_VERSION >= 501
-					MapProperty->KeyProp->ExportTextItem_Direct(KeyString, MapKeyPtr, MapKeyPtr, nullptr, PPF_None);
-#else
-					MapProperty->KeyProp->ExportTextItem(KeyString, MapKeyPtr, MapKeyPtr, nullptr, PPF_None);
-#endif
-				}
-				else
-				{
-					// Default to key string
-					KeyString = KeyElement->AsString();
-				}
-
-				// Fallback for anything else, what could this be :O
-				if (KeyString.IsEmpty())
-				{
-
-#if NY_ENGINE_VERSION >= 501
-					MapProperty->KeyProp->ExportTextItem_Direct(KeyString, MapKeyPtr, MapKeyPtr, nullptr, PPF_None);
-#else
-					MapProperty->KeyProp->ExportTextItem(KeyString, MapKeyPtr, MapKeyPtr, nullptr, PPF_None);
-#endif
-
-					if (KeyString.IsEmpty())
-					{
-						UE_LOG(LogDlgJsonWriter, Error, TEXT("Unable to convert key to string for property `%s`."), *MapProperty->GetNameCPP())
-						KeyString = FString::Printf(TEXT("Unparsed Key %d"), Index);
-					}
-				}
-
-				OutObject->SetField(KeyString, ValueElement);
+				OutObject->SetField(GetMapKeyString(MapProperty, MapKeyPtr, KeyElement, Index), ValueElement);
 			}
 		}
 
@@ -429,7 +396,7 @@ TSharedPtr<FJsonValue> FDlgJsonWriter::PropertyToJsonValue(const FProperty* Prop
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 bool FDlgJsonWriter::UStructToJsonAttributes(const UStruct* StructDefinition, const void* const ContainerPtr, FNYJsonAttributes& OutJsonAttributes)
 {
-	if (StructDefinition == nullptr || ContainerPtr == nullptr)
+	if (!CanWriteUStruct(StructDefinition, ContainerPtr))
 	{
 		return false;
 	}
@@ -455,16 +422,6 @@ bool FDlgJsonWriter::UStructToJsonAttributes(const UStruct* StructDefinition, co
 	if (StructDefinition->IsA<UClass>())
 	{
 		const UObject* UnrealObject = static_cast<const UObject*>(ContainerPtr);
-		if (!UnrealObject->IsValidLowLevelFast())
-		{
-			UE_LOG(
-				LogDlgJsonWriter,
-				Error,
-				TEXT("UStructToJsonObject: StructDefinition = `%s` is a UClass and expected ContainerPtr to be an UObject. Memory corruption?"),
-				*StructDefinition->GetPathName()
-			);
-			return false;
-		}
 
 		// Write type, Objects because they can have inheritance
 		OutJsonAttributes.Add(FNYMakeJsonObjectKey(TEXT("__type__")), MakeShared<FJsonValueString>(UnrealObject->GetClass()->GetName()));
@@ -472,47 +429,20 @@ bool FDlgJsonWriter::UStructToJsonAttributes(const UStruct* StructDefinition, co
 		// Structure points to the child
 		StructDefinition = UnrealObject->GetClass();
 	}
-	if (!StructDefinition->IsValidLowLevelFast())
-	{
-		UE_LOG(
-			LogDlgJsonWriter,
-			Error,
-			TEXT("UStructToJsonObject: StructDefinition = `%s` is a UClass and expected ContainerPtr.Class to be valid. Memory corruption?"),
-			*StructDefinition->GetPathName()
-		);
-		return false;
-	}
 
 	// Iterate over all the properties of the struct
-	for (TFieldIterator<const FProperty> It(StructDefinition); It; ++It)
+	const FDlgSerializationPlanRef Plan = FDlgSerializationPlanCache::Get().FindOrBuild(StructDefinition);
+	for (const FDlgSerializationPlanProperty& Entry : Plan->GetProperties())
 	{
-		const auto* Property = *It;
-		if (!ensure(Property))
-			continue;
-
-		// Check to see if we should ignore this property
-		if (CheckFlags != 0 && !Property->HasAnyPropertyFlags(CheckFlags))
-		{
-			// Property does not have the required Flags
-			if (bLogVerbose)
-			{
-				UE_LOG(LogDlgJsonWriter, Verbose, TEXT("Property = `%s` Does not have the required CheckFlags"), *Property->GetPathName());
-			}
-			continue;
-		}
-		if (CanSkipProperty(Property))
+		const FProperty* Property = Entry.Property;
+		if (!ShouldWriteProperty(Entry))
 		{
-			// Mark as skipped.
-			if (bLogVerbose)
-			{
-				UE_LOG(LogDlgJsonWriter, Verbose, TEXT("Property = `%s` Marked as skiped"), *Property->GetPathName());
-			}
 			continue;
 		}
 
 		// Get the Pointer to the Value
 		const void* ValuePtr = nullptr;
-		if (Property->IsA<FObjectProperty>())
+		if (Entry.Kind == EDlgPropertyKind::Object)
 		{
 			// Handle pointers, only allowed to be UObjects (are already pointers to the Value)
 			ValuePtr = ContainerPtr;
@@ -556,13 +486,614 @@ bool FDlgJsonWriter::UStructToJsonAttributes(const UStruct* StructDefinition, co
 
 		// set the value on the output object
 		// NOTE default JSON writer makes the first letter to be lowercase, we do not want that ;) FJsonObjectConverter::StandardizeCase
-		const FString VariableName = Property->GetName();
-		OutJsonAttributes.Add(FNYMakeJsonObjectKey(VariableName), JsonValue);
+		OutJsonAttributes.Add(FNYMakeJsonObjectKey(Entry.NameString), JsonValue);
 	}
 
 	return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgJsonWriter::CanWriteUStruct(const UStruct* StructDefinition, const void* const ContainerPtr) const
+{
+	if (StructDefinition == nullptr || ContainerPtr == nullptr)
+	{
+		return false;
+	}
+
+	// Json Wrapper, already have an Object
+	if (StructDefinition == FJsonObjectWrapper::StaticStruct())
+	{
+		return true;
+	}
+
+	// Handle UObject inheritance (children of class)
+	if (StructDefinition->IsA<UClass>())
+	{
+		const UObject* UnrealObject = static_cast<const UObject*>(ContainerPtr);
+		if (!UnrealObject->IsValidLowLevelFast())
+		{
+			UE_LOG(
+				LogDlgJsonWriter,
+				Error,
+				TEXT("UStructToJsonObject: StructDefinition = `%s` is a UClass and expected ContainerPtr to be an UObject. Memory corruption?"),
+				*StructDefinition->GetPathName()
+			);
+			return false;
+		}
+
+		// Structure points to the child
+		StructDefinition = UnrealObject->GetClass();
+	}
+	if (!StructDefinition->IsValidLowLevelFast())
+	{
+		UE_LOG(
+			LogDlgJsonWriter,
+			Error,
+			TEXT("UStructToJsonObject: StructDefinition = `%s` is a UClass and expected ContainerPtr.Class to be valid. Memory corruption?"),
+			*StructDefinition->GetPathName()
+		);
+		return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgJsonWriter::ShouldWriteProperty(const FDlgSerializationPlanProperty& Entry) const
+{
+	const FProperty* Property = Entry.Property;
+	if (!ensure(Property))
+	{
+		return false;
+	}
+
+	// Check to see if we should ignore this property
+	if (CheckFlags != 0 && !Property->HasAnyPropertyFlags(CheckFlags))
+	{
+		// Property does not have the required Flags
+		if (bLogVerbose)
+		{
+			UE_LOG(LogDlgJsonWriter, Verbose, TEXT("Property = `%s` Does not have the required CheckFlags"), *Property->GetPathName());
+		}
+		return false;
+	}
+	if (Entry.bSkipOnWrite)
+	{
+		// Mark as skipped.
+		if (bLogVerbose)
+		{
+			UE_LOG(LogDlgJsonWriter, Verbose, TEXT("Property = `%s` Marked as skiped"), *Property->GetPathName());
+		}
+		return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FString FDlgJsonWriter::GetMapKeyString(const FMapProperty* MapProperty, const uint8* MapKeyPtr, const TSharedPtr<FJsonValue>& KeyElement, int32 Index) const
+{
+	FString KeyString;
+	if (auto* KeyStructProperty = FNYReflectionHelper::CastProperty<FStructProperty>(MapProperty->KeyProp))
+	{
+		// Key is a struct
+#if NY_ENGINE_VERSION >= 501
+		MapProperty->KeyProp->ExportTextItem_Direct(KeyString, MapKeyPtr, MapKeyPtr, nullptr, PPF_None);
+#else
+		MapProperty->KeyProp->ExportTextItem(KeyString, MapKeyPtr, MapKeyPtr, nullptr, PPF_None);
+#endif
+	}
+	else
+	{
+		// Default to key string
+		KeyString = KeyElement->AsString();
+	}
+
+	// Fallback for anything else, what could this be :O
+	if (KeyString.IsEmpty())
+	{
+
+#if NY_ENGINE_VERSION >= 501
+		MapProperty->KeyProp->ExportTextItem_Direct(KeyString, MapKeyPtr, MapKeyPtr, nullptr, PPF_None);
+#else
+		MapProperty->KeyProp->ExportTextItem(KeyString, MapKeyPtr, MapKeyPtr, nullptr, PPF_None);
+#endif
+
+		if (KeyString.IsEmpty())
+		{
+			UE_LOG(LogDlgJsonWriter, Error, TEXT("Unable to convert key to string for property `%s`."), *MapProperty->GetNameCPP())
+			KeyString = FString::Printf(TEXT("Unparsed Key %d"), Index);
+		}
+	}
+
+	return KeyString;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Same as FJsonSerializer, values with an empty identifier are array elements
+template <class PrintPolicy, class ValueType>
+static void WriteJsonValue(const TDlgJsonTokenWriterRef<PrintPolicy>& Writer, const FString& Identifier, const ValueType& Value)
+{
+	if (Identifier.IsEmpty())
+	{
+		Writer->WriteValue(Value);
+	}
+	else
+	{
+		Writer->WriteValue(Identifier, Value);
+	}
+}
+
+template <class PrintPolicy>
+static void WriteJsonNull(const TDlgJsonTokenWriterRef<PrintPolicy>& Writer, const FString& Identifier)
+{
+	if (Identifier.IsEmpty())
+	{
+		Writer->WriteNull();
+	}
+	else
+	{
+		Writer->WriteNull(Identifier);
+	}
+}
+
+template <class PrintPolicy>
+static void WriteJsonObjectStart(const TDlgJsonTokenWriterRef<PrintPolicy>& Writer, const FString& Identifier)
+{
+	if (Identifier.IsEmpty())
+	{
+		Writer->WriteObjectStart();
+	}
+	else
+	{
+		Writer->WriteObjectStart(Identifier);
+	}
+}
+
+template <class PrintPolicy>
+static void WriteJsonArrayStart(const TDlgJsonTokenWriterRef<PrintPolicy>& Writer, const FString& Identifier)
+{
+	if (Identifier.IsEmpty())
+	{
+		Writer->WriteArrayStart();
+	}
+	else
+	{
+		Writer->WriteArrayStart(Identifier);
+	}
+}
+
+// Writes a value of the JSON DOM, used for the few cases that still build one
+template <class PrintPolicy>
+static void WriteJsonDOMValue(const TDlgJsonTokenWriterRef<PrintPolicy>& Writer, const FString& Identifier, const TSharedPtr<FJsonValue>& Value)
+{
+	if (Value.IsValid())
+	{
+		FJsonSerializer::Serialize(Value, Identifier, Writer, false);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class PrintPolicy>
+bool FDlgJsonWriter::UStructToJsonStringStreaming(const UStruct* StructDefinition, const void* const ContainerPtr, int32 InitialIndent, FString& OutJsonString)
+{
+	if (!CanWriteUStruct(StructDefinition, ContainerPtr))
+	{
+		return false;
+	}
+
+	const TDlgJsonTokenWriterRef<PrintPolicy> Writer = TJsonWriterFactory<TCHAR, PrintPolicy>::Create(&OutJsonString, InitialIndent);
+	Writer->WriteObjectStart();
+	WriteUStructAttributes(Writer, StructDefinition, ContainerPtr);
+	Writer->WriteObjectEnd();
+	return Writer->Close();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class PrintPolicy>
+void FDlgJsonWriter::WriteUStructAttributes(const TDlgJsonTokenWriterRef<PrintPolicy>& Writer, const UStruct* StructDefinition, const void* const ContainerPtr)
+{
+	if (bLogVerbose)
+	{
+		UE_LOG(LogDlgJsonWriter, Verbose, TEXT("WriteUStructAttributes, StructDefinition = `%s`"), *StructDefinition->GetPathName());
+	}
+
+	// Json Wrapper, already have an Object
+	if (StructDefinition == FJsonObjectWrapper::StaticStruct())
+	{
+		const FJsonObjectWrapper* ProxyObject = static_cast<const FJsonObjectWrapper*>(ContainerPtr);
+		if (ProxyObject->JsonObject.IsValid())
+		{
+			for (const auto& Elem : ProxyObject->JsonObject->Values)
+			{
+				WriteJsonDOMValue(Writer, FNYJsonObjectKeyToString(Elem.Key), Elem.Value);
+			}
+		}
+		return;
+	}
+
+	// Handle UObject inheritance (children of class)
+	if (StructDefinition->IsA<UClass>())
+	{
+		const UObject* UnrealObject = static_cast<const UObject*>(ContainerPtr);
+
+		// Write type, Objects because they can have inheritance
+		Writer->WriteValue(TEXT("__type__"), UnrealObject->GetClass()->GetName());
+
+		// Structure points to the child
+		StructDefinition = UnrealObject->GetClass();
+	}
+
+	const FDlgSerializationPlanRef Plan = FDlgSerializationPlanCache::Get().FindOrBuild(StructDefinition);
+	for (const FDlgSerializationPlanProperty& Entry : Plan->GetProperties())
+	{
+		if (!ShouldWriteProperty(Entry))
+		{
+			continue;
+		}
+
+		// Handle pointers, only allowed to be UObjects (are already pointers to the Value)
+		const void* ValuePtr = Entry.Kind == EDlgPropertyKind::Object ? ContainerPtr : Entry.GetValuePtr(ContainerPtr);
+
+		// NOTE default JSON writer makes the first letter to be lowercase, we do not want that ;) FJsonObjectConverter::StandardizeCase
+		WritePropertyValue(Writer, Entry.NameString, Entry.Property, ContainerPtr, ValuePtr);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class PrintPolicy>
+void FDlgJsonWriter::WritePropertyValue(const TDlgJsonTokenWriterRef<PrintPolicy>& Writer, const FString& Identifier,
+										const FProperty* Property, const void* const ContainerPtr, const void* const ValuePtr)
+{
+	check(Property);
+	if (bLogVerbose)
+	{
+		UE_LOG(LogDlgJsonWriter, Verbose, TEXT("WritePropertyValue, Property = `%s`"), *Property->GetPathName());
+	}
+
+	if (ContainerPtr == nullptr || ValuePtr == nullptr)
+	{
+		// Same as PropertyToJsonValue, let it log the reason
+		WriteJsonDOMValue(Writer, Identifier, PropertyToJsonValue(Property, ContainerPtr, ValuePtr));
+		return;
+	}
+
+	// Scalar Only one property
+	if (Property->ArrayDim == 1)
+	{
+		WriteScalarPropertyValue(Writer, Identifier, Property, ContainerPtr, ValuePtr);
+		return;
+	}
+
+	// Array
+#if NY_ENGINE_VERSION >= 505
+	const int32 ElementSize = Property->GetElementSize();
+#else
+	const int32 ElementSize = Property->ElementSize;
+#endif
+	WriteJsonArrayStart(Writer, Identifier);
+	auto* ValueIntPtr = static_cast<const uint8*>(ValuePtr);
+	for (int Index = 0; Index < Property->ArrayDim; Index++)
+	{
+		IndexInArray = Index;
+		WriteScalarPropertyValue(Writer, FString(), Property, ContainerPtr, ValueIntPtr + Index * ElementSize);
+	}
+	Writer->WriteArrayEnd();
+
+	ResetState();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class PrintPolicy>
+void FDlgJsonWriter::WriteScalarPropertyValue(const TDlgJsonTokenWriterRef<PrintPolicy>& Writer, const FString& Identifier,
+											  const FProperty* Property, const void* const ContainerPtr, const void* const ValuePtr)
+{
+	check(Property);
+	if (bLogVerbose)
+	{
+		UE_LOG(LogDlgJsonWriter, Verbose, TEXT("WriteScalarPropertyValue, Property = `%s`"), *Property->GetPathName());
+	}
+	if (ValuePtr == nullptr)
+	{
+		// Invalid
+		WriteJsonNull(Writer, Identifier);
+		return;
+	}
+
+	// NOTE: the values must be written exactly like FJsonSerializer writes the values of ConvertScalarPropertyToJsonValue
+	// Numbers are always doubles there.
+
+	// Enum, export enums as strings
+	if (const auto* EnumProperty = FNYReflectionHelper::CastProperty<FEnumProperty>(Property))
+	{
+		const UEnum* EnumDefinition = EnumProperty->GetEnum();
+		WriteJsonValue(Writer, Identifier, EnumDefinition->GetNameByIndex(EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr)).ToString());
+		return;
+	}
+
+	// Numeric, int, float, possible enum
+	if (const auto* NumericProperty = FNYReflectionHelper::CastProperty<FNumericProperty>(Property))
+	{
+		if (UEnum* EnumDefinition = NumericProperty->GetIntPropertyEnum())
+		{
+			WriteJsonValue(Writer, Identifier, EnumDefinition->GetNameByIndex(NumericProperty->GetSignedIntPropertyValue(ValuePtr)).ToString());
+			return;
+		}
+
+		if (NumericProperty->IsInteger())
+		{
+			if (bIsPropertyMapKey)
+			{
+				WriteJsonValue(Writer, Identifier, FString::Printf(TEXT("%lld"), NumericProperty->GetSignedIntPropertyValue(ValuePtr)));
+				return;
+			}
+
+			WriteJsonValue(Writer, Identifier, static_cast<double>(NumericProperty->GetSignedIntPropertyValue(ValuePtr)));
+			return;
+		}
+		if (NumericProperty->IsFloatingPoint())
+		{
+			WriteJsonValue(Writer, Identifier, static_cast<double>(NumericProperty->GetFloatingPointPropertyValue(ValuePtr)));
+			return;
+		}
+
+		// Invalid
+		WriteJsonNull(Writer, Identifier);
+		return;
+	}
+
+	// Bool, Export bools as JSON bools
+	if (const auto* BoolProperty = FNYReflectionHelper::CastProperty<FBoolProperty>(Property))
+	{
+		WriteJsonValue(Writer, Identifier, static_cast<bool>(BoolProperty->GetOptionalPropertyValue(ValuePtr)));
+		return;
+	}
+
+	// FString
+	if (const auto* StringProperty = FNYReflectionHelper::CastProperty<FStrProperty>(Property))
+	{
+		WriteJsonValue(Writer, Identifier, *static_cast<const FString*>(ValuePtr));
+		return;
+	}
+
+	// FName
+	if (const auto* NameProperty = FNYReflectionHelper::CastProperty<FNameProperty>(Property))
+	{
+		const FName* NamePtr = static_cast<const FName*>(ValuePtr);
+		if (!NamePtr->IsValidIndexFast() || !NamePtr->IsValid())
+		{
+			UE_LOG(LogDlgJsonWriter, Error, TEXT("Got Property = `%s` of type FName but it is not valid :("), *NameProperty->GetNameCPP())
+			WriteJsonNull(Writer, Identifier);
+			return;
+		}
+
+		WriteJsonValue(Writer, Identifier, NamePtr->ToString());
+		return;
+	}
+
+	// FText
+	if (const auto* TextProperty = FNYReflectionHelper::CastProperty<FTextProperty>(Property))
+	{
+		WriteJsonValue(Writer, Identifier, static_cast<const FText*>(ValuePtr)->ToString());
+		return;
+	}
+
+	// TArray
+	if (const auto* ArrayProperty = FNYReflectionHelper::CastProperty<FArrayProperty>(Property))
+	{
+		WriteJsonArrayStart(Writer, Identifier);
+		const FDlgConstScriptArrayHelper Helper(ArrayProperty, ValuePtr);
+		for (int32 Index = 0, Num = Helper.Num(); Index < Num; Index++)
+		{
+			IndexInArray = Index;
+			WritePropertyValue(Writer, FString(), ArrayProperty->Inner, ContainerPtr, Helper.GetConstRawPtr(Index));
+		}
+		Writer->WriteArrayEnd();
+
+		ResetState();
+		return;
+	}
+
+	// TSet
+	if (const auto* SetProperty = FNYReflectionHelper::CastProperty<FSetProperty>(Property))
+	{
+		WriteJsonArrayStart(Writer, Identifier);
+		const FScriptSetHelper Helper(SetProperty, ValuePtr);
+
+		// GetMaxIndex() instead of Num() - the container is not contiguous
+		for (int32 Index = 0; Index < Helper.GetMaxIndex(); Index++)
+		{
+			if (!Helper.IsValidIndex(Index))
+			{
+				continue;
+			}
+
+			IndexInArray = Index;
+			WritePropertyValue(Writer, FString(), SetProperty->ElementProp, ContainerPtr, Helper.GetElementPtr(Index));
+		}
+		Writer->WriteArrayEnd();
+
+		ResetState();
+		return;
+	}
+
+	// TMap
+	if (const auto* MapProperty = FNYReflectionHelper::CastProperty<FMapProperty>(Property))
+	{
+		WriteMap(Writer, Identifier, MapProperty, ContainerPtr, ValuePtr);
+		return;
+	}
+
+	// UStruct
+	if (const auto* StructProperty = FNYReflectionHelper::CastProperty<FStructProperty>(Property))
+	{
+		// Intentionally exclude the JSON Object wrapper, which specifically needs to export JSON in an object representation instead of a string
+		UScriptStruct::ICppStructOps* TheCppStructOps = StructProperty->Struct->GetCppStructOps();
+		if (StructProperty->Struct != FJsonObjectWrapper::StaticStruct() && TheCppStructOps && TheCppStructOps->HasExportTextItem())
+		{
+			// Export to native text
+			FString OutValueStr;
+			TheCppStructOps->ExportTextItem(OutValueStr, ValuePtr, ValuePtr, nullptr, PPF_None, nullptr);
+			WriteJsonValue(Writer, Identifier, OutValueStr);
+			return;
+		}
+
+		WriteUStructObject(Writer, Identifier, Property, StructProperty->Struct, ValuePtr);
+		return;
+	}
+
+	// UObject
+	if (const auto* ObjectProperty = FNYReflectionHelper::CastProperty<FObjectProperty>(Property))
+	{
+		auto WriteNullptr = [this, &Writer, &Identifier, &ObjectProperty]()
+		{
+			// Save reference as empty string
+			if (CanSaveAsReference(ObjectProperty, nullptr))
+			{
+				WriteJsonValue(Writer, Identifier, FString());
+				return;
+			}
+
+			WriteJsonNull(Writer, Identifier);
+		};
+
+		// NOTE: The ValuePtr here should be a pointer to a pointer, see ConvertScalarPropertyToJsonValue
+		const UObject* ObjectPtr = ObjectProperty->GetObjectPropertyValue_InContainer(ValuePtr);
+
+		// To find out if in nested containers the object is nullptr we must go a level up
+		const UObject* ContainerObjectPtr = ObjectProperty->GetObjectPropertyValue_InContainer(ContainerPtr);
+		if (ObjectPtr == nullptr || ContainerObjectPtr == nullptr)
+		{
+			WriteNullptr();
+			return;
+		}
+		if (!ObjectPtr->IsValidLowLevelFast())
+		{
+			// Memory corruption?
+			UE_LOG(
+				LogDlgJsonWriter,
+				Error,
+				TEXT("ObjectPtr.IsValidLowLevelFast is false for Property = `%s`. Memory corruption for UObjects?"),
+				*Property->GetPathName()
+			);
+			WriteNullptr();
+			return;
+		}
+
+		// Special case were we want just to save a reference to the object location
+		if (CanSaveAsReference(ObjectProperty, ObjectPtr))
+		{
+			WriteJsonValue(Writer, Identifier, ObjectPtr->GetPathName());
+			return;
+		}
+
+		WriteUStructObject(Writer, Identifier, Property, ObjectProperty->PropertyClass, ObjectPtr);
+		return;
+	}
+
+	// Default, convert to string
+	FString ValueString;
+#if NY_ENGINE_VERSION >= 501
+	Property->ExportTextItem_Direct(ValueString, ValuePtr, ValuePtr, nullptr, PPF_None);
+#else
+	Property->ExportTextItem(ValueString, ValuePtr, ValuePtr, nullptr, PPF_None);
+#endif
+
+	WriteJsonValue(Writer, Identifier, ValueString);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class PrintPolicy>
+void FDlgJsonWriter::WriteUStructObject(const TDlgJsonTokenWriterRef<PrintPolicy>& Writer, const FString& Identifier,
+										const FProperty* Property, const UStruct* StructDefinition, const void* const ContainerPtr)
+{
+	if (!CanWriteUStruct(StructDefinition, ContainerPtr))
+	{
+		// Invalid
+		WriteJsonNull(Writer, Identifier);
+		return;
+	}
+
+	WriteJsonObjectStart(Writer, Identifier);
+
+	// A valid JSON object wrapper replaces all the fields of the object, including the index
+	const bool bIsValidJsonWrapper = StructDefinition == FJsonObjectWrapper::StaticStruct()
+		&& static_cast<const FJsonObjectWrapper*>(ContainerPtr)->JsonObject.IsValid();
+	if (!bIsValidJsonWrapper && IndexInArray != INDEX_NONE && CanWriteIndex(Property))
+	{
+		Writer->WriteValue(TEXT("__index__"), static_cast<double>(IndexInArray));
+	}
+
+	WriteUStructAttributes(Writer, StructDefinition, ContainerPtr);
+	Writer->WriteObjectEnd();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class PrintPolicy>
+void FDlgJsonWriter::WriteMap(const TDlgJsonTokenWriterRef<PrintPolicy>& Writer, const FString& Identifier,
+							  const FMapProperty* MapProperty, const void* const ContainerPtr, const void* const ValuePtr)
+{
+	// The keys that are objects can change the state used by the values (see ConvertScalarPropertyToJsonValue),
+	// they are rare so just use the JSON DOM for the whole map.
+	const FProperty* KeyProperty = MapProperty->KeyProp;
+	if (KeyProperty->IsA<FStructProperty>() || KeyProperty->IsA<FObjectProperty>()
+		|| KeyProperty->IsA<FArrayProperty>() || KeyProperty->IsA<FSetProperty>() || KeyProperty->IsA<FMapProperty>())
+	{
+		WriteJsonDOMValue(Writer, Identifier, ConvertScalarPropertyToJsonValue(MapProperty, ContainerPtr, ValuePtr));
+		return;
+	}
+
+	// The keys must be known before the values are written.
+	// The JSON DOM keeps the first position but the last key and value for keys that end up the same, do the same.
+	struct FMapEntry
+	{
+		FString Key;
+		int32 ValueIndex;
+	};
+	TArray<FMapEntry> Entries;
+	TMap<FNYJsonObjectKey, int32> KeyToEntryIndex;
+
+	const FDlgConstScriptMapHelper Helper(MapProperty, ValuePtr);
+	Entries.Reserve(Helper.Num());
+
+	// GetMaxIndex() instead of Num() - the container is not contiguous
+	for (int32 Index = 0; Index < Helper.GetMaxIndex(); Index++)
+	{
+		if (!Helper.IsValidIndex(Index))
+		{
+			continue;
+		}
+		IndexInArray = Index;
+
+		bIsPropertyMapKey = true;
+		const uint8* MapKeyPtr = Helper.GetConstKeyPtr(Index);
+		const TSharedPtr<FJsonValue> KeyElement = PropertyToJsonValue(KeyProperty, ContainerPtr, MapKeyPtr);
+		bIsPropertyMapKey = false;
+
+		FString KeyString = GetMapKeyString(MapProperty, MapKeyPtr, KeyElement, Index);
+		if (const int32* EntryIndex = KeyToEntryIndex.Find(FNYMakeJsonObjectKey(KeyString)))
+		{
+			Entries[*EntryIndex] = {MoveTemp(KeyString), Index};
+		}
+		else
+		{
+			KeyToEntryIndex.Add(FNYMakeJsonObjectKey(KeyString), Entries.Num());
+			Entries.Add({MoveTemp(KeyString), Index});
+		}
+	}
+
+	WriteJsonObjectStart(Writer, Identifier);
+	for (const FMapEntry& Entry : Entries)
+	{
+		IndexInArray = Entry.ValueIndex;
+		bIsPropertyMapKey = false;
+		WritePropertyValue(Writer, Entry.Key, Helper.GetValueProperty(), ContainerPtr, Helper.GetConstValuePtr(Entry.ValueIndex));
+	}
+	Writer->WriteObjectEnd();
+
+	ResetState();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 template<class CharType, class PrintPolicy>
 bool UStructToJsonStringInternal(const TSharedRef<FJsonObject>& JsonObject, const int32 InitialIndent, FString& OutJsonString)
@@ -578,6 +1109,25 @@ bool UStructToJsonStringInternal(const TSharedRef<FJsonObject>& JsonObject, cons
 bool FDlgJsonWriter::UStructToJsonString(const UStruct* StructDefinition, const void* const ContainerPtr,
 	 const DlgJsonWriterOptions& Options, FString& OutJsonString)
 {
+	if (bUseStreaming)
+	{
+		bool bSuccess;
+		if (Options.bPrettyPrint)
+		{
+			bSuccess = UStructToJsonStringStreaming<TPrettyJsonPrintPolicy<TCHAR>>(StructDefinition, ContainerPtr, Options.InitialIndent, OutJsonString);
+		}
+		else
+		{
+			bSuccess = UStructToJsonStringStreaming<TCondensedJsonPrintPolicy<TCHAR>>(StructDefinition, ContainerPtr, Options.InitialIndent, OutJsonString);
+		}
+
+		if (!bSuccess)
+		{
+			UE_LOG(LogDlgJsonWriter, Error, TEXT("UStructToJsonObjectString - Unable to write out json"));
+		}
+		return bSuccess;
+	}
+
 	TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
 	if (UStructToJsonObject(StructDefinition, ContainerPtr, JsonObject))
 	{
@@ -600,3 +1150,34 @@ bool FDlgJsonWriter::UStructToJsonString(const UStruct* StructDefinition, const
 	UE_LOG(LogDlgJsonWriter, Error, TEXT("UStructToJsonObjectString - Unable to write out json"));
 	return false;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgJsonWriter::WriteSnapshot(const UStruct* StructDefinition, const void* ContainerPtr)
+{
+	TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	if (UStructToJsonObject(StructDefinition, ContainerPtr, JsonObject))
+	{
+		SnapshotJsonObject = JsonObject;
+	}
+	else
+	{
+		UE_LOG(LogDlgJsonWriter, Error, TEXT("WriteSnapshot - Unable to write out json"));
+		SnapshotJsonObject.Reset();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgJsonWriter::FinishWrite()
+{
+	if (!SnapshotJsonObject.IsValid())
+	{
+		return;
+	}
+
+	// Same options as Write
+	if (!UStructToJsonStringInternal<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>(SnapshotJsonObject.ToSharedRef(), 0, JsonString))
+	{
+		UE_LOG(LogDlgJsonWriter, Error, TEXT("FinishWrite - Unable to write out json"));
+	}
+	SnapshotJsonObject.Reset();
+}
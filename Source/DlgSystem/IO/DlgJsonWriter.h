@@ -4,10 +4,12 @@
 #include "Logging/LogMacros.h"
 #include "UObject/UnrealType.h"
 #include "Misc/FileHelper.h"
+#include "Serialization/JsonWriter.h"
 
 #include "DlgJsonTypes.h"
 
 #include "IDlgWriter.h"
+#include "DlgSerializationPlan.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogDlgJsonWriter, All, All);
 
@@ -18,6 +20,9 @@ struct DLGSYSTEM_API DlgJsonWriterOptions
 	bool bPrettyPrint = true;
 };
 
+template <class PrintPolicy>
+using TDlgJsonTokenWriterRef = TSharedRef<TJsonWriter<TCHAR, PrintPolicy>>;
+
 /**
  * @brief The DlgJsonWriter class mostly adapted for Dialogues, copied from FJsonObjectConverter
  * See IDlgWriter for properties and METADATA specifiers.
@@ -34,6 +39,16 @@ class DLGSYSTEM_API FDlgJsonWriter : public IDlgWriter
 	 *						- ConvertScalarPropertyToJsonValue
 	 *							- PropertyToJsonValue
 	 *							- UStructToJsonObject
+	 *
+	 *  - Streaming (default), no JSON DOM is built
+	 *		- UStructToJsonString
+	 *			- UStructToJsonStringStreaming
+	 *				- WriteUStructAttributes
+	 *					- WritePropertyValue
+	 *						- WriteScalarPropertyValue
+	 *							- WritePropertyValue
+	 *							- WriteUStructAttributes
+	 *							- ConvertScalarPropertyToJsonValue (only for maps with complex keys)
 	 */
 public:
 
@@ -42,6 +57,10 @@ public:
 	// IDlgWriter Interface
 	void Write(const UStruct* StructDefinition, const void* ContainerPtr) override;
 
+	// Builds the JSON DOM, FinishWrite converts it to the JSON string
+	void WriteSnapshot(const UStruct* StructDefinition, const void* ContainerPtr) override;
+	void FinishWrite() override;
+
 	/**
 	 * Save the config string to a text file
 	 * @param FullName: Full path + file name + extension
@@ -57,6 +76,11 @@ public:
 		return JsonString;
 	}
 
+	// Streaming writes the JSON tokens directly while iterating the properties, otherwise the whole JSON DOM is built first.
+	// Both produce the same output, the streaming one is faster and uses less memory.
+	void SetUseStreaming(bool bValue) { bUseStreaming = bValue; }
+	bool IsUsingStreaming() const { return bUseStreaming; }
+
 private: // UStruct -> JSON
 	/**
 	 * Convert property to JSON, assuming either the property is not an array or the value is an individual array element
@@ -112,6 +136,47 @@ private: // UStruct -> JSON
 	bool UStructToJsonString(const UStruct* StructDefinition, const void* const ContainerPtr, const DlgJsonWriterOptions& Options,
 							 FString& OutJsonString);
 
+	/**
+	 * Checks if the struct can be written, logs the reason if not.
+	 * Used by both UStructToJsonAttributes and WriteUStructAttributes before anything is written.
+	 */
+	bool CanWriteUStruct(const UStruct* StructDefinition, const void* const ContainerPtr) const;
+
+	// Should the property of a struct be written? Checks the CheckFlags and the metadata
+	bool ShouldWriteProperty(const FDlgSerializationPlanProperty& Entry) const;
+
+	// The key of a map entry as a JSON object key, KeyElement is the key converted with PropertyToJsonValue
+	FString GetMapKeyString(const FMapProperty* MapProperty, const uint8* MapKeyPtr, const TSharedPtr<FJsonValue>& KeyElement, int32 Index) const;
+
+private: // UStruct -> JSON tokens
+	// Same as UStructToJsonString but without building the JSON DOM
+	template <class PrintPolicy>
+	bool UStructToJsonStringStreaming(const UStruct* StructDefinition, const void* const ContainerPtr, int32 InitialIndent, FString& OutJsonString);
+
+	// Same as UStructToJsonAttributes, writes only the fields, the caller writes the object start/end.
+	// CanWriteUStruct must be true.
+	template <class PrintPolicy>
+	void WriteUStructAttributes(const TDlgJsonTokenWriterRef<PrintPolicy>& Writer, const UStruct* StructDefinition, const void* const ContainerPtr);
+
+	// Same as PropertyToJsonValue, an empty Identifier means the value is an array element
+	template <class PrintPolicy>
+	void WritePropertyValue(const TDlgJsonTokenWriterRef<PrintPolicy>& Writer, const FString& Identifier,
+							const FProperty* Property, const void* const ContainerPtr, const void* const ValuePtr);
+
+	// Same as ConvertScalarPropertyToJsonValue
+	template <class PrintPolicy>
+	void WriteScalarPropertyValue(const TDlgJsonTokenWriterRef<PrintPolicy>& Writer, const FString& Identifier,
+								  const FProperty* Property, const void* const ContainerPtr, const void* const ValuePtr);
+
+	// Writes the object of a struct or UObject property, including the __index__ metadata
+	template <class PrintPolicy>
+	void WriteUStructObject(const TDlgJsonTokenWriterRef<PrintPolicy>& Writer, const FString& Identifier,
+							const FProperty* Property, const UStruct* StructDefinition, const void* const ContainerPtr);
+
+	template <class PrintPolicy>
+	void WriteMap(const TDlgJsonTokenWriterRef<PrintPolicy>& Writer, const FString& Identifier,
+				  const FMapProperty* MapProperty, const void* const ContainerPtr, const void* const ValuePtr);
+
 	void ResetState()
 	{
 		IndexInArray = INDEX_NONE;
@@ -122,6 +187,12 @@ private:
 	// Final output string
 	FString JsonString;
 
+	// Built by WriteSnapshot
+	TSharedPtr<FJsonObject> SnapshotJsonObject;
+
+	// See SetUseStreaming
+	bool bUseStreaming = true;
+
 	/** Only properties that have these flags will be written. */
 	static constexpr int64 CheckFlags = ~CPF_ParmFlags; // all properties except those who have these flags? TODO is this ok?
 
@@ -0,0 +1,210 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgSerializationPlan.h"
+
+#include "Misc/ScopeRWLock.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+
+#include "DlgSystem/NYEngineVersionHelpers.h"
+#include "DlgSystem/NYReflectionHelper.h"
+#include "IDlgWriter.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FDlgSerializationPlan::FDlgSerializationPlan(const UStruct* InStruct) : Struct(InStruct)
+{
+	check(InStruct);
+	LayoutChildProperties = InStruct->ChildProperties;
+	LayoutPropertyLink = InStruct->PropertyLink;
+	LayoutPropertiesSize = InStruct->GetPropertiesSize();
+
+	for (TFieldIterator<FProperty> It(InStruct); It; ++It)
+	{
+		FProperty* Property = *It;
+		FDlgSerializationPlanProperty& Entry = Properties.AddDefaulted_GetRef();
+		Entry.Property = Property;
+		Entry.Name = Property->GetFName();
+		Entry.NameString = Property->GetName();
+		Entry.Kind = GetPropertyKind(Property);
+		Entry.Offset = Property->GetOffset_ForInternal();
+		Entry.ArrayDim = Property->ArrayDim;
+#if NY_ENGINE_VERSION >= 505
+		Entry.ElementSize = Property->GetElementSize();
+#else
+		Entry.ElementSize = Property->ElementSize;
+#endif
+		Entry.bSkipOnWrite = IDlgWriter::CanSkipProperty(Property);
+		Entry.bWriteIndex = IDlgWriter::CanWriteIndex(Property);
+		Entry.bLinePerItem = IDlgWriter::CanWriteOneLinePerItem(Property);
+
+		if (const auto* ArrayProperty = FNYReflectionHelper::CastProperty<FArrayProperty>(Property))
+		{
+			Entry.InnerKind = GetPropertyKind(ArrayProperty->Inner);
+		}
+		else if (const auto* SetProperty = FNYReflectionHelper::CastProperty<FSetProperty>(Property))
+		{
+			Entry.InnerKind = GetPropertyKind(SetProperty->ElementProp);
+		}
+		else if (const auto* MapProperty = FNYReflectionHelper::CastProperty<FMapProperty>(Property))
+		{
+			Entry.InnerKind = GetPropertyKind(MapProperty->KeyProp);
+			Entry.ValueKind = GetPropertyKind(MapProperty->ValueProp);
+		}
+	}
+
+	// Properties does not change from here, the pointers are safe
+	TArray<const FDlgSerializationPlanProperty*> PrimitiveContainers;
+	TArray<const FDlgSerializationPlanProperty*> ComplexElements;
+	TArray<const FDlgSerializationPlanProperty*> ComplexContainers;
+	for (int32 Index = 0; Index < Properties.Num(); Index++)
+	{
+		const FDlgSerializationPlanProperty& Entry = Properties[Index];
+
+		// Child properties come first, same as UStruct::FindPropertyByName
+		if (!NameToIndex.Contains(Entry.Name))
+		{
+			NameToIndex.Add(Entry.Name, Index);
+		}
+
+		if (Entry.IsPrimitive())
+		{
+			GroupedProperties.Add(&Entry);
+		}
+		else if (Entry.IsContainer())
+		{
+			if (Entry.IsPrimitiveContainer())
+			{
+				PrimitiveContainers.Add(&Entry);
+			}
+			else
+			{
+				ComplexContainers.Add(&Entry);
+			}
+		}
+		else
+		{
+			ComplexElements.Add(&Entry);
+		}
+	}
+
+	NumPrimitives = GroupedProperties.Num();
+	GroupedProperties.Append(PrimitiveContainers);
+	GroupedProperties.Append(ComplexElements);
+	GroupedProperties.Append(ComplexContainers);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+EDlgPropertyKind FDlgSerializationPlan::GetPropertyKind(const FProperty* Property)
+{
+	if (Property == nullptr)
+	{
+		return EDlgPropertyKind::Other;
+	}
+
+	// Numbers
+	if (FNYReflectionHelper::CastProperty<FBoolProperty>(Property) != nullptr)
+	{
+		return EDlgPropertyKind::Bool;
+	}
+	if (FNYReflectionHelper::CastProperty<FIntProperty>(Property) != nullptr)
+	{
+		return EDlgPropertyKind::Int;
+	}
+	if (FNYReflectionHelper::CastProperty<FInt64Property>(Property) != nullptr)
+	{
+		return EDlgPropertyKind::Int64;
+	}
+	if (FNYReflectionHelper::CastProperty<FFloatProperty>(Property) != nullptr)
+	{
+		return EDlgPropertyKind::Float;
+	}
+	if (FNYReflectionHelper::CastProperty<FDoubleProperty>(Property) != nullptr)
+	{
+		return EDlgPropertyKind::Double;
+	}
+	if (FNYReflectionHelper::CastProperty<FEnumProperty>(Property) != nullptr)
+	{
+		return EDlgPropertyKind::Enum;
+	}
+	if (FNYReflectionHelper::CastProperty<FNumericProperty>(Property) != nullptr)
+	{
+		return EDlgPropertyKind::OtherNumeric;
+	}
+
+	// Strings
+	if (FNYReflectionHelper::CastProperty<FStrProperty>(Property) != nullptr)
+	{
+		return EDlgPropertyKind::String;
+	}
+	if (FNYReflectionHelper::CastProperty<FNameProperty>(Property) != nullptr)
+	{
+		return EDlgPropertyKind::Name;
+	}
+	if (FNYReflectionHelper::CastProperty<FTextProperty>(Property) != nullptr)
+	{
+		return EDlgPropertyKind::Text;
+	}
+
+	// Containers
+	if (FNYReflectionHelper::CastProperty<FArrayProperty>(Property) != nullptr)
+	{
+		return EDlgPropertyKind::Array;
+	}
+	if (FNYReflectionHelper::CastProperty<FSetProperty>(Property) != nullptr)
+	{
+		return EDlgPropertyKind::Set;
+	}
+	if (FNYReflectionHelper::CastProperty<FMapProperty>(Property) != nullptr)
+	{
+		return EDlgPropertyKind::Map;
+	}
+
+	// Complex
+	if (FNYReflectionHelper::CastProperty<FStructProperty>(Property) != nullptr)
+	{
+		return EDlgPropertyKind::Struct;
+	}
+	if (FNYReflectionHelper::CastProperty<FObjectProperty>(Property) != nullptr)
+	{
+		return EDlgPropertyKind::Object;
+	}
+
+	return EDlgPropertyKind::Other;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FDlgSerializationPlanRef FDlgSerializationPlanCache::FindOrBuild(const UStruct* Struct)
+{
+	check(Struct);
+	{
+		FRWScopeLock ReadLock(Lock, SLT_ReadOnly);
+		if (const FDlgSerializationPlanRef* Found = Plans.Find(Struct))
+		{
+			// The address can be reused by a new struct after the old one was garbage collected,
+			// or the struct was recompiled in place (user defined structs)
+			if ((*Found)->IsUpToDate(Struct))
+			{
+				return *Found;
+			}
+		}
+	}
+
+	// Built outside of the lock, if two threads build the same plan the last one wins, both are correct
+	FDlgSerializationPlanRef Plan = MakeShared<const FDlgSerializationPlan, ESPMode::ThreadSafe>(Struct);
+	FRWScopeLock WriteLock(Lock, SLT_Write);
+	Plans.Add(Struct, Plan);
+	return Plan;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgSerializationPlanCache::Invalidate()
+{
+	FRWScopeLock WriteLock(Lock, SLT_Write);
+	Plans.Empty();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int32 FDlgSerializationPlanCache::Num() const
+{
+	FRWScopeLock ReadLock(Lock, SLT_ReadOnly);
+	return Plans.Num();
+}
@@ -0,0 +1,165 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/UnrealType.h"
+#include "UObject/WeakObjectPtr.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+// What a property is, the IO backends switch on this instead of the CastProperty chains
+enum class EDlgPropertyKind : uint8
+{
+	Bool,
+	Int,
+	Int64,
+	Float,
+	Double,
+	// Byte, int8, uint32, ... (everything numeric that is not above)
+	OtherNumeric,
+	Enum,
+	String,
+	Name,
+	Text,
+	Array,
+	Set,
+	Map,
+	Struct,
+	Object,
+	Other
+};
+
+// A property of a FDlgSerializationPlan
+struct DLGSYSTEM_API FDlgSerializationPlanProperty
+{
+	FProperty* Property = nullptr;
+	FName Name;
+	FString NameString;
+
+	EDlgPropertyKind Kind = EDlgPropertyKind::Other;
+
+	// Element of TArray/TSet, key of TMap
+	EDlgPropertyKind InnerKind = EDlgPropertyKind::Other;
+
+	// Value of TMap
+	EDlgPropertyKind ValueKind = EDlgPropertyKind::Other;
+
+	int32 Offset = 0;
+	int32 ArrayDim = 1;
+	int32 ElementSize = 0;
+
+	// IDlgWriter::CanSkipProperty
+	bool bSkipOnWrite = false;
+
+	// IDlgWriter metadata specifiers, only set in editor builds
+	bool bWriteIndex = false;
+	bool bLinePerItem = false;
+
+	// bool, int32, int64, float, double, FString, FName, FText, enum
+	static bool IsPrimitiveKind(EDlgPropertyKind InKind)
+	{
+		return InKind <= EDlgPropertyKind::Double || (InKind >= EDlgPropertyKind::Enum && InKind <= EDlgPropertyKind::Text);
+	}
+
+	bool IsPrimitive() const { return IsPrimitiveKind(Kind); }
+	bool IsContainer() const { return Kind == EDlgPropertyKind::Array || Kind == EDlgPropertyKind::Set || Kind == EDlgPropertyKind::Map; }
+	bool IsPrimitiveContainer() const
+	{
+		return IsContainer() && IsPrimitiveKind(InnerKind) && (Kind != EDlgPropertyKind::Map || IsPrimitiveKind(ValueKind));
+	}
+
+	// Same as FProperty::ContainerPtrToValuePtr
+	void* GetValuePtr(void* ContainerPtr, int32 ArrayIndex = 0) const
+	{
+		return static_cast<uint8*>(ContainerPtr) + Offset + ArrayIndex * ElementSize;
+	}
+	const void* GetValuePtr(const void* ContainerPtr, int32 ArrayIndex = 0) const
+	{
+		return static_cast<const uint8*>(ContainerPtr) + Offset + ArrayIndex * ElementSize;
+	}
+};
+
+/**
+ * What the IO backends (config, JSON, binary writers and parsers, hash writer) need to know about the properties of
+ * a UStruct/UClass, discovered once with reflection and shared by all of them.
+ * Immutable after it is built, get it from FDlgSerializationPlanCache.
+ */
+class DLGSYSTEM_API FDlgSerializationPlan
+{
+public:
+	FDlgSerializationPlan(const UStruct* InStruct);
+
+	// nullptr if the struct was garbage collected
+	const UStruct* GetStruct() const { return Struct.Get(); }
+
+	// False if the struct was garbage collected or its properties changed since this plan was built.
+	// User defined structs and blueprint classes are recompiled in place, the FProperty pointers of this plan would dangle.
+	bool IsUpToDate(const UStruct* InStruct) const
+	{
+		return Struct.Get() == InStruct
+			&& InStruct->ChildProperties == LayoutChildProperties
+			&& InStruct->PropertyLink == LayoutPropertyLink
+			&& InStruct->GetPropertiesSize() == LayoutPropertiesSize;
+	}
+
+	// All the properties, in the TFieldIterator order (child class properties first)
+	const TArray<FDlgSerializationPlanProperty>& GetProperties() const { return Properties; }
+
+	// All the properties grouped: primitives, primitive containers, complex elements, complex containers.
+	// The order of the config writer
+	const TArray<const FDlgSerializationPlanProperty*>& GetGroupedProperties() const { return GroupedProperties; }
+
+	// The first NumPrimitives of GetGroupedProperties are primitives
+	int32 GetNumPrimitives() const { return NumPrimitives; }
+
+	// Same as UStruct::FindPropertyByName, the child class properties hide the ones with the same name from the parent
+	const FDlgSerializationPlanProperty* FindProperty(FName PropertyName) const
+	{
+		const int32* Index = NameToIndex.Find(PropertyName);
+		return Index ? &Properties[*Index] : nullptr;
+	}
+
+	static EDlgPropertyKind GetPropertyKind(const FProperty* Property);
+
+private:
+	TWeakObjectPtr<const UStruct> Struct;
+	TArray<FDlgSerializationPlanProperty> Properties;
+	TArray<const FDlgSerializationPlanProperty*> GroupedProperties;
+	int32 NumPrimitives = 0;
+	TMap<FName, int32> NameToIndex;
+
+	// The layout of the struct when this was built, see IsUpToDate. Only compared, never dereferenced.
+	const FField* LayoutChildProperties = nullptr;
+	const FProperty* LayoutPropertyLink = nullptr;
+	int32 LayoutPropertiesSize = 0;
+};
+
+using FDlgSerializationPlanRef = TSharedRef<const FDlgSerializationPlan, ESPMode::ThreadSafe>;
+
+/**
+ * One FDlgSerializationPlan for each UStruct, built the first time it is requested and shared between all the
+ * writers and parsers (and threads, see the batch exports).
+ * The plans are dropped when modules are loaded, code is reloaded or objects are reinstanced, see FDlgSystemModule.
+ * A plan is also rebuilt if the layout of its struct changed, see FDlgSerializationPlan::IsUpToDate.
+ */
+class DLGSYSTEM_API FDlgSerializationPlanCache
+{
+public:
+	static FDlgSerializationPlanCache& Get()
+	{
+		static FDlgSerializationPlanCache Instance;
+		return Instance;
+	}
+
+	// Thread safe
+	FDlgSerializationPlanRef FindOrBuild(const UStruct* Struct);
+
+	// Drops all the plans, they are rebuilt on the next request. The plans already handed out are not updated.
+	void Invalidate();
+
+	int32 Num() const;
+
+private:
+	TMap<const UStruct*, FDlgSerializationPlanRef> Plans;
+	mutable FRWLock Lock;
+};
@@ -0,0 +1,217 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgTextFileReader.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/Archive.h"
+#include "Containers/StringConv.h"
+
+#include "DlgSystem/NYEngineVersionHelpers.h"
+
+#if NY_ENGINE_VERSION >= 425
+#include "Async/MappedFileHandle.h"
+#endif
+
+DEFINE_LOG_CATEGORY(LogDlgTextFileReader);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgTextFileReader::LoadFileToString(FString& OutString, const FString& FilePath, bool bAllowMemoryMapping, int32 ChunkSize)
+{
+	OutString.Empty();
+	const int64 FileSize = IFileManager::Get().FileSize(*FilePath);
+	if (FileSize < 0)
+	{
+		return false;
+	}
+	if (FileSize >= MAX_int32)
+	{
+		UE_LOG(LogDlgTextFileReader, Error, TEXT("LoadFileToString - File = `%s` is too big, size = %lld bytes"), *FilePath, FileSize);
+		return false;
+	}
+
+	if (bAllowMemoryMapping && FileSize >= MinMemoryMappedFileSize)
+	{
+		bool bHandled = false;
+		const bool bSuccess = LoadMappedFileToString(OutString, FilePath, FileSize, bHandled);
+		if (bHandled)
+		{
+			return bSuccess;
+		}
+	}
+
+	return LoadFileToStringInChunks(OutString, FilePath, FileSize, ChunkSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgTextFileReader::LoadMappedFileToString(FString& OutString, const FString& FilePath, int64 FileSize, bool& bOutHandled)
+{
+	bOutHandled = false;
+#if NY_ENGINE_VERSION >= 425
+	// NOTE: the region must be destroyed before the file handle
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	TUniquePtr<IMappedFileHandle> MappedFile(PlatformFile.OpenMapped(*FilePath));
+	if (!MappedFile.IsValid())
+	{
+		// Not supported on this platform
+		return false;
+	}
+
+	TUniquePtr<IMappedFileRegion> MappedRegion(MappedFile->MapRegion(0, FileSize));
+	if (!MappedRegion.IsValid())
+	{
+		return false;
+	}
+
+	const uint8* Bytes = MappedRegion->GetMappedPtr();
+	const int64 NumBytes = MappedRegion->GetMappedSize();
+	if (HasUTF16BOM(Bytes, NumBytes))
+	{
+		return false;
+	}
+
+	bOutHandled = true;
+	const int32 BOMSize = GetUTF8BOMSize(Bytes, NumBytes);
+	TArray<TCHAR>& Chars = OutString.GetCharArray();
+	AppendUTF8(Chars, Bytes + BOMSize, static_cast<int32>(NumBytes - BOMSize));
+	if (Chars.Num() > 0)
+	{
+		Chars.Add(TEXT('\0'));
+	}
+	return true;
+#else
+	return false;
+#endif // NY_ENGINE_VERSION >= 425
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgTextFileReader::LoadFileToStringInChunks(FString& OutString, const FString& FilePath, int64 FileSize, int32 ChunkSize)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath, FILEREAD_Silent));
+	if (!Reader.IsValid())
+	{
+		return false;
+	}
+
+	// The first chunk must fit the BOM, the incomplete UTF-8 sequence (max 3 bytes) is carried to the next chunk
+	static constexpr int32 MaxCarriedBytes = 3;
+	ChunkSize = FMath::Max(ChunkSize, 16);
+	TArray<uint8> Chunk;
+	Chunk.SetNumUninitialized(ChunkSize + MaxCarriedBytes);
+
+	// Upper bound, ASCII files have exactly one character for each byte
+	TArray<TCHAR>& Chars = OutString.GetCharArray();
+	Chars.Reserve(static_cast<int32>(FileSize) + 1);
+
+	int64 RemainingBytes = FileSize;
+	int32 NumCarriedBytes = 0;
+	bool bIsFirstChunk = true;
+	while (RemainingBytes > 0)
+	{
+		const int32 NumReadBytes = static_cast<int32>(FMath::Min<int64>(ChunkSize, RemainingBytes));
+		Reader->Serialize(Chunk.GetData() + NumCarriedBytes, NumReadBytes);
+		if (Reader->IsError())
+		{
+			UE_LOG(LogDlgTextFileReader, Error, TEXT("LoadFileToString - Failed to read file = `%s`"), *FilePath);
+			OutString.Empty();
+			return false;
+		}
+		RemainingBytes -= NumReadBytes;
+
+		const uint8* Bytes = Chunk.GetData();
+		int32 NumBytes = NumCarriedBytes + NumReadBytes;
+		if (bIsFirstChunk)
+		{
+			bIsFirstChunk = false;
+			if (HasUTF16BOM(Bytes, NumBytes))
+			{
+				// Rare, not worth a special path
+				Reader.Reset();
+				OutString.Empty();
+				return FFileHelper::LoadFileToString(OutString, *FilePath);
+			}
+
+			const int32 BOMSize = GetUTF8BOMSize(Bytes, NumBytes);
+			Bytes += BOMSize;
+			NumBytes -= BOMSize;
+		}
+
+		// The last chunk is converted as it is, invalid sequences are handled by the conversion
+		const int32 NumCompleteBytes = RemainingBytes > 0 ? GetCompleteUTF8Length(Bytes, NumBytes) : NumBytes;
+		AppendUTF8(Chars, Bytes, NumCompleteBytes);
+
+		NumCarriedBytes = NumBytes - NumCompleteBytes;
+		FMemory::Memmove(Chunk.GetData(), Bytes + NumCompleteBytes, NumCarriedBytes);
+	}
+
+	if (Chars.Num() > 0)
+	{
+		Chars.Add(TEXT('\0'));
+	}
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgTextFileReader::AppendUTF8(TArray<TCHAR>& Chars, const uint8* Bytes, int32 NumBytes)
+{
+	if (NumBytes <= 0)
+	{
+		return;
+	}
+
+#if NY_ENGINE_VERSION >= 500
+	const UTF8CHAR* Source = reinterpret_cast<const UTF8CHAR*>(Bytes);
+	const int32 NumChars = FPlatformString::ConvertedLength<TCHAR>(Source, NumBytes);
+	const int32 StartIndex = Chars.AddUninitialized(NumChars);
+	FPlatformString::Convert(Chars.GetData() + StartIndex, NumChars, Source, NumBytes);
+#else
+	const ANSICHAR* Source = reinterpret_cast<const ANSICHAR*>(Bytes);
+	const int32 NumChars = FUTF8ToTCHAR_Convert::ConvertedLength(Source, NumBytes);
+	const int32 StartIndex = Chars.AddUninitialized(NumChars);
+	FUTF8ToTCHAR_Convert::Convert(Chars.GetData() + StartIndex, NumChars, Source, NumBytes);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int32 FDlgTextFileReader::GetCompleteUTF8Length(const uint8* Bytes, int32 NumBytes)
+{
+	// Find the lead byte of the last sequence, it has at most 3 continuation bytes (10xxxxxx) after it
+	int32 LeadIndex = NumBytes - 1;
+	while (LeadIndex >= 0 && NumBytes - LeadIndex < 4 && (Bytes[LeadIndex] & 0xC0) == 0x80)
+	{
+		LeadIndex--;
+	}
+	if (LeadIndex < 0)
+	{
+		return NumBytes;
+	}
+
+	const uint8 Lead = Bytes[LeadIndex];
+	int32 SequenceLength = 1;
+	if ((Lead & 0xE0) == 0xC0)
+	{
+		SequenceLength = 2;
+	}
+	else if ((Lead & 0xF0) == 0xE0)
+	{
+		SequenceLength = 3;
+	}
+	else if ((Lead & 0xF8) == 0xF0)
+	{
+		SequenceLength = 4;
+	}
+
+	return LeadIndex + SequenceLength > NumBytes ? LeadIndex : NumBytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int32 FDlgTextFileReader::GetUTF8BOMSize(const uint8* Bytes, int64 NumBytes)
+{
+	return NumBytes >= 3 && Bytes[0] == 0xEF && Bytes[1] == 0xBB && Bytes[2] == 0xBF ? 3 : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgTextFileReader::HasUTF16BOM(const uint8* Bytes, int64 NumBytes)
+{
+	return NumBytes >= 2 && ((Bytes[0] == 0xFF && Bytes[1] == 0xFE) || (Bytes[0] == 0xFE && Bytes[1] == 0xFF));
+}
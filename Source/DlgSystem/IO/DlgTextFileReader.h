@@ -0,0 +1,50 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDlgTextFileReader, All, All);
+
+/**
+ * Loads the text files of the parsers, same result as FFileHelper::LoadFileToString.
+ * FFileHelper::LoadFileToString reads the whole file into memory and converts it after, so a UTF-8 file is in memory twice.
+ * This converts the UTF-8 files directly from the memory mapped file (if the platform supports it) or chunk by chunk,
+ * only the converted string is allocated. UTF-16 files fall back to FFileHelper::LoadFileToString.
+ */
+class DLGSYSTEM_API FDlgTextFileReader
+{
+public:
+	// Smaller files are read in chunks, mapping has its own overhead
+	static constexpr int64 MinMemoryMappedFileSize = 256 * 1024;
+
+	static constexpr int32 DefaultChunkSize = 64 * 1024;
+
+	/**
+	 * @param OutString: the text of the file, empty on failure
+	 * @param FilePath: the file to load
+	 * @param bAllowMemoryMapping: map the file if it is big enough, otherwise it is read in chunks
+	 * @param ChunkSize: size of the chunks in bytes if it is read in chunks
+	 * @return False if the file can't be read
+	 */
+	static bool LoadFileToString(
+		FString& OutString,
+		const FString& FilePath,
+		bool bAllowMemoryMapping = true,
+		int32 ChunkSize = DefaultChunkSize
+	);
+
+private:
+	static bool LoadMappedFileToString(FString& OutString, const FString& FilePath, int64 FileSize, bool& bOutHandled);
+	static bool LoadFileToStringInChunks(FString& OutString, const FString& FilePath, int64 FileSize, int32 ChunkSize);
+
+	// Converts the UTF-8 Bytes and adds them at the end of Chars, without the terminating zero
+	static void AppendUTF8(TArray<TCHAR>& Chars, const uint8* Bytes, int32 NumBytes);
+
+	// NumBytes without the incomplete UTF-8 sequence at the end (if any)
+	static int32 GetCompleteUTF8Length(const uint8* Bytes, int32 NumBytes);
+
+	// Size of the UTF-8 BOM at the start of Bytes, 0 if there is none
+	static int32 GetUTF8BOMSize(const uint8* Bytes, int64 NumBytes);
+	static bool HasUTF16BOM(const uint8* Bytes, int64 NumBytes);
+};
@@ -5,6 +5,8 @@
 #include "Containers/Array.h"
 #include "UObject/Object.h"
 
+#include "DlgClassNameIndex.h"
+
 class DLGSYSTEM_API IDlgParser
 {
 public:
@@ -19,6 +21,12 @@ public:
 	/** Is the parsed file valid? */
 	virtual bool IsValidFile() const = 0;
 
+	/**
+	 * Does the part of the parsing that does not touch any UObject (e.g. building the JSON DOM) ahead of ReadAllProperty.
+	 * Safe to call from any thread after InitializeParser, used by the batch imports. Optional, ReadAllProperty does it anyway.
+	 */
+	virtual void PreParse() {}
+
 	/**
 	 * Reads all property from the config file.
 	 *
@@ -43,24 +51,7 @@ protected:
 	 */
 	const UClass* GetChildClassFromName(const UClass* ParentClass, const FString& Name)
 	{
-		for (UClass* Class : StructCache)
-		{
-			if (Class->IsChildOf(ParentClass) && Class->GetName() == Name)
-			{
-				return Class;
-			}
-		}
-
-		for (TObjectIterator<UClass> It; It; ++It)
-		{
-			if (It->IsChildOf(ParentClass) && !It->HasAnyClassFlags(CLASS_Abstract) && (*It)->GetName() == Name)
-			{
-				StructCache.Add(*It);
-				return *It;
-			}
-		}
-
-		return nullptr;
+		return FDlgClassNameIndex::Get().FindChildClass(ParentClass, Name);
 	}
 
 	/**
@@ -73,9 +64,6 @@ protected:
 	}
 
 protected:
-	/** each time a class is read it also cached here, so next time when it has to be found based on name it can be found faster */
-	TArray<UClass*> StructCache;
-
 	// Should this class verbose log?
 	bool bLogVerbose = false;
 };
@@ -36,6 +36,15 @@ public:
 	virtual bool ExportToFile(const FString& FileName) = 0;
 	virtual const FString& GetAsString() const = 0;
 
+	/**
+	 * Write split in two, used by the batch exports:
+	 * WriteSnapshot reads the Object into a detached copy (e.g. the JSON DOM), it must be called on the game thread.
+	 * FinishWrite serializes that copy without touching any UObject, safe to call from any thread before ExportToFile.
+	 * By default WriteSnapshot does the whole Write and FinishWrite does nothing.
+	 */
+	virtual void WriteSnapshot(const UStruct* StructDefinition, const void* Object) { Write(StructDefinition, Object); }
+	virtual void FinishWrite() {}
+
 	/** Can we skip this property from exporting? */
 	static bool CanSkipProperty(const FProperty* Property)
 	{
@@ -2,11 +2,20 @@
 #include "DlgLogger.h"
 #include "DlgSystem/DlgSystemModule.h"
 #include "DlgSystem/DlgSystemSettings.h"
+#include "Misc/CoreDelegates.h"
+#include "Containers/Ticker.h"
 
 #define LOCTEXT_NAMESPACE "DlgLogger"
 
 static const FName MESSAGE_LOG_NAME{TEXT("Dialogue Plugin")};
 
+#if NY_ENGINE_VERSION >= 500
+static FTSTicker::FDelegateHandle FlushTickerHandle;
+#else
+static FDelegateHandle FlushTickerHandle;
+#endif
+static FDelegateHandle SystemErrorHandle;
+
 FDlgLogger::FDlgLogger() : Super()
 {
 	static constexpr bool bOwnMessageLogMirrorToOutputLog = true;
@@ -35,6 +44,10 @@ FDlgLogger& FDlgLogger::SyncWithSettings()
 	SetRedirectMessageLogLevelsHigherThan(Settings->RedirectMessageLogLevelsHigherThan);
 	SetOpenMessageLogLevelsHigherThan(Settings->OpenMessageLogLevelsHigherThan);
 	SetMessageLogOpenOnNewMessage(Settings->bMessageLogOpen);
+	SetMaxLogLevel(Settings->MaxLogLevel);
+	SetAsyncMaxQueuedMessages(Settings->AsyncLoggingMaxQueuedMessages);
+	SetAsyncMaxMessagesPerKeyPerSecond(Settings->AsyncLoggingMaxMessagesPerSecond);
+	UseAsyncOutput(Settings->bAsyncLogging);
 
 	return *this;
 }
@@ -43,10 +56,44 @@ void FDlgLogger::OnStart()
 {
 	MessageLogRegisterLogName(MESSAGE_LOG_NAME, LOCTEXT("dlg_key", "Dialogue System Plugin"));
 	Get().SyncWithSettings();
+
+	// Write the queued messages once per frame, does nothing if the async output is disabled
+	const FTickerDelegate FlushDelegate = FTickerDelegate::CreateLambda([](float DeltaTime)
+	{
+		Get().Flush();
+		return true;
+	});
+#if NY_ENGINE_VERSION >= 500
+	FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FlushDelegate);
+#else
+	FlushTickerHandle = FTicker::GetCoreTicker().AddTicker(FlushDelegate);
+#endif
+
+	// Do not lose the messages that lead to a crash
+	SystemErrorHandle = FCoreDelegates::OnHandleSystemError.AddLambda([]()
+	{
+		Get().Flush();
+	});
 }
 
 void FDlgLogger::OnShutdown()
 {
+	if (FlushTickerHandle.IsValid())
+	{
+#if NY_ENGINE_VERSION >= 500
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+#endif
+		FlushTickerHandle.Reset();
+	}
+	if (SystemErrorHandle.IsValid())
+	{
+		FCoreDelegates::OnHandleSystemError.Remove(SystemErrorHandle);
+		SystemErrorHandle.Reset();
+	}
+
+	Get().Flush();
 	MessageLogUnregisterLogName(MESSAGE_LOG_NAME);
 }
 
@@ -194,7 +194,8 @@ void INYLogger::MessageLogOpenLogName(FName LogName)
 void INYLogger::LogfImplementation(ENYLoggerLogLevel Level, const TCHAR* Fmt, ...)
 {
 #if !NO_LOGGING
-	NY_GROWABLE_LOGF(Log(Level, Buffer))
+	// The format string is the rate limit key, so that the same message with different arguments shares the limit
+	NY_GROWABLE_LOGF(LogWithKey(Level, Buffer, PointerHash(Fmt)))
 #endif // !NO_LOGGING
 }
 
@@ -212,6 +213,11 @@ void INYLogger::LogfImplementation(ENYLoggerLogLevel Level, const TCHAR* Fmt, ..
 // }
 
 void INYLogger::Log(ENYLoggerLogLevel Level, const FString& Message)
+{
+	LogWithKey(Level, Message, GetTypeHash(Message));
+}
+
+void INYLogger::LogWithKey(ENYLoggerLogLevel Level, const FString& Message, uint32 Key)
 {
 	// Should not happen but just in case redirect to the fatal function
 	// if (Level == ENYLoggerLogLevel::Fatal)
@@ -222,6 +228,23 @@ void INYLogger::Log(ENYLoggerLogLevel Level, const FString& Message)
 
 	// No logging, abort
 #if !NO_LOGGING
+	if (!IsLogLevelEnabled(Level))
+	{
+		return;
+	}
+
+	if (IsAsyncOutputEnabled())
+	{
+		AsyncQueue->Enqueue(Level, FString(Message), Key);
+		return;
+	}
+
+	LogToOutputs(Level, Message);
+#endif // !NO_LOGGING
+}
+
+void INYLogger::LogToOutputs(ENYLoggerLogLevel Level, const FString& Message)
+{
 	if (IsClientConsoleEnabled())
 	{
 		LogClientConsole(Level, Message);
@@ -238,7 +261,40 @@ void INYLogger::Log(ENYLoggerLogLevel Level, const FString& Message)
 	{
 		LogMessageLog(Level, Message);
 	}
-#endif // !NO_LOGGING
+}
+
+INYLogger& INYLogger::UseAsyncOutput(bool bValue)
+{
+	// Do not lose the queued messages
+	if (bAsyncOutput && !bValue)
+	{
+		Flush();
+	}
+
+	bAsyncOutput = bValue;
+	return *this;
+}
+
+int32 INYLogger::Flush()
+{
+	if (AsyncQueue->IsEmpty())
+	{
+		return 0;
+	}
+
+	if (IsInGameThread())
+	{
+		return AsyncQueue->Drain([this](ENYLoggerLogLevel Level, const FString& Message)
+		{
+			LogToOutputs(Level, Message);
+		});
+	}
+
+	// The output log is the only thread safe output
+	return AsyncQueue->Drain([this](ENYLoggerLogLevel Level, const FString& Message)
+	{
+		LogOutputLog(Level, Message);
+	});
 }
 
 void INYLogger::LogScreen(ENYLoggerLogLevel Level, const FString& Message)
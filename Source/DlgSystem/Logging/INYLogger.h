@@ -6,6 +6,7 @@
 #include "Logging/LogCategory.h"
 
 #include "DlgSystem/NYEngineVersionHelpers.h"
+#include "NYLogQueue.h"
 
 #include "INYLogger.generated.h"
 
@@ -14,6 +15,18 @@ class APlayerController;
 class FMessageLogModule;
 class IMessageLogListing;
 
+// Log levels higher than this are compiled out, the formatting and the arguments of those calls are never evaluated.
+// Matches the values of ENYLoggerLogLevel, override it from the Build.cs with PublicDefinitions.Add("NY_LOGGER_COMPILED_LOG_LEVEL=3");
+#ifndef NY_LOGGER_COMPILED_LOG_LEVEL
+	#if NO_LOGGING
+		#define NY_LOGGER_COMPILED_LOG_LEVEL 0
+	#elif UE_BUILD_SHIPPING
+		#define NY_LOGGER_COMPILED_LOG_LEVEL 2
+	#else
+		#define NY_LOGGER_COMPILED_LOG_LEVEL 5
+	#endif
+#endif // NY_LOGGER_COMPILED_LOG_LEVEL
+
 
 /**
  * Options for setting up a message log's UI
@@ -283,6 +296,37 @@ public:
 		return *this;
 	}
 
+	//
+	// Async output
+	//
+
+	// If enabled Log only queues the message, the outputs are written when Flush is called (FDlgLogger flushes once per frame).
+	// Repeated messages are merged and each message key is rate limited, see FNYLogQueue
+	Self& EnableAsyncOutput() { return UseAsyncOutput(true); }
+	Self& DisableAsyncOutput() { return UseAsyncOutput(false); }
+	Self& UseAsyncOutput(bool bValue);
+
+	// Messages logged after this many are dropped until the next Flush
+	Self& SetAsyncMaxQueuedMessages(int32 Value)
+	{
+		AsyncQueue->SetMaxQueuedMessages(Value);
+		return *this;
+	}
+
+	// A value <= 0 disables the rate limit
+	Self& SetAsyncMaxMessagesPerKeyPerSecond(int32 Value)
+	{
+		AsyncQueue->SetMaxMessagesPerKeyPerSecond(Value);
+		return *this;
+	}
+
+	FORCEINLINE bool IsAsyncOutputEnabled() const { return bAsyncOutput; }
+	FORCEINLINE int32 GetNumQueuedMessages() const { return AsyncQueue->Num(); }
+
+	// Writes all the queued messages to the outputs, returns the number of messages written.
+	// Outside the game thread only the output log is written to as the other outputs are not thread safe.
+	int32 Flush();
+
 	//
 	// Public accessors
 	//
@@ -292,6 +336,30 @@ public:
 	FORCEINLINE bool IsOnScreenEnabled() const { return bOnScreen; }
 	FORCEINLINE bool IsOutputLogEnabled() const { return bOutputLog; }
 	FORCEINLINE bool IsMessageLogEnabled() const { return bMessageLog; }
+	FORCEINLINE bool HasAnyOutputEnabled() const { return bClientConsole || bOnScreen || bOutputLog || bMessageLog; }
+
+	//
+	// Log level filtering
+	//
+
+	// Messages with a level higher than this are ignored at runtime, see NY_LOGGER_COMPILED_LOG_LEVEL for the compile time filter
+	Self& SetMaxLogLevel(ENYLoggerLogLevel Level)
+	{
+		MaxLogLevel = Level;
+		return *this;
+	}
+	FORCEINLINE ENYLoggerLogLevel GetMaxLogLevel() const { return MaxLogLevel; }
+
+	FORCEINLINE static constexpr bool IsLogLevelCompiledIn(ENYLoggerLogLevel Level)
+	{
+		return Level != ENYLoggerLogLevel::NoLogging && static_cast<int32>(Level) <= NY_LOGGER_COMPILED_LOG_LEVEL;
+	}
+
+	// Would a message of this level end up anywhere? Check this before building expensive messages.
+	FORCEINLINE bool IsLogLevelEnabled(ENYLoggerLogLevel Level) const
+	{
+		return IsLogLevelCompiledIn(Level) && Level <= MaxLogLevel && HasAnyOutputEnabled();
+	}
 
 	template <typename FmtType, typename... Types>
 	void Logf(ENYLoggerLogLevel Level, const FmtType& Fmt, Types... Args)
@@ -302,7 +370,10 @@ public:
 		static_assert(TIsArrayOrRefOfType<FmtType, TCHAR>::Value, "Formatting string must be a TCHAR array.");
 #endif
 		static_assert(TAnd<TIsValidVariadicFunctionArg<Types>...>::Value, "Invalid argument(s) passed to INYLogger::Logf");
-		LogfImplementation(Level, Fmt, Args...);
+		if (IsLogLevelEnabled(Level))
+		{
+			LogfImplementation(Level, Fmt, Args...);
+		}
 	}
 
 	template <typename FmtType, typename... Types>
@@ -332,9 +403,42 @@ public:
 	FORCEINLINE void Debug(const FString& Message) { Log(ENYLoggerLogLevel::Debug, Message); }
 	FORCEINLINE void Trace(const FString& Message) { Log(ENYLoggerLogLevel::Trace, Message); }
 
+	// Same as Log but MessageFunc (returns FString) is only called if the message is actually logged.
+	// Use it when building the message is expensive, e.g. it contains UDlgContext::GetContextString()
+	// NOTE: the arguments of Logf are evaluated before the call even if the level is disabled, this avoids that
+	template <typename FunctorType>
+	FORCEINLINE void LogLazy(ENYLoggerLogLevel Level, FunctorType&& MessageFunc)
+	{
+		if (IsLogLevelEnabled(Level))
+		{
+			Log(Level, Forward<FunctorType>(MessageFunc)());
+		}
+	}
+
+	template <typename FunctorType>
+	FORCEINLINE void ErrorLazy(FunctorType&& MessageFunc) { LogLazy(ENYLoggerLogLevel::Error, Forward<FunctorType>(MessageFunc)); }
+
+	template <typename FunctorType>
+	FORCEINLINE void WarningLazy(FunctorType&& MessageFunc) { LogLazy(ENYLoggerLogLevel::Warning, Forward<FunctorType>(MessageFunc)); }
+
+	template <typename FunctorType>
+	FORCEINLINE void InfoLazy(FunctorType&& MessageFunc) { LogLazy(ENYLoggerLogLevel::Info, Forward<FunctorType>(MessageFunc)); }
+
+	template <typename FunctorType>
+	FORCEINLINE void DebugLazy(FunctorType&& MessageFunc) { LogLazy(ENYLoggerLogLevel::Debug, Forward<FunctorType>(MessageFunc)); }
+
+	template <typename FunctorType>
+	FORCEINLINE void TraceLazy(FunctorType&& MessageFunc) { LogLazy(ENYLoggerLogLevel::Trace, Forward<FunctorType>(MessageFunc)); }
+
 protected:
 	void VARARGS LogfImplementation(ENYLoggerLogLevel Level, const TCHAR* Fmt, ...);
 
+	// Key is used by the rate limit of the async output
+	void LogWithKey(ENYLoggerLogLevel Level, const FString& Message, uint32 Key);
+
+	// Writes the message to all the enabled outputs
+	void LogToOutputs(ENYLoggerLogLevel Level, const FString& Message);
+
 #if WITH_UNREAL_DEVELOPER_TOOLS
 	static FMessageLogModule* GetMessageLogModule();
 #endif // WITH_UNREAL_DEVELOPER_TOOLS
@@ -411,6 +515,19 @@ protected:
 	static FOutputDevice* GetOutputDeviceFromLogLevel(ENYLoggerLogLevel Level);
 
 protected:
+	// Runtime filter, see SetMaxLogLevel
+	ENYLoggerLogLevel MaxLogLevel = ENYLoggerLogLevel::Trace;
+
+	//
+	// Async output
+	//
+
+	// Queue the messages instead of writing them to the outputs, see UseAsyncOutput
+	bool bAsyncOutput = false;
+
+	// Shared so that the loggers stay copyable
+	TSharedRef<FNYLogQueue, ESPMode::ThreadSafe> AsyncQueue = MakeShared<FNYLogQueue, ESPMode::ThreadSafe>();
+
 	//
 	// On screen
 	//
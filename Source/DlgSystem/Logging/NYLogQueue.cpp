@@ -0,0 +1,153 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "NYLogQueue.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+#include "INYLogger.h"
+
+// Rate limit window
+static constexpr double NY_LOG_QUEUE_WINDOW_SECONDS = 1.0;
+
+// Only prune the rate limit states if there are more than this
+static constexpr int32 NY_LOG_QUEUE_MAX_KEY_STATES = 1024;
+
+bool FNYLogQueue::Enqueue(ENYLoggerLogLevel Level, FString&& Message, uint32 Key)
+{
+	// Reserve a slot first so that the queue never gets bigger than MaxQueuedMessages
+	if (NumQueued.fetch_add(1, std::memory_order_relaxed) >= MaxQueuedMessages)
+	{
+		NumQueued.fetch_sub(1, std::memory_order_relaxed);
+		NumDropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	FNYQueuedLogMessage QueuedMessage;
+	QueuedMessage.Level = Level;
+	QueuedMessage.Message = MoveTemp(Message);
+	QueuedMessage.Key = Key;
+	Queue.Enqueue(MoveTemp(QueuedMessage));
+	return true;
+}
+
+int32 FNYLogQueue::Drain(TFunctionRef<void(ENYLoggerLogLevel, const FString&)> Output)
+{
+	FScopeLock Lock(&DrainCriticalSection);
+
+	// Unique messages of this batch in the order they were first logged
+	struct FBatchEntry
+	{
+		FNYQueuedLogMessage Message;
+		int32 Count = 1;
+	};
+	TArray<FBatchEntry> Batch;
+	TMap<uint32, int32> ContentHashToBatchIndex;
+
+	// Only take what is in the queue now, otherwise a thread that logs continuously would keep us here forever
+	int32 NumToDequeue = NumQueued.load(std::memory_order_acquire);
+	FNYQueuedLogMessage QueuedMessage;
+	while (NumToDequeue > 0 && Queue.Dequeue(QueuedMessage))
+	{
+		NumToDequeue--;
+		NumQueued.fetch_sub(1, std::memory_order_relaxed);
+
+		const uint32 ContentHash = HashCombine(GetTypeHash(static_cast<uint8>(QueuedMessage.Level)), GetTypeHash(QueuedMessage.Message));
+		if (const int32* BatchIndex = ContentHashToBatchIndex.Find(ContentHash))
+		{
+			FBatchEntry& Entry = Batch[*BatchIndex];
+			if (Entry.Message.Level == QueuedMessage.Level && Entry.Message.Message.Equals(QueuedMessage.Message, ESearchCase::CaseSensitive))
+			{
+				Entry.Count++;
+				continue;
+			}
+		}
+
+		// New message or a hash collision, the latter simply does not get merged
+		FBatchEntry& Entry = Batch.AddDefaulted_GetRef();
+		Entry.Message = MoveTemp(QueuedMessage);
+		ContentHashToBatchIndex.FindOrAdd(ContentHash, Batch.Num() - 1);
+	}
+
+	int32 NumOutput = 0;
+	const double NowSeconds = FPlatformTime::Seconds();
+	for (FBatchEntry& Entry : Batch)
+	{
+		int32 NumPreviouslySuppressed = 0;
+		if (!CanOutputKey(Entry.Message.Key, NowSeconds, NumPreviouslySuppressed))
+		{
+			KeyStates.FindChecked(Entry.Message.Key).NumSuppressed += Entry.Count;
+			continue;
+		}
+
+		FString& Message = Entry.Message.Message;
+		if (Entry.Count > 1)
+		{
+			Message += FString::Printf(TEXT(" (repeated %d times)"), Entry.Count);
+		}
+		if (NumPreviouslySuppressed > 0)
+		{
+			Message += FString::Printf(TEXT(" (%d similar messages were suppressed)"), NumPreviouslySuppressed);
+		}
+
+		Output(Entry.Message.Level, Message);
+		NumOutput++;
+	}
+
+	const int32 NumDroppedSinceLastDrain = NumDropped.exchange(0, std::memory_order_relaxed);
+	if (NumDroppedSinceLastDrain > 0)
+	{
+		Output(
+			ENYLoggerLogLevel::Warning,
+			FString::Printf(TEXT("Dropped %d log messages because the log queue was full (MaxQueuedMessages = %d)"), NumDroppedSinceLastDrain, MaxQueuedMessages)
+		);
+		NumOutput++;
+	}
+
+	if (KeyStates.Num() > NY_LOG_QUEUE_MAX_KEY_STATES)
+	{
+		PruneKeyStates(NowSeconds);
+	}
+
+	return NumOutput;
+}
+
+bool FNYLogQueue::CanOutputKey(uint32 Key, double NowSeconds, int32& OutNumPreviouslySuppressed)
+{
+	OutNumPreviouslySuppressed = 0;
+	if (MaxMessagesPerKeyPerSecond <= 0)
+	{
+		return true;
+	}
+
+	FKeyState& State = KeyStates.FindOrAdd(Key);
+
+	// New window
+	if (NowSeconds - State.WindowStartSeconds >= NY_LOG_QUEUE_WINDOW_SECONDS)
+	{
+		State.WindowStartSeconds = NowSeconds;
+		State.NumOutputInWindow = 0;
+	}
+
+	if (State.NumOutputInWindow >= MaxMessagesPerKeyPerSecond)
+	{
+		return false;
+	}
+
+	State.NumOutputInWindow++;
+	OutNumPreviouslySuppressed = State.NumSuppressed;
+	State.NumSuppressed = 0;
+	return true;
+}
+
+void FNYLogQueue::PruneKeyStates(double NowSeconds)
+{
+	for (auto It = KeyStates.CreateIterator(); It; ++It)
+	{
+		// Keep the ones that still have to report their suppressed messages
+		const FKeyState& State = It.Value();
+		if (State.NumSuppressed == 0 && NowSeconds - State.WindowStartSeconds >= NY_LOG_QUEUE_WINDOW_SECONDS)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,81 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "HAL/CriticalSection.h"
+
+enum class ENYLoggerLogLevel : uint8;
+
+
+// A message waiting inside FNYLogQueue
+struct FNYQueuedLogMessage
+{
+	ENYLoggerLogLevel Level;
+	FString Message;
+
+	// Messages with the same key share the rate limit, see FNYLogQueue::SetMaxMessagesPerKeyPerSecond
+	uint32 Key = 0;
+};
+
+
+/**
+ * Bounded multiple producer, single consumer queue of log messages used by INYLogger when the async output is enabled.
+ * Producers (any thread) never lock, the consumer (usually the game thread once per frame) drains the messages in batches:
+ * - identical messages inside a batch are merged into one with a repeat count
+ * - each message key can only be output a limited number of times per second, the rest are counted and reported later
+ * - messages that do not fit in the queue are dropped and counted
+ */
+class DLGSYSTEM_API FNYLogQueue
+{
+public:
+	FNYLogQueue() {}
+
+	// Adds the message to the queue, returns false if the queue is full and the message was dropped
+	bool Enqueue(ENYLoggerLogLevel Level, FString&& Message, uint32 Key);
+
+	// Drains all the messages that are in the queue and calls Output for every message that passed the deduplication and rate limits.
+	// Only one thread drains at a time, other threads calling this while a drain is in progress wait for it.
+	// Returns the number of messages passed to Output
+	int32 Drain(TFunctionRef<void(ENYLoggerLogLevel, const FString&)> Output);
+
+	bool IsEmpty() const { return NumQueued.load(std::memory_order_relaxed) == 0; }
+	int32 Num() const { return NumQueued.load(std::memory_order_relaxed); }
+
+	// Messages after this many are dropped until the queue is drained
+	void SetMaxQueuedMessages(int32 Value) { MaxQueuedMessages = FMath::Max(Value, 1); }
+	int32 GetMaxQueuedMessages() const { return MaxQueuedMessages; }
+
+	// A value <= 0 disables the rate limit
+	void SetMaxMessagesPerKeyPerSecond(int32 Value) { MaxMessagesPerKeyPerSecond = Value; }
+	int32 GetMaxMessagesPerKeyPerSecond() const { return MaxMessagesPerKeyPerSecond; }
+
+protected:
+	// State of the rate limit of one key
+	struct FKeyState
+	{
+		double WindowStartSeconds = 0.0;
+		int32 NumOutputInWindow = 0;
+		int32 NumSuppressed = 0;
+	};
+
+	// Is this key allowed to output again? Updates the rate limit state
+	bool CanOutputKey(uint32 Key, double NowSeconds, int32& OutNumPreviouslySuppressed);
+
+	// Removes the keys that did not output anything for a while
+	void PruneKeyStates(double NowSeconds);
+
+protected:
+	TQueue<FNYQueuedLogMessage, EQueueMode::Mpsc> Queue;
+	std::atomic<int32> NumQueued{0};
+	std::atomic<int32> NumDropped{0};
+
+	// Consumer only state
+	FCriticalSection DrainCriticalSection;
+	TMap<uint32, FKeyState> KeyStates;
+
+	int32 MaxQueuedMessages = 4096;
+	int32 MaxMessagesPerKeyPerSecond = 10;
+};
@@ -185,9 +185,13 @@ bool UDlgNode::ReevaluateChildren(UDlgContext& Context, TSet<const UDlgNode*> Al
 		switch (GetDefault<UDlgSystemSettings>()->NoSatisfiedChildBehavior)
 		{
 			case EDlgNoSatisfiedChildBehavior::PrintErrorAndEndDialogue:
-				FDlgLogger::Get().Errorf(
-					TEXT("ReevaluateChildren (ReevaluateOptions) - no valid child option for a NODE.\nContext:\n\t%s"),
-					*Context.GetContextString());
+				FDlgLogger::Get().ErrorLazy([&]()
+				{
+					return FString::Printf(
+						TEXT("ReevaluateChildren (ReevaluateOptions) - no valid child option for a NODE.\nContext:\n\t%s"),
+						*Context.GetContextString()
+					);
+				});
 
 			case EDlgNoSatisfiedChildBehavior::EndDialogue:
 				return false;
@@ -273,10 +277,13 @@ bool UDlgNode::OptionSelected(int32 OptionIndex, bool bFromAll, UDlgContext& Con
 			return Context.EnterNode(AllOptions[OptionIndex].GetEdge().TargetIndex, {});
 		}
 
-		FDlgLogger::Get().Errorf(
-			TEXT("OptionSelected - Failed to choose OptionIndex = %d from AllOptions - it only has %d valid options.\nContext:\n\t%s"),
-			OptionIndex, AllOptions.Num(), *Context.GetContextString()
-		);
+		FDlgLogger::Get().ErrorLazy([&]()
+		{
+			return FString::Printf(
+				TEXT("OptionSelected - Failed to choose OptionIndex = %d from AllOptions - it only has %d valid options.\nContext:\n\t%s"),
+				OptionIndex, AllOptions.Num(), *Context.GetContextString()
+			);
+		});
 	}
 	else
 	{
@@ -287,10 +294,13 @@ bool UDlgNode::OptionSelected(int32 OptionIndex, bool bFromAll, UDlgContext& Con
 			return Context.EnterNode(AvailableOptions[OptionIndex].TargetIndex, {});
 		}
 
-		FDlgLogger::Get().Errorf(
-			TEXT("OptionSelected - Failed to choose OptionIndex = %d from AvailableOptions - it only has %d valid options.\nContext:\n\t%s"),
-			OptionIndex, AvailableOptions.Num(), *Context.GetContextString()
-		);
+		FDlgLogger::Get().ErrorLazy([&]()
+		{
+			return FString::Printf(
+				TEXT("OptionSelected - Failed to choose OptionIndex = %d from AvailableOptions - it only has %d valid options.\nContext:\n\t%s"),
+				OptionIndex, AvailableOptions.Num(), *Context.GetContextString()
+			);
+		});
 	}
 	return false;
 }
@@ -10,12 +10,15 @@ bool UDlgNode_Proxy::HandleNodeEnter(UDlgContext& Context, TSet<const UDlgNode*>
 
 	if (NodesEnteredWithThisStep.Contains(this))
 	{
-		FDlgLogger::Get().Errorf(
-			TEXT("ProxyNode::HandleNodeEnter - Failed to enter proxy node, it was entered multiple times in a single step."
-					"Theoretically with some condition magic it could make sense, but chances are that it is an endless loop,"
-					"thus entering the same proxy twice with a single step is not supported. Dialogue is terminated.\nContext:\n\t%s"),
-			*Context.GetContextString()
-		);
+		FDlgLogger::Get().ErrorLazy([&]()
+		{
+			return FString::Printf(
+				TEXT("ProxyNode::HandleNodeEnter - Failed to enter proxy node, it was entered multiple times in a single step."
+						"Theoretically with some condition magic it could make sense, but chances are that it is an endless loop,"
+						"thus entering the same proxy twice with a single step is not supported. Dialogue is terminated.\nContext:\n\t%s"),
+				*Context.GetContextString()
+			);
+		});
 
 		return false;
 	}
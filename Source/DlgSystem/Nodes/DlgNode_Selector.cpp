@@ -44,12 +44,15 @@ bool UDlgNode_Selector::HandleNodeEnter(UDlgContext& Context, TSet<const UDlgNod
 
 	if (NodesEnteredWithThisStep.Contains(this))
 	{
-		FDlgLogger::Get().Errorf(
-			TEXT("SelectorNode::HandleNodeEnter - Failed to enter selector node, it was entered multiple times in a single step."
-					"Theoretically with some condition magic it could make sense, but chances are that it is an endless loop,"
-					"thus entering the same selector twice with a single step is not supported. Dialogue is terminated.\nContext:\n\t%s"),
-			*Context.GetContextString()
-		);
+		FDlgLogger::Get().ErrorLazy([&]()
+		{
+			return FString::Printf(
+				TEXT("SelectorNode::HandleNodeEnter - Failed to enter selector node, it was entered multiple times in a single step."
+						"Theoretically with some condition magic it could make sense, but chances are that it is an endless loop,"
+						"thus entering the same selector twice with a single step is not supported. Dialogue is terminated.\nContext:\n\t%s"),
+				*Context.GetContextString()
+			);
+		});
 
 		return false;
 	}
@@ -84,10 +87,13 @@ bool UDlgNode_Selector::HandleNodeEnter(UDlgContext& Context, TSet<const UDlgNod
 			checkNoEntry();
 	}
 
-	FDlgLogger::Get().Errorf(
-		TEXT("HandleNodeEnter - selector node entered, no satisfied child.\nContext:\n\t%s"),
-		*Context.GetContextString()
-	);
+	FDlgLogger::Get().ErrorLazy([&]()
+	{
+		return FString::Printf(
+			TEXT("HandleNodeEnter - selector node entered, no satisfied child.\nContext:\n\t%s"),
+			*Context.GetContextString()
+		);
+	});
 	return false;
 }
 
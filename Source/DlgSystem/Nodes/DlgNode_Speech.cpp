@@ -100,11 +100,14 @@ bool UDlgNode_Speech::ReevaluateChildren(UDlgContext& Context, TSet<const UDlgNo
 		// stop endless loop
 		if (AlreadyEvaluated.Contains(this))
 		{
-			FDlgLogger::Get().Errorf(
-				TEXT("ReevaluateChildren - Endless loop detected, a virtual parent became his own parent! "
-					"This is not supposed to happen, the dialogue is terminated.\nContext:\n\t%s"),
-				*Context.GetContextString()
-			);
+			FDlgLogger::Get().ErrorLazy([&]()
+			{
+				return FString::Printf(
+					TEXT("ReevaluateChildren - Endless loop detected, a virtual parent became his own parent! "
+						"This is not supposed to happen, the dialogue is terminated.\nContext:\n\t%s"),
+					*Context.GetContextString()
+				);
+			});
 			return false;
 		}
 
@@ -0,0 +1,178 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgBenchmarkTypes.h"
+
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/AutomationTest.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDlgBenchmark, All, All);
+DEFINE_LOG_CATEGORY(LogDlgBenchmark);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// UDlgBenchmarkSettings
+UDlgBenchmarkSettings::UDlgBenchmarkSettings()
+{
+	DialogueSizes = {10, 100, 1000};
+	SearchDialogueCounts = {10, 100, 500};
+	CompileDialogueSizes = {100, 500, 2000};
+	LayoutDialogueSizes = {100, 1000, 5000};
+}
+
+const FDlgBenchmarkThreshold* UDlgBenchmarkSettings::FindThreshold(const FString& Suite, const FString& Case, int32 Size) const
+{
+	const FDlgBenchmarkThreshold* Found = nullptr;
+	for (const FDlgBenchmarkThreshold& Threshold : Thresholds)
+	{
+		if (!Threshold.Matches(Suite, Case, Size))
+		{
+			continue;
+		}
+
+		// Exact size wins
+		if (Threshold.Size == Size)
+		{
+			return &Threshold;
+		}
+		Found = &Threshold;
+	}
+
+	return Found;
+}
+
+FString UDlgBenchmarkSettings::GetCSVDirectory() const
+{
+	if (CSVDirectory.IsEmpty())
+	{
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("DlgSystem"), TEXT("Benchmarks"));
+	}
+
+	return FPaths::Combine(FPaths::ProjectDir(), CSVDirectory);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FDlgBenchmarkReport
+void FDlgBenchmarkReport::AddResult(const FString& Case, int32 Size, int32 NumOperations, double TotalSeconds, int64 PeakBytes)
+{
+	FDlgBenchmarkResult Result;
+	Result.Suite = Suite;
+	Result.Case = Case;
+	Result.Size = Size;
+	Result.NumOperations = NumOperations;
+	Result.TotalSeconds = TotalSeconds;
+	Result.PeakBytes = PeakBytes;
+	Results.Add(Result);
+}
+
+FString FDlgBenchmarkReport::ToCSV() const
+{
+	const UDlgBenchmarkSettings* Settings = GetDefault<UDlgBenchmarkSettings>();
+
+	FString CSV = TEXT("Suite,Case,Size,Operations,TotalSeconds,MicrosecondsPerOp,OpsPerSecond,PeakBytes,ThresholdMicrosecondsPerOp\n");
+	for (const FDlgBenchmarkResult& Result : Results)
+	{
+		const FDlgBenchmarkThreshold* Threshold = Settings->FindThreshold(Result.Suite, Result.Case, Result.Size);
+		CSV += FString::Printf(
+			TEXT("%s,%s,%d,%d,%f,%f,%f,%s,%s\n"),
+			*Result.Suite, *Result.Case, Result.Size, Result.NumOperations, Result.TotalSeconds,
+			Result.GetMicrosecondsPerOp(), Result.GetOpsPerSecond(),
+			Result.PeakBytes != INDEX_NONE ? *LexToString(Result.PeakBytes) : TEXT(""),
+			Threshold ? *FString::SanitizeFloat(Threshold->MaxMicrosecondsPerOp) : TEXT("")
+		);
+	}
+
+	return CSV;
+}
+
+bool FDlgBenchmarkReport::SaveCSV() const
+{
+	const UDlgBenchmarkSettings* Settings = GetDefault<UDlgBenchmarkSettings>();
+	if (!Settings->bWriteCSV)
+	{
+		return true;
+	}
+
+	const FString FilePath = FPaths::Combine(Settings->GetCSVDirectory(), Suite + TEXT(".csv"));
+	return FFileHelper::SaveStringToFile(ToCSV(), *FilePath);
+}
+
+bool FDlgBenchmarkReport::CheckThresholds(TArray<FString>& OutErrors) const
+{
+	const UDlgBenchmarkSettings* Settings = GetDefault<UDlgBenchmarkSettings>();
+	bool bAllPassed = true;
+	for (const FDlgBenchmarkResult& Result : Results)
+	{
+		const FDlgBenchmarkThreshold* Threshold = Settings->FindThreshold(Result.Suite, Result.Case, Result.Size);
+		if (!Threshold || Threshold->MaxMicrosecondsPerOp <= 0.0)
+		{
+			continue;
+		}
+
+		if (Result.GetMicrosecondsPerOp() > Threshold->MaxMicrosecondsPerOp)
+		{
+			bAllPassed = false;
+			OutErrors.Add(FString::Printf(
+				TEXT("%s.%s (Size = %d) took %f us/op, threshold is %f us/op"),
+				*Result.Suite, *Result.Case, Result.Size, Result.GetMicrosecondsPerOp(), Threshold->MaxMicrosecondsPerOp
+			));
+		}
+	}
+
+	return bAllPassed;
+}
+
+bool FDlgBenchmarkReport::ReportTo(FAutomationTestBase& Test, const TCHAR* SizeName) const
+{
+	for (const FDlgBenchmarkResult& Result : Results)
+	{
+		const FString PeakBytes = Result.PeakBytes != INDEX_NONE ? FString::Printf(TEXT(", %lld peak bytes"), Result.PeakBytes) : FString();
+		UE_LOG(
+			LogDlgBenchmark, Display, TEXT("%s.%s (%s = %d): %f us/op, %f ops/sec%s"),
+			*Result.Suite, *Result.Case, SizeName, Result.Size, Result.GetMicrosecondsPerOp(), Result.GetOpsPerSecond(), *PeakBytes
+		);
+	}
+
+	if (!SaveCSV())
+	{
+		Test.AddWarning(TEXT("Could not write the benchmark CSV file"));
+	}
+
+	TArray<FString> Errors;
+	if (!CheckThresholds(Errors))
+	{
+		for (const FString& Error : Errors)
+		{
+			Test.AddError(Error);
+		}
+		return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FDlgBenchmarkMemoryScope
+
+FDlgBenchmarkMemoryScope::FDlgBenchmarkMemoryScope()
+{
+	const FPlatformMemoryStats Stats = FPlatformMemory::GetStats();
+	StartUsedBytes = static_cast<int64>(Stats.UsedPhysical);
+	StartPeakUsedBytes = static_cast<int64>(Stats.PeakUsedPhysical);
+}
+
+int64 FDlgBenchmarkMemoryScope::GetPeakBytes() const
+{
+	const FPlatformMemoryStats Stats = FPlatformMemory::GetStats();
+	const int64 PeakUsedBytes = static_cast<int64>(Stats.PeakUsedPhysical);
+
+	// The process reached a new peak inside the scope
+	if (PeakUsedBytes > StartPeakUsedBytes)
+	{
+		bPeakAccurate = true;
+		return FMath::Max<int64>(PeakUsedBytes - StartUsedBytes, 0);
+	}
+
+	// Still below the peak from before the scope, only the current usage is known
+	bPeakAccurate = false;
+	return FMath::Max<int64>(static_cast<int64>(Stats.UsedPhysical) - StartUsedBytes, 0);
+}
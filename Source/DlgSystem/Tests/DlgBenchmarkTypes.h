@@ -0,0 +1,196 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+
+#include "DlgBenchmarkTypes.generated.h"
+
+class FAutomationTestBase;
+
+// Maximum allowed average time of one operation of a benchmark case, see UDlgBenchmarkSettings
+USTRUCT()
+struct DLGSYSTEM_API FDlgBenchmarkThreshold
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	// Name of the benchmark suite, e.g. Traversal
+	UPROPERTY(Config)
+	FString Suite;
+
+	// Name of the case inside the suite, e.g. ChooseOption
+	UPROPERTY(Config)
+	FString Case;
+
+	// Size this threshold applies to, INDEX_NONE means all sizes
+	UPROPERTY(Config)
+	int32 Size = INDEX_NONE;
+
+	// The case fails if the average time of one operation is bigger than this
+	UPROPERTY(Config)
+	double MaxMicrosecondsPerOp = 0.0;
+
+public:
+	bool Matches(const FString& InSuite, const FString& InCase, int32 InSize) const
+	{
+		return Suite == InSuite && Case == InCase && (Size == INDEX_NONE || Size == InSize);
+	}
+};
+
+
+/**
+ * Settings of the benchmarks inside DlgSystem/Tests, configured from the DefaultGame.ini, e.g:
+ *
+ * [/Script/DlgSystem.DlgBenchmarkSettings]
+ * Iterations=500
+ * +Thresholds=(Suite="Traversal",Case="ChooseOption",Size=1000,MaxMicrosecondsPerOp=25.0)
+ *
+ * Used by the CI to catch performance regressions.
+ */
+UCLASS(Config = Game)
+class DLGSYSTEM_API UDlgBenchmarkSettings : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UDlgBenchmarkSettings();
+
+	// Finds the most specific threshold (exact size over all sizes), nullptr if none
+	const FDlgBenchmarkThreshold* FindThreshold(const FString& Suite, const FString& Case, int32 Size) const;
+
+	// Directory where the CSV files are written to
+	FString GetCSVDirectory() const;
+
+public:
+	// Number of nodes of the generated dialogues
+	UPROPERTY(Config)
+	TArray<int32> DialogueSizes;
+
+	// Number of operations measured per case and size
+	UPROPERTY(Config)
+	int32 Iterations = 200;
+
+	// Used by the dialogue generator
+	UPROPERTY(Config)
+	int32 Seed = 1337;
+
+	// The JSON import benchmark generates a dialogue that is at least this big when exported
+	UPROPERTY(Config)
+	int32 JsonImportMinFileSizeMB = 10;
+
+	// Number of imports measured per parser
+	UPROPERTY(Config)
+	int32 JsonImportIterations = 3;
+
+	// Number of times each generated .dlg file is parsed by the config parse benchmark
+	UPROPERTY(Config)
+	int32 ConfigParseIterations = 20;
+
+	// Number of generated dialogues (project sizes) of the search index benchmark, see DlgSystemEditor/Tests
+	UPROPERTY(Config)
+	TArray<int32> SearchDialogueCounts;
+
+	// Number of nodes of each dialogue generated by the search index benchmark
+	UPROPERTY(Config)
+	int32 SearchDialogueSize = 50;
+
+	// Number of times each search string is queried by the search index benchmark
+	UPROPERTY(Config)
+	int32 SearchIterations = 10;
+
+	// Number of nodes of the dialogues generated by the compiler benchmark, see DlgSystemEditor/Tests
+	UPROPERTY(Config)
+	TArray<int32> CompileDialogueSizes;
+
+	// Number of compiles measured per size by the compiler benchmark
+	UPROPERTY(Config)
+	int32 CompileIterations = 10;
+
+	// Number of nodes of the dialogues generated by the graph layout benchmark, see DlgSystemEditor/Tests
+	UPROPERTY(Config)
+	TArray<int32> LayoutDialogueSizes;
+
+	// Number of layouts measured per size by the graph layout benchmark
+	UPROPERTY(Config)
+	int32 LayoutIterations = 5;
+
+	// Write the results as CSV files
+	UPROPERTY(Config)
+	bool bWriteCSV = true;
+
+	// Relative to the project directory, empty means Saved/DlgSystem/Benchmarks
+	UPROPERTY(Config)
+	FString CSVDirectory;
+
+	UPROPERTY(Config)
+	TArray<FDlgBenchmarkThreshold> Thresholds;
+};
+
+
+// One measured benchmark case
+struct DLGSYSTEM_API FDlgBenchmarkResult
+{
+	FString Suite;
+	FString Case;
+	int32 Size = 0;
+	int32 NumOperations = 0;
+	double TotalSeconds = 0.0;
+
+	// Peak of the extra physical memory used while measuring, INDEX_NONE if not measured, see FDlgBenchmarkMemoryScope
+	int64 PeakBytes = INDEX_NONE;
+
+	double GetMicrosecondsPerOp() const { return NumOperations > 0 ? TotalSeconds * 1000000.0 / NumOperations : 0.0; }
+	double GetOpsPerSecond() const { return TotalSeconds > 0.0 ? NumOperations / TotalSeconds : 0.0; }
+};
+
+
+// Collects the benchmark results, writes them as CSV and checks them against the thresholds from UDlgBenchmarkSettings
+class DLGSYSTEM_API FDlgBenchmarkReport
+{
+public:
+	FDlgBenchmarkReport(const FString& InSuite) : Suite(InSuite) {}
+
+	void AddResult(const FString& Case, int32 Size, int32 NumOperations, double TotalSeconds, int64 PeakBytes = INDEX_NONE);
+	const TArray<FDlgBenchmarkResult>& GetResults() const { return Results; }
+
+	// CSV with the header: Suite,Case,Size,Operations,TotalSeconds,MicrosecondsPerOp,OpsPerSecond,PeakBytes,ThresholdMicrosecondsPerOp
+	FString ToCSV() const;
+
+	// Writes the CSV into UDlgBenchmarkSettings::GetCSVDirectory()/<Suite>.csv if enabled
+	bool SaveCSV() const;
+
+	// Fills OutErrors with the results that are slower than their thresholds, returns true if there are none
+	bool CheckThresholds(TArray<FString>& OutErrors) const;
+
+	// The end of every benchmark test: logs the results, saves the CSV and adds an error to the Test for each failed threshold.
+	// SizeName is what the size of the results is in the log, e.g. NumNodes. Returns false if a threshold failed.
+	bool ReportTo(FAutomationTestBase& Test, const TCHAR* SizeName = TEXT("Size")) const;
+
+protected:
+	FString Suite;
+	TArray<FDlgBenchmarkResult> Results;
+};
+
+
+/**
+ * Measures the peak of the physical memory used by the process while it is in scope, relative to the start.
+ * Reads the platform memory stats only, the allocator is never touched, so it is safe with other threads running.
+ * The stats are for the whole process, the allocations of the other threads are included.
+ */
+class DLGSYSTEM_API FDlgBenchmarkMemoryScope
+{
+public:
+	FDlgBenchmarkMemoryScope();
+
+	// Never below 0
+	int64 GetPeakBytes() const;
+
+	// False if the process did not reach a new peak inside the scope (the last GetPeakBytes), the peak is the current usage then
+	bool IsPeakAccurate() const { return bPeakAccurate; }
+
+protected:
+	int64 StartUsedBytes = 0;
+	int64 StartPeakUsedBytes = 0;
+	mutable bool bPeakAccurate = false;
+};
@@ -0,0 +1,194 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+
+#include "DlgBenchmarkTypes.h"
+#include "DlgIOTesterTypes.h"
+#include "DlgSystem/IO/DlgBinaryParser.h"
+#include "DlgSystem/IO/DlgBinaryWriter.h"
+#include "DlgSystem/IO/DlgJsonParser.h"
+#include "DlgSystem/IO/DlgJsonWriter.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDlgBinaryFormatBenchmark, All, All);
+DEFINE_LOG_CATEGORY(LogDlgBinaryFormatBenchmark);
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Total time of all the struct types for one format
+struct FDlgBinaryFormatBenchmarkTimes
+{
+	double WriteSeconds = 0.0;
+	double ReadSeconds = 0.0;
+	int32 NumOperations = 0;
+};
+
+class FDlgBinaryFormatBenchmark
+{
+public:
+	// The output of each format as it is saved to the text files: the JSON string and the raw bytes of the binary format
+	static void GetOutput(const FDlgJsonWriter& Writer, FString& OutText) { OutText = Writer.GetAsString(); }
+	static void GetOutput(const FDlgBinaryWriter& Writer, TArray<uint8>& OutBytes) { OutBytes = Writer.GetAsBytes(); }
+	static void InitializeParser(FDlgJsonParser& Parser, const FString& Text) { Parser.InitializeParserFromString(Text); }
+	static void InitializeParser(FDlgBinaryParser& Parser, const TArray<uint8>& Bytes) { Parser.InitializeParserFromBytes(TArray<uint8>(Bytes)); }
+
+	// Measures all the FDlgIOTester struct types with both formats
+	static void BenchmarkAllStructs(
+		const FDlgIOTesterOptions& Options,
+		int32 Iterations,
+		FDlgBinaryFormatBenchmarkTimes& OutJson,
+		FDlgBinaryFormatBenchmarkTimes& OutBinary,
+		TArray<FString>& OutErrors
+	);
+
+	template <typename StructType>
+	static void BenchmarkStruct(
+		const FString& StructDescription,
+		const FDlgIOTesterOptions& Options,
+		int32 Iterations,
+		FDlgBinaryFormatBenchmarkTimes& OutJson,
+		FDlgBinaryFormatBenchmarkTimes& OutBinary,
+		TArray<FString>& OutErrors
+	);
+
+	// Writes and reads the struct Iterations times with the Writer and Parser, the read struct must be the same
+	template <typename WriterType, typename ParserType, typename OutputType, typename StructType>
+	static bool BenchmarkFormat(
+		const StructType& Struct,
+		const FDlgIOTesterOptions& Options,
+		int32 Iterations,
+		FDlgBinaryFormatBenchmarkTimes& OutTimes,
+		FString& OutError
+	);
+};
+
+void FDlgBinaryFormatBenchmark::BenchmarkAllStructs(
+	const FDlgIOTesterOptions& Options,
+	int32 Iterations,
+	FDlgBinaryFormatBenchmarkTimes& OutJson,
+	FDlgBinaryFormatBenchmarkTimes& OutBinary,
+	TArray<FString>& OutErrors
+)
+{
+	BenchmarkStruct<FDlgTestStructPrimitives>(TEXT("Struct of Primitives"), Options, Iterations, OutJson, OutBinary, OutErrors);
+	BenchmarkStruct<FDlgTestStructComplex>(TEXT("Struct of Complex types"), Options, Iterations, OutJson, OutBinary, OutErrors);
+
+	BenchmarkStruct<FDlgTestArrayPrimitive>(TEXT("Array of Primitives"), Options, Iterations, OutJson, OutBinary, OutErrors);
+	BenchmarkStruct<FDlgTestArrayComplex>(TEXT("Array of Complex types"), Options, Iterations, OutJson, OutBinary, OutErrors);
+
+	BenchmarkStruct<FDlgTestSetPrimitive>(TEXT("Set of Primitives"), Options, Iterations, OutJson, OutBinary, OutErrors);
+	BenchmarkStruct<FDlgTestSetComplex>(TEXT("Set of Complex types"), Options, Iterations, OutJson, OutBinary, OutErrors);
+
+	BenchmarkStruct<FDlgTestMapPrimitive>(TEXT("Map with Primitives"), Options, Iterations, OutJson, OutBinary, OutErrors);
+	BenchmarkStruct<FDlgTestMapComplex>(TEXT("Map with Complex types"), Options, Iterations, OutJson, OutBinary, OutErrors);
+}
+
+template <typename StructType>
+void FDlgBinaryFormatBenchmark::BenchmarkStruct(
+	const FString& StructDescription,
+	const FDlgIOTesterOptions& Options,
+	int32 Iterations,
+	FDlgBinaryFormatBenchmarkTimes& OutJson,
+	FDlgBinaryFormatBenchmarkTimes& OutBinary,
+	TArray<FString>& OutErrors
+)
+{
+	StructType Struct;
+	Struct.GenerateRandomData(Options);
+
+	FString Error;
+	if (!BenchmarkFormat<FDlgJsonWriter, FDlgJsonParser, FString>(Struct, Options, Iterations, OutJson, Error))
+	{
+		OutErrors.Add(FString::Printf(TEXT("JSON, %s: %s"), *StructDescription, *Error));
+	}
+	if (!BenchmarkFormat<FDlgBinaryWriter, FDlgBinaryParser, TArray<uint8>>(Struct, Options, Iterations, OutBinary, Error))
+	{
+		OutErrors.Add(FString::Printf(TEXT("Binary, %s: %s"), *StructDescription, *Error));
+	}
+}
+
+template <typename WriterType, typename ParserType, typename OutputType, typename StructType>
+bool FDlgBinaryFormatBenchmark::BenchmarkFormat(
+	const StructType& Struct,
+	const FDlgIOTesterOptions& Options,
+	int32 Iterations,
+	FDlgBinaryFormatBenchmarkTimes& OutTimes,
+	FString& OutError
+)
+{
+	// Each format in the form the dialogue files use, the binary files are not Base64 encoded
+	OutputType Output;
+	const double WriteStartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Iterations; Index++)
+	{
+		WriterType Writer;
+		Writer.Write(StructType::StaticStruct(), &Struct);
+		GetOutput(Writer, Output);
+	}
+	OutTimes.WriteSeconds += FPlatformTime::Seconds() - WriteStartTime;
+
+	StructType ReadStruct;
+	ReadStruct.GenerateRandomData(Options);
+	const double ReadStartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Iterations; Index++)
+	{
+		ParserType Parser;
+		InitializeParser(Parser, Output);
+		Parser.ReadAllProperty(StructType::StaticStruct(), &ReadStruct);
+	}
+	OutTimes.ReadSeconds += FPlatformTime::Seconds() - ReadStartTime;
+	OutTimes.NumOperations += Iterations;
+
+	return Struct.IsEqual(ReadStruct, OutError);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgBinaryFormatBenchmarkTest,
+	"DlgSystem.Benchmarks.BinaryFormat",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FDlgBinaryFormatBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const UDlgBenchmarkSettings* Settings = GetDefault<UDlgBenchmarkSettings>();
+	const int32 Iterations = FMath::Max(Settings->Iterations, 1);
+
+	// Same options as the JSON IO tests, both formats must support all the generated data
+	FDlgIOTesterOptions Options;
+	Options.bSupportsDatePrimitive = false;
+	Options.bSupportsUObjectValueInMap = false;
+
+	FDlgBinaryFormatBenchmarkTimes JsonTimes;
+	FDlgBinaryFormatBenchmarkTimes BinaryTimes;
+	TArray<FString> RoundTripErrors;
+	FDlgBinaryFormatBenchmark::BenchmarkAllStructs(Options, Iterations, JsonTimes, BinaryTimes, RoundTripErrors);
+	for (const FString& Error : RoundTripErrors)
+	{
+		AddError(FString::Printf(TEXT("The read struct is different from the written one. %s"), *Error));
+	}
+
+	FDlgBenchmarkReport Report(TEXT("BinaryFormat"));
+	Report.AddResult(TEXT("JsonWrite"), 0, JsonTimes.NumOperations, JsonTimes.WriteSeconds);
+	Report.AddResult(TEXT("JsonRead"), 0, JsonTimes.NumOperations, JsonTimes.ReadSeconds);
+	Report.AddResult(TEXT("BinaryWrite"), 0, BinaryTimes.NumOperations, BinaryTimes.WriteSeconds);
+	Report.AddResult(TEXT("BinaryRead"), 0, BinaryTimes.NumOperations, BinaryTimes.ReadSeconds);
+
+	// The target is 10x, it depends on the machine so it is only a warning, use the thresholds to fail the CI
+	static constexpr double TargetSpeedup = 10.0;
+	const double WriteSpeedup = BinaryTimes.WriteSeconds > 0.0 ? JsonTimes.WriteSeconds / BinaryTimes.WriteSeconds : 0.0;
+	const double ReadSpeedup = BinaryTimes.ReadSeconds > 0.0 ? JsonTimes.ReadSeconds / BinaryTimes.ReadSeconds : 0.0;
+	UE_LOG(LogDlgBinaryFormatBenchmark, Display, TEXT("Binary speedup over JSON: write = %.2fx, read = %.2fx"), WriteSpeedup, ReadSpeedup);
+	if (WriteSpeedup < TargetSpeedup)
+	{
+		AddWarning(FString::Printf(TEXT("Binary write is only %.2fx faster than JSON, expected at least %.0fx"), WriteSpeedup, TargetSpeedup));
+	}
+	if (ReadSpeedup < TargetSpeedup)
+	{
+		AddWarning(FString::Printf(TEXT("Binary read is only %.2fx faster than JSON, expected at least %.0fx"), ReadSpeedup, TargetSpeedup));
+	}
+
+	return Report.ReportTo(*this) && !HasAnyErrors();
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,39 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+
+#include "DlgSystem/IO/DlgClassNameIndex.h"
+#include "DlgSystem/Nodes/DlgNode.h"
+#include "DlgSystem/Nodes/DlgNode_End.h"
+#include "DlgSystem/Nodes/DlgNode_Speech.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgClassNameIndexTest,
+	"DlgSystem.IO.ClassNameIndex",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FDlgClassNameIndexTest::RunTest(const FString& Parameters)
+{
+	FDlgClassNameIndex& Index = FDlgClassNameIndex::Get();
+	const UClass* NodeClass = UDlgNode::StaticClass();
+
+	TestTrue(TEXT("Finds a child class"), Index.FindChildClass(NodeClass, TEXT("DlgNode_Speech")) == UDlgNode_Speech::StaticClass());
+	TestTrue(TEXT("Finds it again from the index"), Index.FindChildClass(NodeClass, TEXT("DlgNode_Speech")) == UDlgNode_Speech::StaticClass());
+	TestTrue(TEXT("Names are case insensitive"), Index.FindChildClass(NodeClass, TEXT("dlgnode_speech")) == UDlgNode_Speech::StaticClass());
+	TestNull(TEXT("Abstract classes are ignored"), Index.FindChildClass(UObject::StaticClass(), TEXT("DlgNode")));
+	TestNull(TEXT("Not a child class"), Index.FindChildClass(UDlgNode_Speech::StaticClass(), TEXT("DlgNode_End")));
+	TestNull(TEXT("Not a child class again, from the names that were not found"), Index.FindChildClass(UDlgNode_Speech::StaticClass(), TEXT("DlgNode_End")));
+	TestTrue(TEXT("Not found for one parent class does not hide it for another"), Index.FindChildClass(NodeClass, TEXT("DlgNode_End")) == UDlgNode_End::StaticClass());
+	TestNull(TEXT("Unknown name"), Index.FindChildClass(NodeClass, TEXT("DlgNode_ThisClassDoesNotExist_1337")));
+
+	Index.Invalidate();
+	TestTrue(TEXT("Finds the child class after invalidation"), Index.FindChildClass(NodeClass, TEXT("DlgNode_Speech")) == UDlgNode_Speech::StaticClass());
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
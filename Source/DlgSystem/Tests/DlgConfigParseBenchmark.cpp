@@ -0,0 +1,97 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+
+#include "DlgBenchmarkTypes.h"
+#include "DlgDialogueGenerator.h"
+#include "DlgSystem/DlgDialogue.h"
+#include "DlgSystem/IO/DlgConfigParser.h"
+#include "DlgSystem/IO/DlgConfigWriter.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDlgConfigParseBenchmark, All, All);
+DEFINE_LOG_CATEGORY(LogDlgConfigParseBenchmark);
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class FDlgConfigParseBenchmark
+{
+public:
+	// Generates a dialogue of size NumNodes and returns it in the .dlg text format
+	static FString GenerateDlgText(int32 NumNodes, int32 Seed);
+
+	// Parses the text Iterations times, returns the total time spent parsing
+	static double BenchmarkParse(const FString& Text, int32 Iterations);
+};
+
+FString FDlgConfigParseBenchmark::GenerateDlgText(int32 NumNodes, int32 Seed)
+{
+	FDlgDialogueGeneratorOptions Options;
+	Options.Seed = Seed;
+	Options.NumNodes = NumNodes;
+	Options.NumParticipants = FMath::Clamp(NumNodes / 25, 2, 8);
+	const UDlgDialogue* Dialogue = FDlgDialogueGenerator::GenerateDialogue(Options);
+
+	FDlgConfigWriter DlgWriter(TEXT("Dlg"));
+	DlgWriter.Write(UDlgDialogue::StaticClass(), Dialogue);
+	return DlgWriter.GetAsString();
+}
+
+double FDlgConfigParseBenchmark::BenchmarkParse(const FString& Text, int32 Iterations)
+{
+	// Same parser for all iterations, like when importing many files
+	FDlgConfigParser Parser(TEXT("Dlg"));
+	double TotalSeconds = 0.0;
+	for (int32 Index = 0; Index < Iterations; Index++)
+	{
+		UDlgDialogue* Dialogue = NewObject<UDlgDialogue>(GetTransientPackage(), NAME_None, RF_Transient);
+		Dialogue->AddToRoot();
+
+		const double StartTime = FPlatformTime::Seconds();
+		Parser.InitializeParserFromString(Text);
+		Parser.ReadAllProperty(UDlgDialogue::StaticClass(), Dialogue, Dialogue);
+		TotalSeconds += FPlatformTime::Seconds() - StartTime;
+
+		Dialogue->RemoveFromRoot();
+	}
+
+	return TotalSeconds;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgConfigParseBenchmarkTest,
+	"DlgSystem.Benchmarks.ConfigParse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FDlgConfigParseBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const UDlgBenchmarkSettings* Settings = GetDefault<UDlgBenchmarkSettings>();
+	const int32 Iterations = FMath::Max(Settings->ConfigParseIterations, 1);
+
+	FDlgBenchmarkReport Report(TEXT("ConfigParse"));
+	TMap<int32, double> SizeToFileSizeMB;
+	for (const int32 NumNodes : Settings->DialogueSizes)
+	{
+		const FString Text = FDlgConfigParseBenchmark::GenerateDlgText(NumNodes, Settings->Seed);
+		SizeToFileSizeMB.Add(NumNodes, static_cast<double>(Text.Len()) / (1024.0 * 1024.0));
+		Report.AddResult(TEXT("Parse"), NumNodes, Iterations, FDlgConfigParseBenchmark::BenchmarkParse(Text, Iterations));
+	}
+
+	// The throughput, ReportTo logs the rest
+	for (const FDlgBenchmarkResult& Result : Report.GetResults())
+	{
+		const double SecondsPerOp = Result.NumOperations > 0 ? Result.TotalSeconds / Result.NumOperations : 0.0;
+		const double FileSizeMB = SizeToFileSizeMB.FindRef(Result.Size);
+		UE_LOG(
+			LogDlgConfigParseBenchmark, Display, TEXT("%s (Size = %d, %.2f MB): %.2f MB/s"),
+			*Result.Case, Result.Size, FileSizeMB, SecondsPerOp > 0.0 ? FileSizeMB / SecondsPerOp : 0.0
+		);
+	}
+
+	return Report.ReportTo(*this);
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
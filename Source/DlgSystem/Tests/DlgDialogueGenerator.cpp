@@ -0,0 +1,587 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgDialogueGenerator.h"
+
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+
+#include "DlgSystem/DlgDialogue.h"
+#include "DlgSystem/Nodes/DlgNode.h"
+#include "DlgSystem/Nodes/DlgNode_Start.h"
+#include "DlgSystem/Nodes/DlgNode_Speech.h"
+#include "DlgSystem/Nodes/DlgNode_SpeechSequence.h"
+#include "DlgSystem/Nodes/DlgNode_Selector.h"
+#include "DlgSystem/Nodes/DlgNode_Proxy.h"
+#include "DlgSystem/Nodes/DlgNode_End.h"
+#include "DlgSystem/NYReflectionHelper.h"
+
+namespace
+{
+	// The arrays/properties below are not exposed as mutable, reach them through reflection like the editor does
+	template <typename ValueType>
+	ValueType* GetMutableMemberValue(const UStruct* Struct, FName MemberName, void* ContainerPtr)
+	{
+		const FProperty* Property = Struct->FindPropertyByName(MemberName);
+		check(Property);
+		return Property->ContainerPtrToValuePtr<ValueType>(ContainerPtr);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FDlgDialogueGeneratorOptions
+FDlgDialogueGeneratorOptions::FDlgDialogueGeneratorOptions()
+{
+	ConditionTypeWeights.Add(EDlgConditionType::IntCall, 1.f);
+	ConditionTypeWeights.Add(EDlgConditionType::FloatCall, 1.f);
+	ConditionTypeWeights.Add(EDlgConditionType::BoolCall, 1.f);
+	ConditionTypeWeights.Add(EDlgConditionType::NameCall, 1.f);
+	ConditionTypeWeights.Add(EDlgConditionType::EventCall, 1.f);
+	ConditionTypeWeights.Add(EDlgConditionType::ClassIntVariable, 0.5f);
+	ConditionTypeWeights.Add(EDlgConditionType::ClassFloatVariable, 0.5f);
+	ConditionTypeWeights.Add(EDlgConditionType::ClassBoolVariable, 0.5f);
+	ConditionTypeWeights.Add(EDlgConditionType::ClassNameVariable, 0.5f);
+	ConditionTypeWeights.Add(EDlgConditionType::WasNodeVisited, 0.5f);
+	ConditionTypeWeights.Add(EDlgConditionType::HasSatisfiedChild, 0.25f);
+}
+
+FString FDlgDialogueGeneratorOptions::ToString() const
+{
+	return FString::Printf(
+		TEXT("Seed=%d, NumNodes=%d, NumParticipants=%d, Children=[%d, %d], SelectorRatio=%.2f, ProxyRatio=%.2f, SpeechSequenceRatio=%.2f, EndRatio=%.2f, CycleRatio=%.2f, EdgeConditionDensity=%.2f, EnterConditionDensity=%.2f, EnterEventDensity=%.2f, TextArgumentDensity=%.2f"),
+		Seed, NumNodes, NumParticipants, MinChildren, MaxChildren, SelectorRatio, ProxyRatio, SpeechSequenceRatio,
+		EndRatio, CycleRatio, EdgeConditionDensity, EnterConditionDensity, EnterEventDensity, TextArgumentDensity
+	);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// UDlgTestParticipant
+bool UDlgTestParticipant::CheckCondition_Implementation(const UDlgContext* Context, FName ConditionName) const
+{
+	NumInterfaceCalls++;
+	if (const bool* Value = Conditions.Find(ConditionName))
+	{
+		return *Value;
+	}
+
+	return bRandomizeUnknownValues ? RandomStream.FRand() < 0.5f : false;
+}
+
+float UDlgTestParticipant::GetFloatValue_Implementation(FName ValueName) const
+{
+	NumInterfaceCalls++;
+	if (const float* Value = FloatValues.Find(ValueName))
+	{
+		return *Value;
+	}
+
+	return bRandomizeUnknownValues ? RandomStream.FRandRange(-10.f, 10.f) : 0.f;
+}
+
+int32 UDlgTestParticipant::GetIntValue_Implementation(FName ValueName) const
+{
+	NumInterfaceCalls++;
+	if (const int32* Value = IntValues.Find(ValueName))
+	{
+		return *Value;
+	}
+
+	return bRandomizeUnknownValues ? RandomStream.RandRange(-10, 10) : 0;
+}
+
+bool UDlgTestParticipant::GetBoolValue_Implementation(FName ValueName) const
+{
+	NumInterfaceCalls++;
+	if (const bool* Value = BoolValues.Find(ValueName))
+	{
+		return *Value;
+	}
+
+	return bRandomizeUnknownValues ? RandomStream.FRand() < 0.5f : false;
+}
+
+FName UDlgTestParticipant::GetNameValue_Implementation(FName ValueName) const
+{
+	NumInterfaceCalls++;
+	if (const FName* Value = NameValues.Find(ValueName))
+	{
+		return *Value;
+	}
+
+	return bRandomizeUnknownValues ? FDlgDialogueGenerator::GetVariableName(TEXT("Name"), RandomStream.RandRange(0, 3)) : NAME_None;
+}
+
+bool UDlgTestParticipant::OnDialogueEvent_Implementation(UDlgContext* Context, FName EventName)
+{
+	NumInterfaceCalls++;
+	return true;
+}
+
+bool UDlgTestParticipant::ModifyFloatValue_Implementation(FName ValueName, bool bDelta, float Value)
+{
+	NumInterfaceCalls++;
+	float& CurrentValue = FloatValues.FindOrAdd(ValueName);
+	CurrentValue = bDelta ? CurrentValue + Value : Value;
+	return true;
+}
+
+bool UDlgTestParticipant::ModifyIntValue_Implementation(FName ValueName, bool bDelta, int32 Value)
+{
+	NumInterfaceCalls++;
+	int32& CurrentValue = IntValues.FindOrAdd(ValueName);
+	CurrentValue = bDelta ? CurrentValue + Value : Value;
+	return true;
+}
+
+bool UDlgTestParticipant::ModifyBoolValue_Implementation(FName ValueName, bool bNewValue)
+{
+	NumInterfaceCalls++;
+	BoolValues.Add(ValueName, bNewValue);
+	return true;
+}
+
+bool UDlgTestParticipant::ModifyNameValue_Implementation(FName ValueName, FName NameValue)
+{
+	NumInterfaceCalls++;
+	NameValues.Add(ValueName, NameValue);
+	return true;
+}
+
+void UDlgTestParticipant::ScriptValuesFromParticipantData(const FDlgParticipantData& Data)
+{
+	for (const FName Name : Data.Conditions)
+	{
+		Conditions.Add(Name, RandomStream.FRand() < 0.5f);
+	}
+	for (const FName Name : Data.IntVariableNames)
+	{
+		IntValues.Add(Name, RandomStream.RandRange(-10, 10));
+	}
+	for (const FName Name : Data.FloatVariableNames)
+	{
+		FloatValues.Add(Name, RandomStream.FRandRange(-10.f, 10.f));
+	}
+	for (const FName Name : Data.BoolVariableNames)
+	{
+		BoolValues.Add(Name, RandomStream.FRand() < 0.5f);
+	}
+	for (const FName Name : Data.NameVariableNames)
+	{
+		NameValues.Add(Name, FDlgDialogueGenerator::GetVariableName(TEXT("Name"), RandomStream.RandRange(0, 3)));
+	}
+}
+
+TArray<UObject*> UDlgTestParticipant::CreateParticipantsForDialogue(const UDlgDialogue* Dialogue, int32 Seed, bool bRandomizeUnknownValues, UObject* Outer)
+{
+	TArray<UObject*> Participants;
+	if (!Dialogue)
+	{
+		return Participants;
+	}
+
+	int32 ParticipantIndex = 0;
+	for (const auto& Elem : Dialogue->GetParticipantsData())
+	{
+		auto* Participant = NewObject<UDlgTestParticipant>(Outer ? Outer : GetTransientPackage(), NAME_None, RF_Transient);
+		Participant->ParticipantName = Elem.Key;
+		Participant->bRandomizeUnknownValues = bRandomizeUnknownValues;
+		Participant->SetRandomSeed(Seed + ParticipantIndex);
+		Participant->IntVariable = Participant->RandomStream.RandRange(-10, 10);
+		Participant->FloatVariable = Participant->RandomStream.FRandRange(-10.f, 10.f);
+		Participant->bBoolVariable = Participant->RandomStream.FRand() < 0.5f;
+		Participant->NameVariable = FDlgDialogueGenerator::GetVariableName(TEXT("Name"), Participant->RandomStream.RandRange(0, 3));
+		Participant->TextVariable = FText::FromName(Elem.Key);
+		Participants.Add(Participant);
+		ParticipantIndex++;
+	}
+
+	return Participants;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FDlgDialogueGenerator
+FDlgDialogueGenerator::FDlgDialogueGenerator(const FDlgDialogueGeneratorOptions& InOptions) : Options(InOptions)
+{
+	Options.NumNodes = FMath::Max(1, Options.NumNodes);
+	Options.NumParticipants = FMath::Max(1, Options.NumParticipants);
+	Options.NumVariableNames = FMath::Max(1, Options.NumVariableNames);
+	Options.MinChildren = FMath::Max(1, Options.MinChildren);
+	Options.MaxChildren = FMath::Max(Options.MinChildren, Options.MaxChildren);
+	Options.MaxConditionsPerArray = FMath::Max(1, Options.MaxConditionsPerArray);
+	Options.MaxTextArgumentsPerText = FMath::Max(1, Options.MaxTextArgumentsPerText);
+
+	float TotalWeight = 0.f;
+	for (const auto& Elem : Options.ConditionTypeWeights)
+	{
+		// Custom conditions need an user object, ignore them
+		if (Elem.Value <= 0.f || Elem.Key == EDlgConditionType::Custom)
+		{
+			continue;
+		}
+
+		TotalWeight += Elem.Value;
+		ConditionTypes.Add(Elem.Key);
+		ConditionTypesCumulativeWeights.Add(TotalWeight);
+	}
+}
+
+FName FDlgDialogueGenerator::GetParticipantName(int32 Index)
+{
+	return FName(*FString::Printf(TEXT("Participant_%d"), Index));
+}
+
+FName FDlgDialogueGenerator::GetVariableName(const TCHAR* Prefix, int32 Index)
+{
+	return FName(*FString::Printf(TEXT("%s_%d"), Prefix, Index));
+}
+
+int32 FDlgDialogueGenerator::RandomTargetIndex(int32 SourceIndex, bool bAllowCycles)
+{
+	const int32 LastIndex = Options.NumNodes - 1;
+	if (bAllowCycles && SourceIndex >= 0 && RandomChance(Options.CycleRatio))
+	{
+		return RandomStream.RandRange(0, SourceIndex);
+	}
+
+	// Forward, start node can point to anything
+	const int32 FirstCandidate = FMath::Min(SourceIndex + 1, LastIndex);
+	if (bAllowCycles)
+	{
+		return RandomStream.RandRange(FirstCandidate, LastIndex);
+	}
+
+	// Skip proxies, fallback to the first end node which always exists
+	for (int32 Try = 0; Try < 4; Try++)
+	{
+		const int32 TargetIndex = RandomStream.RandRange(FirstCandidate, LastIndex);
+		if (!IsProxyNode[TargetIndex])
+		{
+			return TargetIndex;
+		}
+	}
+	return FirstEndNodeIndex;
+}
+
+FDlgCondition FDlgDialogueGenerator::RandomCondition(int32 NumNodes)
+{
+	FDlgCondition Condition;
+	if (ConditionTypes.Num() == 0)
+	{
+		return Condition;
+	}
+
+	// Weighted pick
+	const float Pick = RandomStream.FRandRange(0.f, ConditionTypesCumulativeWeights.Last());
+	int32 TypeIndex = 0;
+	while (TypeIndex < ConditionTypes.Num() - 1 && ConditionTypesCumulativeWeights[TypeIndex] < Pick)
+	{
+		TypeIndex++;
+	}
+
+	Condition.ConditionType = ConditionTypes[TypeIndex];
+	Condition.Strength = RandomChance(0.25f) ? EDlgConditionStrength::Weak : EDlgConditionStrength::Strong;
+	Condition.ParticipantName = RandomParticipantName();
+	Condition.Operation = static_cast<EDlgOperation>(RandomStream.RandRange(0, static_cast<int32>(EDlgOperation::GreaterOrEqual)));
+	Condition.IntValue = RandomStream.RandRange(-10, 10);
+	Condition.FloatValue = RandomStream.FRandRange(-10.f, 10.f);
+	Condition.bBoolValue = RandomChance(0.5f);
+	Condition.NameValue = RandomVariableName(TEXT("Name"));
+
+	switch (Condition.ConditionType)
+	{
+		case EDlgConditionType::IntCall:
+			Condition.CallbackName = RandomVariableName(TEXT("Int"));
+			break;
+		case EDlgConditionType::FloatCall:
+			Condition.CallbackName = RandomVariableName(TEXT("Float"));
+			break;
+		case EDlgConditionType::BoolCall:
+			Condition.CallbackName = RandomVariableName(TEXT("Bool"));
+			break;
+		case EDlgConditionType::NameCall:
+			Condition.CallbackName = RandomVariableName(TEXT("Name"));
+			break;
+		case EDlgConditionType::EventCall:
+			Condition.CallbackName = RandomVariableName(TEXT("Condition"));
+			break;
+		case EDlgConditionType::ClassIntVariable:
+			Condition.CallbackName = UDlgTestParticipant::GetMemberNameIntVariable();
+			break;
+		case EDlgConditionType::ClassFloatVariable:
+			Condition.CallbackName = UDlgTestParticipant::GetMemberNameFloatVariable();
+			break;
+		case EDlgConditionType::ClassBoolVariable:
+			Condition.CallbackName = UDlgTestParticipant::GetMemberNameBoolVariable();
+			break;
+		case EDlgConditionType::ClassNameVariable:
+			Condition.CallbackName = UDlgTestParticipant::GetMemberNameNameVariable();
+			break;
+		case EDlgConditionType::WasNodeVisited:
+		case EDlgConditionType::HasSatisfiedChild:
+			Condition.IntValue = RandomStream.RandRange(0, NumNodes - 1);
+			Condition.bLongTermMemory = RandomChance(0.5f);
+			break;
+		default:
+			break;
+	}
+
+	// Some of the value conditions compare against another participant
+	if (FDlgCondition::HasDialogueValue(Condition.ConditionType) && RandomChance(0.1f))
+	{
+		Condition.CompareType = EDlgCompare::ToVariable;
+		Condition.OtherParticipantName = RandomParticipantName();
+		Condition.OtherVariableName = Condition.CallbackName;
+	}
+
+	return Condition;
+}
+
+void FDlgDialogueGenerator::RandomConditions(TArray<FDlgCondition>& OutConditions, float Density, int32 NumNodes)
+{
+	if (!RandomChance(Density))
+	{
+		return;
+	}
+
+	const int32 NumConditions = RandomStream.RandRange(1, Options.MaxConditionsPerArray);
+	for (int32 Index = 0; Index < NumConditions; Index++)
+	{
+		OutConditions.Add(RandomCondition(NumNodes));
+	}
+}
+
+void FDlgDialogueGenerator::RandomEvents(TArray<FDlgEvent>& OutEvents)
+{
+	if (!RandomChance(Options.EnterEventDensity))
+	{
+		return;
+	}
+
+	FDlgEvent Event;
+	Event.ParticipantName = RandomParticipantName();
+	Event.EventType = static_cast<EDlgEventType>(RandomStream.RandRange(0, static_cast<int32>(EDlgEventType::ModifyName)));
+	Event.bDelta = RandomChance(0.5f);
+	Event.bValue = RandomChance(0.5f);
+	Event.IntValue = RandomStream.RandRange(-10, 10);
+	Event.FloatValue = RandomStream.FRandRange(-10.f, 10.f);
+	Event.NameValue = RandomVariableName(TEXT("Name"));
+	switch (Event.EventType)
+	{
+		case EDlgEventType::ModifyInt:
+			Event.EventName = RandomVariableName(TEXT("Int"));
+			break;
+		case EDlgEventType::ModifyFloat:
+			Event.EventName = RandomVariableName(TEXT("Float"));
+			break;
+		case EDlgEventType::ModifyBool:
+			Event.EventName = RandomVariableName(TEXT("Bool"));
+			break;
+		case EDlgEventType::ModifyName:
+			Event.EventName = RandomVariableName(TEXT("Name"));
+			break;
+		default:
+			Event.EventName = RandomVariableName(TEXT("Event"));
+			break;
+	}
+
+	OutEvents.Add(Event);
+}
+
+FText FDlgDialogueGenerator::RandomText(const TCHAR* Prefix, int32 Index)
+{
+	FString Text = FString::Printf(TEXT("%s %d"), Prefix, Index);
+	if (RandomChance(Options.TextArgumentDensity))
+	{
+		const int32 NumArguments = RandomStream.RandRange(1, Options.MaxTextArgumentsPerText);
+		for (int32 ArgumentIndex = 0; ArgumentIndex < NumArguments; ArgumentIndex++)
+		{
+			Text += FString::Printf(TEXT(" {Arg%d}"), ArgumentIndex);
+		}
+	}
+
+	return FText::FromString(Text);
+}
+
+void FDlgDialogueGenerator::FillTextArguments(TArray<FDlgTextArgument>& InOutArguments)
+{
+	for (FDlgTextArgument& Argument : InOutArguments)
+	{
+		Argument.ParticipantName = RandomParticipantName();
+		Argument.Type = static_cast<EDlgTextArgumentType>(RandomStream.RandRange(0, static_cast<int32>(EDlgTextArgumentType::ClassText)));
+		switch (Argument.Type)
+		{
+			case EDlgTextArgumentType::DialogueInt:
+				Argument.VariableName = RandomVariableName(TEXT("Int"));
+				break;
+			case EDlgTextArgumentType::DialogueFloat:
+				Argument.VariableName = RandomVariableName(TEXT("Float"));
+				break;
+			case EDlgTextArgumentType::ClassInt:
+				Argument.VariableName = UDlgTestParticipant::GetMemberNameIntVariable();
+				break;
+			case EDlgTextArgumentType::ClassFloat:
+				Argument.VariableName = UDlgTestParticipant::GetMemberNameFloatVariable();
+				break;
+			case EDlgTextArgumentType::ClassText:
+				Argument.VariableName = UDlgTestParticipant::GetMemberNameTextVariable();
+				break;
+			default:
+				break;
+		}
+	}
+}
+
+void FDlgDialogueGenerator::GenerateChildren(UDlgNode* Node, int32 NodeIndex, bool bAllowCycles)
+{
+	const int32 NumChildren = RandomStream.RandRange(Options.MinChildren, Options.MaxChildren);
+	TSet<int32> UsedTargets;
+	for (int32 ChildIndex = 0; ChildIndex < NumChildren; ChildIndex++)
+	{
+		const int32 TargetIndex = RandomTargetIndex(NodeIndex, bAllowCycles);
+		if (UsedTargets.Contains(TargetIndex))
+		{
+			continue;
+		}
+		UsedTargets.Add(TargetIndex);
+
+		FDlgEdge Edge(TargetIndex);
+		RandomConditions(Edge.Conditions, Options.EdgeConditionDensity, Options.NumNodes);
+		Edge.SetText(RandomText(TEXT("Option"), ChildIndex));
+		FillTextArguments(*GetMutableMemberValue<TArray<FDlgTextArgument>>(FDlgEdge::StaticStruct(), FDlgEdge::GetMemberNameTextArguments(), &Edge));
+		Node->AddNodeChild(Edge);
+	}
+
+	// Make sure the last child is always satisfiable so that not every path ends instantly
+	if (Node->GetNumNodeChildren() > 0)
+	{
+		Node->GetMutableNodeChildAt(Node->GetNumNodeChildren() - 1)->Conditions.Empty();
+	}
+}
+
+UDlgDialogue* FDlgDialogueGenerator::Generate(UObject* Outer)
+{
+	RandomStream.Initialize(Options.Seed);
+
+	const int32 NumNodes = Options.NumNodes;
+	const int32 NumEndNodes = FMath::Clamp(FMath::RoundToInt(NumNodes * Options.EndRatio), 1, NumNodes);
+	FirstEndNodeIndex = NumNodes - NumEndNodes;
+
+	auto* Dialogue = NewObject<UDlgDialogue>(Outer ? Outer : GetTransientPackage(), NAME_None, RF_Transient);
+#if WITH_EDITOR
+	Dialogue->DisableCompileDialogue();
+#endif
+	if (!Dialogue->HasGUID())
+	{
+		Dialogue->RegenerateGUID();
+	}
+
+	// Decide the types first so that proxies/selectors know what they can target
+	enum class ENodeKind : uint8 { Speech, SpeechSequence, Selector, Proxy, End };
+	TArray<ENodeKind> Kinds;
+	Kinds.SetNum(NumNodes);
+	IsProxyNode.Init(false, NumNodes);
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
+	{
+		if (NodeIndex >= FirstEndNodeIndex)
+		{
+			Kinds[NodeIndex] = ENodeKind::End;
+			continue;
+		}
+
+		const float Pick = RandomStream.FRand();
+		if (Pick < Options.ProxyRatio)
+		{
+			Kinds[NodeIndex] = ENodeKind::Proxy;
+			IsProxyNode[NodeIndex] = true;
+		}
+		else if (Pick < Options.ProxyRatio + Options.SelectorRatio)
+		{
+			Kinds[NodeIndex] = ENodeKind::Selector;
+		}
+		else if (Pick < Options.ProxyRatio + Options.SelectorRatio + Options.SpeechSequenceRatio)
+		{
+			Kinds[NodeIndex] = ENodeKind::SpeechSequence;
+		}
+		else
+		{
+			Kinds[NodeIndex] = ENodeKind::Speech;
+		}
+	}
+
+	TArray<UDlgNode*> Nodes;
+	Nodes.Reserve(NumNodes);
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
+	{
+		UDlgNode* Node = nullptr;
+		switch (Kinds[NodeIndex])
+		{
+			case ENodeKind::Speech:
+			{
+				auto* SpeechNode = Dialogue->ConstructDialogueNode<UDlgNode_Speech>();
+				SpeechNode->SetNodeText(RandomText(TEXT("Line"), NodeIndex));
+				FillTextArguments(*GetMutableMemberValue<TArray<FDlgTextArgument>>(UDlgNode_Speech::StaticClass(), UDlgNode_Speech::GetMemberNameTextArguments(), SpeechNode));
+				SpeechNode->SetSpeakerState(RandomVariableName(TEXT("State")));
+				Node = SpeechNode;
+				GenerateChildren(Node, NodeIndex, true);
+				break;
+			}
+			case ENodeKind::SpeechSequence:
+			{
+				auto* SequenceNode = Dialogue->ConstructDialogueNode<UDlgNode_SpeechSequence>();
+				const int32 NumEntries = RandomStream.RandRange(2, 4);
+				for (int32 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
+				{
+					FDlgSpeechSequenceEntry Entry;
+					Entry.Speaker = RandomParticipantName();
+					Entry.Text = FText::FromString(FString::Printf(TEXT("Sequence %d Line %d"), NodeIndex, EntryIndex));
+					Entry.EdgeText = FText::FromString(TEXT("Next"));
+					Entry.SpeakerState = RandomVariableName(TEXT("State"));
+					SequenceNode->GetMutableNodeSpeechSequence()->Add(Entry);
+				}
+				SequenceNode->AutoGenerateInnerEdges();
+				Node = SequenceNode;
+				GenerateChildren(Node, NodeIndex, true);
+				break;
+			}
+			case ENodeKind::Selector:
+			{
+				auto* SelectorNode = Dialogue->ConstructDialogueNode<UDlgNode_Selector>();
+				SelectorNode->SetSelectorType(RandomChance(0.5f) ? EDlgNodeSelectorType::First : EDlgNodeSelectorType::Random);
+				Node = SelectorNode;
+				GenerateChildren(Node, NodeIndex, false);
+				break;
+			}
+			case ENodeKind::Proxy:
+			{
+				auto* ProxyNode = Dialogue->ConstructDialogueNode<UDlgNode_Proxy>();
+				*GetMutableMemberValue<int32>(UDlgNode_Proxy::StaticClass(), UDlgNode_Proxy::GetMemberNameNodeIndex(), ProxyNode) = RandomTargetIndex(NodeIndex, false);
+				Node = ProxyNode;
+				break;
+			}
+			case ENodeKind::End:
+			{
+				Node = Dialogue->ConstructDialogueNode<UDlgNode_End>();
+				break;
+			}
+		}
+		check(Node);
+
+		Node->SetNodeParticipantName(RandomParticipantName());
+		TArray<FDlgCondition> EnterConditions;
+		RandomConditions(EnterConditions, Options.EnterConditionDensity, NumNodes);
+		Node->SetNodeEnterConditions(EnterConditions);
+		TArray<FDlgEvent> EnterEvents;
+		RandomEvents(EnterEvents);
+		Node->SetNodeEnterEvents(EnterEvents);
+		Node->RegenerateGUID();
+		Nodes.Add(Node);
+	}
+
+	// Start node points to the first few nodes
+	auto* StartNode = Dialogue->ConstructDialogueNode<UDlgNode_Start>();
+	StartNode->SetNodeParticipantName(GetParticipantName(0));
+	GenerateChildren(StartNode, INDEX_NONE, false);
+
+	Dialogue->SetNodes(Nodes);
+	Dialogue->SetStartNodes({StartNode});
+	Dialogue->UpdateAndRefreshData(false);
+	return Dialogue;
+}
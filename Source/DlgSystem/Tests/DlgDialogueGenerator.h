@@ -0,0 +1,255 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+
+#include "DlgSystem/DlgCondition.h"
+#include "DlgSystem/DlgEvent.h"
+#include "DlgSystem/DlgTextArgument.h"
+#include "DlgSystem/DlgDialogueParticipant.h"
+#include "DlgSystem/DlgDialogueParticipantData.h"
+
+#include "DlgDialogueGenerator.generated.h"
+
+class UDlgDialogue;
+class UDlgNode;
+
+
+// Parameters for FDlgDialogueGenerator, all ratios/densities are probabilities in the [0, 1] interval
+USTRUCT()
+struct DLGSYSTEM_API FDlgDialogueGeneratorOptions
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	FDlgDialogueGeneratorOptions();
+
+	// Same seed + same options = same dialogue
+	UPROPERTY()
+	int32 Seed = 0;
+
+	// Number of nodes (not counting the start node)
+	UPROPERTY()
+	int32 NumNodes = 100;
+
+	// Number of unique participants used by the nodes
+	UPROPERTY()
+	int32 NumParticipants = 2;
+
+	// Branching factor, the number of children of each non end node is in [MinChildren, MaxChildren]
+	UPROPERTY()
+	int32 MinChildren = 1;
+
+	UPROPERTY()
+	int32 MaxChildren = 3;
+
+	// Chance of a node to be a selector/proxy/speech sequence, the rest are speech nodes
+	UPROPERTY()
+	float SelectorRatio = 0.05f;
+
+	UPROPERTY()
+	float ProxyRatio = 0.05f;
+
+	UPROPERTY()
+	float SpeechSequenceRatio = 0.1f;
+
+	// Percentage of the nodes (the last ones) that are end nodes, at least one is always generated
+	UPROPERTY()
+	float EndRatio = 0.05f;
+
+	// Chance of an edge to point backwards (to an already generated node) instead of forward
+	// NOTE: selectors and proxies only point forward so that the generated graph can't loop without a player choice
+	UPROPERTY()
+	float CycleRatio = 0.1f;
+
+	// Chance of each edge/node to have conditions
+	UPROPERTY()
+	float EdgeConditionDensity = 0.3f;
+
+	UPROPERTY()
+	float EnterConditionDensity = 0.1f;
+
+	// Max number of conditions generated once an edge/node was selected to have conditions
+	UPROPERTY()
+	int32 MaxConditionsPerArray = 2;
+
+	// Relative weight of each condition type, types not in the map are never generated
+	UPROPERTY()
+	TMap<EDlgConditionType, float> ConditionTypeWeights;
+
+	// Chance of each node to have enter events
+	UPROPERTY()
+	float EnterEventDensity = 0.1f;
+
+	// Chance of each text (node and edge) to have text arguments
+	UPROPERTY()
+	float TextArgumentDensity = 0.2f;
+
+	UPROPERTY()
+	int32 MaxTextArgumentsPerText = 2;
+
+	// Number of unique variable names per type (int, float, bool, name, condition, event)
+	UPROPERTY()
+	int32 NumVariableNames = 8;
+
+public:
+	FString ToString() const;
+};
+
+
+/**
+ * Participant used by the tests/benchmarks/soak tests.
+ * Returns the scripted values for the known variable names and random (or default) values for everything else.
+ */
+UCLASS()
+class DLGSYSTEM_API UDlgTestParticipant : public UObject, public IDlgDialogueParticipant
+{
+	GENERATED_BODY()
+	typedef UDlgTestParticipant Self;
+
+public:
+	//
+	// IDlgDialogueParticipant Interface
+	//
+
+	FName GetParticipantName_Implementation() const override { return ParticipantName; }
+	FText GetParticipantDisplayName_Implementation(FName ActiveSpeaker) const override { return FText::FromName(ParticipantName); }
+	ETextGender GetParticipantGender_Implementation() const override { return ETextGender::Neuter; }
+	UTexture2D* GetParticipantIcon_Implementation(FName ActiveSpeaker, FName ActiveSpeakerState) const override { return nullptr; }
+
+	bool CheckCondition_Implementation(const UDlgContext* Context, FName ConditionName) const override;
+	float GetFloatValue_Implementation(FName ValueName) const override;
+	int32 GetIntValue_Implementation(FName ValueName) const override;
+	bool GetBoolValue_Implementation(FName ValueName) const override;
+	FName GetNameValue_Implementation(FName ValueName) const override;
+
+	bool OnDialogueEvent_Implementation(UDlgContext* Context, FName EventName) override;
+	bool ModifyFloatValue_Implementation(FName ValueName, bool bDelta, float Value) override;
+	bool ModifyIntValue_Implementation(FName ValueName, bool bDelta, int32 Value) override;
+	bool ModifyBoolValue_Implementation(FName ValueName, bool bNewValue) override;
+	bool ModifyNameValue_Implementation(FName ValueName, FName NameValue) override;
+
+	//
+	// Own functions
+	//
+
+	// Reseeds the random values of this participant
+	void SetRandomSeed(int32 Seed) { RandomStream.Initialize(Seed); }
+
+	// Gives every condition and variable used by the Data a scripted value (picked with the random stream),
+	// so they no longer depend on bRandomizeUnknownValues
+	void ScriptValuesFromParticipantData(const FDlgParticipantData& Data);
+
+	// Creates one participant for each participant of the Dialogue, the result can be passed to UDlgManager::StartDialogue
+	static TArray<UObject*> CreateParticipantsForDialogue(const UDlgDialogue* Dialogue, int32 Seed, bool bRandomizeUnknownValues = true, UObject* Outer = nullptr);
+
+	// Number of times any of the interface methods was called on this participant
+	int32 GetNumInterfaceCalls() const { return NumInterfaceCalls; }
+
+	// Helper functions to get the names of the class variables, used by the generator
+	static FName GetMemberNameIntVariable() { return GET_MEMBER_NAME_CHECKED(UDlgTestParticipant, IntVariable); }
+	static FName GetMemberNameFloatVariable() { return GET_MEMBER_NAME_CHECKED(UDlgTestParticipant, FloatVariable); }
+	static FName GetMemberNameBoolVariable() { return GET_MEMBER_NAME_CHECKED(UDlgTestParticipant, bBoolVariable); }
+	static FName GetMemberNameNameVariable() { return GET_MEMBER_NAME_CHECKED(UDlgTestParticipant, NameVariable); }
+	static FName GetMemberNameTextVariable() { return GET_MEMBER_NAME_CHECKED(UDlgTestParticipant, TextVariable); }
+
+public:
+	UPROPERTY()
+	FName ParticipantName;
+
+	// If false the unknown values return the default values (0, false, NAME_None)
+	UPROPERTY()
+	bool bRandomizeUnknownValues = true;
+
+	// Scripted values
+	UPROPERTY()
+	TMap<FName, bool> Conditions;
+
+	UPROPERTY()
+	TMap<FName, int32> IntValues;
+
+	UPROPERTY()
+	TMap<FName, float> FloatValues;
+
+	UPROPERTY()
+	TMap<FName, bool> BoolValues;
+
+	UPROPERTY()
+	TMap<FName, FName> NameValues;
+
+	// Class variables
+	UPROPERTY()
+	int32 IntVariable = 0;
+
+	UPROPERTY()
+	double FloatVariable = 0.0;
+
+	UPROPERTY()
+	bool bBoolVariable = false;
+
+	UPROPERTY()
+	FName NameVariable;
+
+	UPROPERTY()
+	FText TextVariable;
+
+protected:
+	mutable FRandomStream RandomStream;
+	mutable int32 NumInterfaceCalls = 0;
+};
+
+
+/**
+ * Builds synthetic dialogues programmatically, used by the benchmarks.
+ * The generated dialogue only has runtime data (no graph), so it should not be saved.
+ */
+class DLGSYSTEM_API FDlgDialogueGenerator
+{
+public:
+	FDlgDialogueGenerator(const FDlgDialogueGeneratorOptions& InOptions);
+
+	// Generates a new transient dialogue inside Outer (transient package if nullptr)
+	UDlgDialogue* Generate(UObject* Outer = nullptr);
+
+	// Static helper
+	static UDlgDialogue* GenerateDialogue(const FDlgDialogueGeneratorOptions& Options, UObject* Outer = nullptr)
+	{
+		FDlgDialogueGenerator Generator(Options);
+		return Generator.Generate(Outer);
+	}
+
+	// Names used by the generator
+	static FName GetParticipantName(int32 Index);
+	static FName GetVariableName(const TCHAR* Prefix, int32 Index);
+
+protected:
+	bool RandomChance(float Probability) { return Probability > 0.f && RandomStream.FRand() < Probability; }
+	FName RandomParticipantName() { return GetParticipantName(RandomStream.RandRange(0, Options.NumParticipants - 1)); }
+	FName RandomVariableName(const TCHAR* Prefix) { return GetVariableName(Prefix, RandomStream.RandRange(0, Options.NumVariableNames - 1)); }
+
+	// Target for an edge from SourceIndex
+	int32 RandomTargetIndex(int32 SourceIndex, bool bAllowCycles);
+
+	FDlgCondition RandomCondition(int32 NumNodes);
+	void RandomConditions(TArray<FDlgCondition>& OutConditions, float Density, int32 NumNodes);
+	void RandomEvents(TArray<FDlgEvent>& OutEvents);
+
+	// Text with some optional {ArgX} arguments, FillTextArguments sets up the types of the arguments
+	FText RandomText(const TCHAR* Prefix, int32 Index);
+	void FillTextArguments(TArray<FDlgTextArgument>& InOutArguments);
+
+	void GenerateChildren(UDlgNode* Node, int32 NodeIndex, bool bAllowCycles);
+
+protected:
+	FDlgDialogueGeneratorOptions Options;
+	FRandomStream RandomStream;
+
+	// Cached from the options
+	TArray<EDlgConditionType> ConditionTypes;
+	TArray<float> ConditionTypesCumulativeWeights;
+
+	// Proxies are never the target of other proxies/selectors, otherwise they could loop without any player choice
+	TArray<bool> IsProxyNode;
+	int32 FirstEndNodeIndex = INDEX_NONE;
+};
@@ -0,0 +1,55 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+
+#include "DlgIOTesterTypes.h"
+#include "DlgSystem/IO/DlgHashWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+template <typename StructType>
+static uint64 GetDlgHash(const StructType& Struct, uint64 Seed = 0)
+{
+	FDlgHashWriter HashWriter(Seed);
+	HashWriter.Write(StructType::StaticStruct(), &Struct);
+	return HashWriter.GetHash();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgHashWriterTest,
+	"DlgSystem.IO.HashWriter",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FDlgHashWriterTest::RunTest(const FString& Parameters)
+{
+	FDlgIOTesterOptions Options;
+	FDlgTestStructPrimitives Primitives;
+	Primitives.GenerateRandomData(Options);
+	FDlgTestStructPrimitives SamePrimitives = Primitives;
+	TestTrue(TEXT("Same data has the same hash"), GetDlgHash(SamePrimitives) == GetDlgHash(Primitives));
+	TestTrue(TEXT("The seed changes the hash"), GetDlgHash(Primitives, 1) != GetDlgHash(Primitives));
+
+	SamePrimitives.Integer32++;
+	TestTrue(TEXT("Changed integer"), GetDlgHash(SamePrimitives) != GetDlgHash(Primitives));
+	SamePrimitives = Primitives;
+	SamePrimitives.String += TEXT("!");
+	TestTrue(TEXT("Changed string"), GetDlgHash(SamePrimitives) != GetDlgHash(Primitives));
+	SamePrimitives = Primitives;
+	SamePrimitives.Name = *(Primitives.Name.ToString() + TEXT("_Changed"));
+	TestTrue(TEXT("Changed name"), GetDlgHash(SamePrimitives) != GetDlgHash(Primitives));
+
+#if WITH_CASE_PRESERVING_NAME
+	// The text files keep the case of the names, the same writer must not reuse the hash of a name that only differs in case
+	FDlgTestArrayPrimitive SameCaseNames;
+	SameCaseNames.NameArray = { TEXT("DlgHashWriterTestName"), TEXT("DlgHashWriterTestName") };
+	FDlgTestArrayPrimitive DifferentCaseNames;
+	DifferentCaseNames.NameArray = { TEXT("DlgHashWriterTestName"), TEXT("DLGHASHWRITERTESTNAME") };
+	TestTrue(TEXT("Changed case of a name"), GetDlgHash(SameCaseNames) != GetDlgHash(DifferentCaseNames));
+#endif
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -9,12 +9,28 @@
 #include "DlgSystem/IO/DlgConfigParser.h"
 #include "DlgSystem/IO/DlgJsonParser.h"
 #include "DlgSystem/IO/DlgJsonWriter.h"
+#include "DlgSystem/IO/DlgBinaryParser.h"
+#include "DlgSystem/IO/DlgBinaryWriter.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogDlgIOTester, All, All);
 DEFINE_LOG_CATEGORY(LogDlgIOTester);
 
 #if WITH_DEV_AUTOMATION_TESTS
 
+// The JSON parser that builds the JSON DOM first, the default one streams
+class FDlgJsonDOMParser : public FDlgJsonParser
+{
+public:
+	FDlgJsonDOMParser() { SetUseStreaming(false); }
+};
+
+// The JSON writer that builds the JSON DOM first, the default one streams
+class FDlgJsonDOMWriter : public FDlgJsonWriter
+{
+public:
+	FDlgJsonDOMWriter() { SetUseStreaming(false); }
+};
+
 class FDlgIOTester
 {
 public:
@@ -38,6 +54,24 @@ public:
 		const FString NameWriterType = FString(),
 		const FString NameParserType = FString()
 	);
+
+	// Tests that both writers produce exactly the same output
+	template <typename ConfigWriterType, typename OtherConfigWriterType>
+	static bool TestSameWriterOutput(
+		FAutomationTestBase& Test,
+		const FDlgIOTesterOptions& Options,
+		const FString NameWriterType,
+		const FString NameOtherWriterType
+	);
+
+	template <typename ConfigWriterType, typename OtherConfigWriterType, typename StructType>
+	static bool TestSameStructOutput(
+		FAutomationTestBase& Test,
+		const FString& StructDescription,
+		const FDlgIOTesterOptions& Options,
+		const FString NameWriterType,
+		const FString NameOtherWriterType
+	);
 };
 
 
@@ -122,6 +156,60 @@ bool FDlgIOTester::TestStruct(
 	return false;
 }
 
+template <typename ConfigWriterType, typename OtherConfigWriterType>
+bool FDlgIOTester::TestSameWriterOutput(
+	FAutomationTestBase& Test,
+	const FDlgIOTesterOptions& Options,
+	const FString NameWriterType,
+	const FString NameOtherWriterType
+)
+{
+	bool bAllSucceeded = true;
+
+	bAllSucceeded &= TestSameStructOutput<ConfigWriterType, OtherConfigWriterType, FDlgTestStructPrimitives>(Test, "Struct of Primitives", Options, NameWriterType, NameOtherWriterType);
+	bAllSucceeded &= TestSameStructOutput<ConfigWriterType, OtherConfigWriterType, FDlgTestStructComplex>(Test, "Struct of Complex types", Options, NameWriterType, NameOtherWriterType);
+
+	bAllSucceeded &= TestSameStructOutput<ConfigWriterType, OtherConfigWriterType, FDlgTestArrayPrimitive>(Test, "Array of Primitives", Options, NameWriterType, NameOtherWriterType);
+	bAllSucceeded &= TestSameStructOutput<ConfigWriterType, OtherConfigWriterType, FDlgTestArrayComplex>(Test, "Array of Complex types", Options, NameWriterType, NameOtherWriterType);
+
+	bAllSucceeded &= TestSameStructOutput<ConfigWriterType, OtherConfigWriterType, FDlgTestSetPrimitive>(Test, "Set of Primitives", Options, NameWriterType, NameOtherWriterType);
+	bAllSucceeded &= TestSameStructOutput<ConfigWriterType, OtherConfigWriterType, FDlgTestSetComplex>(Test, "Set of Complex types", Options, NameWriterType, NameOtherWriterType);
+
+	bAllSucceeded &= TestSameStructOutput<ConfigWriterType, OtherConfigWriterType, FDlgTestMapPrimitive>(Test, "Map with Primitives", Options, NameWriterType, NameOtherWriterType);
+	bAllSucceeded &= TestSameStructOutput<ConfigWriterType, OtherConfigWriterType, FDlgTestMapComplex>(Test, "Map with Complex types", Options, NameWriterType, NameOtherWriterType);
+
+	return bAllSucceeded;
+}
+
+template <typename ConfigWriterType, typename OtherConfigWriterType, typename StructType>
+bool FDlgIOTester::TestSameStructOutput(
+	FAutomationTestBase& Test,
+	const FString& StructDescription,
+	const FDlgIOTesterOptions& Options,
+	const FString NameWriterType,
+	const FString NameOtherWriterType
+)
+{
+	StructType ExportedStruct;
+	ExportedStruct.GenerateRandomData(Options);
+
+	ConfigWriterType Writer;
+	Writer.Write(StructType::StaticStruct(), &ExportedStruct);
+	OtherConfigWriterType OtherWriter;
+	OtherWriter.Write(StructType::StaticStruct(), &ExportedStruct);
+
+	if (Writer.GetAsString().Equals(OtherWriter.GetAsString(), ESearchCase::CaseSensitive))
+	{
+		return true;
+	}
+
+	UE_LOG(LogDlgIOTester, Warning, TEXT("Writer = %s, Other Writer = %s. Different output for = %s"), *NameWriterType, *NameOtherWriterType, *StructDescription);
+	UE_LOG(LogDlgIOTester, Warning, TEXT("Writer.GetAsString() = |%s|\n"), *Writer.GetAsString());
+	UE_LOG(LogDlgIOTester, Warning, TEXT("OtherWriter.GetAsString() = |%s|\n"), *OtherWriter.GetAsString());
+	UE_LOG(LogDlgIOTester, Warning, TEXT(""));
+	return false;
+}
+
 bool FDlgIOTester::TestAllParsers(FAutomationTestBase& Test)
 {
 	bool bAllSucceeded = true;
@@ -130,6 +218,10 @@ bool FDlgIOTester::TestAllParsers(FAutomationTestBase& Test)
 	Options.bSupportsDatePrimitive = false;
 	Options.bSupportsUObjectValueInMap = false;
 	bAllSucceeded &= TestParser<FDlgJsonWriter, FDlgJsonParser>(Test, Options, TEXT("FDlgJsonWriter"), TEXT("FDlgJsonParser"));
+	bAllSucceeded &= TestParser<FDlgJsonWriter, FDlgJsonDOMParser>(Test, Options, TEXT("FDlgJsonWriter"), TEXT("FDlgJsonDOMParser"));
+	bAllSucceeded &= TestParser<FDlgJsonDOMWriter, FDlgJsonParser>(Test, Options, TEXT("FDlgJsonDOMWriter"), TEXT("FDlgJsonParser"));
+	bAllSucceeded &= TestSameWriterOutput<FDlgJsonWriter, FDlgJsonDOMWriter>(Test, Options, TEXT("FDlgJsonWriter"), TEXT("FDlgJsonDOMWriter"));
+	bAllSucceeded &= TestParser<FDlgBinaryWriter, FDlgBinaryParser>(Test, Options, TEXT("FDlgBinaryWriter"), TEXT("FDlgBinaryParser"));
 
 	Options = {};
 	Options.bSupportsPureEnumContainer = false;
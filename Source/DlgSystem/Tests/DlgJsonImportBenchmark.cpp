@@ -0,0 +1,148 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+
+#include "DlgBenchmarkTypes.h"
+#include "DlgDialogueGenerator.h"
+#include "DlgSystem/DlgDialogue.h"
+#include "DlgSystem/IO/DlgJsonParser.h"
+#include "DlgSystem/IO/DlgJsonWriter.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDlgJsonImportBenchmark, All, All);
+DEFINE_LOG_CATEGORY(LogDlgJsonImportBenchmark);
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class FDlgJsonImportBenchmark
+{
+public:
+	// Generates a dialogue that is at least MinFileSizeBytes when exported, returns the exported JSON
+	static FString GenerateJson(int64 MinFileSizeBytes, int32 Seed, int32& OutNumNodes);
+
+	static FString ExportDialogue(const UDlgDialogue* Dialogue);
+
+	// Imports the JSON Iterations times, returns the total time spent inside ReadAllProperty
+	// and the peak of the memory allocated by a single import
+	static double BenchmarkImport(const FString& Json, bool bUseStreaming, int32 Iterations, int64& OutPeakBytes, FString& OutReimportedJson);
+};
+
+FString FDlgJsonImportBenchmark::GenerateJson(int64 MinFileSizeBytes, int32 Seed, int32& OutNumNodes)
+{
+	FDlgDialogueGeneratorOptions Options;
+	Options.Seed = Seed;
+	Options.NumNodes = 1000;
+	Options.NumParticipants = 8;
+
+	FString Json;
+	// Scale the number of nodes by the size of the previous try, usually one extra try is enough
+	for (int32 Try = 0; Try < 8; Try++)
+	{
+		UDlgDialogue* Dialogue = FDlgDialogueGenerator::GenerateDialogue(Options);
+		Json = ExportDialogue(Dialogue);
+
+		const int64 FileSizeBytes = Json.Len();
+		if (FileSizeBytes >= MinFileSizeBytes || FileSizeBytes == 0)
+		{
+			break;
+		}
+
+		const double Scale = static_cast<double>(MinFileSizeBytes) / FileSizeBytes;
+		Options.NumNodes = FMath::CeilToInt(Options.NumNodes * Scale * 1.05);
+	}
+
+	OutNumNodes = Options.NumNodes;
+	return Json;
+}
+
+FString FDlgJsonImportBenchmark::ExportDialogue(const UDlgDialogue* Dialogue)
+{
+	FDlgJsonWriter JsonWriter;
+	JsonWriter.Write(UDlgDialogue::StaticClass(), Dialogue);
+	return JsonWriter.GetAsString();
+}
+
+double FDlgJsonImportBenchmark::BenchmarkImport(const FString& Json, bool bUseStreaming, int32 Iterations, int64& OutPeakBytes, FString& OutReimportedJson)
+{
+	OutPeakBytes = 0;
+	double TotalSeconds = 0.0;
+	for (int32 Index = 0; Index < Iterations; Index++)
+	{
+		UDlgDialogue* Dialogue = NewObject<UDlgDialogue>(GetTransientPackage(), NAME_None, RF_Transient);
+		Dialogue->AddToRoot();
+
+		FDlgJsonParser JsonParser;
+		JsonParser.SetUseStreaming(bUseStreaming);
+		JsonParser.InitializeParserFromString(Json);
+
+		{
+			FDlgBenchmarkMemoryScope MemoryScope;
+			const double StartTime = FPlatformTime::Seconds();
+			JsonParser.ReadAllProperty(UDlgDialogue::StaticClass(), Dialogue, Dialogue);
+			TotalSeconds += FPlatformTime::Seconds() - StartTime;
+			OutPeakBytes = FMath::Max(OutPeakBytes, MemoryScope.GetPeakBytes());
+		}
+
+		if (Index == Iterations - 1)
+		{
+			OutReimportedJson = ExportDialogue(Dialogue);
+		}
+
+		Dialogue->RemoveFromRoot();
+	}
+
+	return TotalSeconds;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgJsonImportBenchmarkTest,
+	"DlgSystem.Benchmarks.JsonImport",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FDlgJsonImportBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const UDlgBenchmarkSettings* Settings = GetDefault<UDlgBenchmarkSettings>();
+	const int64 MinFileSizeBytes = static_cast<int64>(FMath::Max(Settings->JsonImportMinFileSizeMB, 1)) * 1024 * 1024;
+	const int32 Iterations = FMath::Max(Settings->JsonImportIterations, 1);
+
+	int32 NumNodes = 0;
+	const FString Json = FDlgJsonImportBenchmark::GenerateJson(MinFileSizeBytes, Settings->Seed, NumNodes);
+	const double FileSizeMB = static_cast<double>(Json.Len()) / (1024.0 * 1024.0);
+	UE_LOG(LogDlgJsonImportBenchmark, Display, TEXT("Generated dialogue with %d nodes, JSON size = %.2f MB"), NumNodes, FileSizeMB);
+
+	FDlgBenchmarkReport Report(TEXT("JsonImport"));
+	int64 StreamingPeakBytes = 0;
+	int64 DOMPeakBytes = 0;
+	FString StreamingJson;
+	FString DOMJson;
+	Report.AddResult(
+		TEXT("Streaming"), NumNodes, Iterations,
+		FDlgJsonImportBenchmark::BenchmarkImport(Json, true, Iterations, StreamingPeakBytes, StreamingJson), StreamingPeakBytes
+	);
+	Report.AddResult(
+		TEXT("DOM"), NumNodes, Iterations,
+		FDlgJsonImportBenchmark::BenchmarkImport(Json, false, Iterations, DOMPeakBytes, DOMJson), DOMPeakBytes
+	);
+
+	// The throughput, ReportTo logs the rest
+	for (const FDlgBenchmarkResult& Result : Report.GetResults())
+	{
+		const double SecondsPerOp = Result.NumOperations > 0 ? Result.TotalSeconds / Result.NumOperations : 0.0;
+		UE_LOG(
+			LogDlgJsonImportBenchmark, Display, TEXT("%s (Size = %d): %.2f MB/s"),
+			*Result.Case, Result.Size, SecondsPerOp > 0.0 ? FileSizeMB / SecondsPerOp : 0.0
+		);
+	}
+
+	if (!StreamingJson.Equals(DOMJson, ESearchCase::CaseSensitive))
+	{
+		AddError(TEXT("The streaming and the DOM import paths produced different dialogues"));
+	}
+
+	return Report.ReportTo(*this) && !HasAnyErrors();
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
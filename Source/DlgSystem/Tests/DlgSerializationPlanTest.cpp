@@ -0,0 +1,77 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+
+#include "DlgIOTesterTypes.h"
+#include "DlgSystem/IO/DlgSerializationPlan.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgSerializationPlanTest,
+	"DlgSystem.IO.SerializationPlan",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FDlgSerializationPlanTest::RunTest(const FString& Parameters)
+{
+	FDlgSerializationPlanCache& Cache = FDlgSerializationPlanCache::Get();
+	const UStruct* PrimitivesStruct = FDlgTestStructPrimitives::StaticStruct();
+	const FDlgSerializationPlanRef Plan = Cache.FindOrBuild(PrimitivesStruct);
+	TestTrue(TEXT("The plan is shared"), &Cache.FindOrBuild(PrimitivesStruct).Get() == &Plan.Get());
+
+	// Lookup
+	const FDlgSerializationPlanProperty* Integer32 = Plan->FindProperty(TEXT("Integer32"));
+	if (TestNotNull(TEXT("Finds Integer32"), Integer32))
+	{
+		TestTrue(TEXT("Integer32 is an int"), Integer32->Kind == EDlgPropertyKind::Int);
+		TestTrue(TEXT("Integer32 is a primitive"), Integer32->IsPrimitive());
+
+		FDlgTestStructPrimitives Primitives;
+		TestTrue(TEXT("Same value pointer as the property"), Integer32->GetValuePtr(&Primitives) == &Primitives.Integer32);
+	}
+	TestTrue(TEXT("Names are case insensitive"), Plan->FindProperty(TEXT("integer32")) == Integer32);
+	TestNull(TEXT("Unknown name"), Plan->FindProperty(TEXT("ThisPropertyDoesNotExist_1337")));
+
+	const FDlgSerializationPlanProperty* Color = Plan->FindProperty(TEXT("Color"));
+	if (TestNotNull(TEXT("Finds Color"), Color))
+	{
+		TestTrue(TEXT("Color is a struct"), Color->Kind == EDlgPropertyKind::Struct);
+	}
+
+	// Primitives first
+	const TArray<const FDlgSerializationPlanProperty*>& Grouped = Plan->GetGroupedProperties();
+	TestEqual(TEXT("Grouped has all the properties"), Grouped.Num(), Plan->GetProperties().Num());
+	for (int32 Index = 0; Index < Grouped.Num(); Index++)
+	{
+		TestEqual(
+			FString::Printf(TEXT("Grouped property `%s` is in the right group"), *Grouped[Index]->NameString),
+			Grouped[Index]->IsPrimitive(), Index < Plan->GetNumPrimitives()
+		);
+	}
+
+	// Containers
+	const FDlgSerializationPlanRef ArrayPlan = Cache.FindOrBuild(FDlgTestArrayPrimitive::StaticStruct());
+	const FDlgSerializationPlanProperty* Int32Array = ArrayPlan->FindProperty(TEXT("Int32Array"));
+	if (TestNotNull(TEXT("Finds Int32Array"), Int32Array))
+	{
+		TestTrue(TEXT("Int32Array is an array of int"), Int32Array->Kind == EDlgPropertyKind::Array && Int32Array->InnerKind == EDlgPropertyKind::Int);
+		TestTrue(TEXT("Int32Array is a primitive container"), Int32Array->IsPrimitiveContainer());
+	}
+
+	// Nothing changed in the struct since the plan was built
+	TestTrue(TEXT("Up to date"), Plan->IsUpToDate(PrimitivesStruct));
+	TestTrue(TEXT("Not up to date for another struct"), !Plan->IsUpToDate(FDlgTestArrayPrimitive::StaticStruct()));
+
+	// Rebuilt after invalidation, the old plan stays usable
+	Cache.Invalidate();
+	TestEqual(TEXT("Empty after invalidation"), Cache.Num(), 0);
+	const FDlgSerializationPlanRef NewPlan = Cache.FindOrBuild(PrimitivesStruct);
+	TestTrue(TEXT("Rebuilt after invalidation"), &NewPlan.Get() != &Plan.Get());
+	TestEqual(TEXT("Same properties after invalidation"), NewPlan->GetProperties().Num(), Plan->GetProperties().Num());
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
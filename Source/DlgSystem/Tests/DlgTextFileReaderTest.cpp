@@ -0,0 +1,64 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+
+#include "DlgSystem/IO/DlgTextFileReader.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgTextFileReaderTest,
+	"DlgSystem.IO.TextFileReader",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FDlgTextFileReaderTest::RunTest(const FString& Parameters)
+{
+	// 1, 2, 3 and 4 byte UTF-8 sequences, big enough to be memory mapped
+	FString Content;
+	while (Content.Len() < FDlgTextFileReader::MinMemoryMappedFileSize)
+	{
+		Content += TEXT("Text = \"Café 漢字 \U0001F600\";\n");
+	}
+
+	const FString FilePath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("DlgTextFileReaderTest.txt"));
+	const TArray<FFileHelper::EEncodingOptions> Encodings = {
+		FFileHelper::EEncodingOptions::ForceUTF8,
+		FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+		FFileHelper::EEncodingOptions::ForceUnicode
+	};
+	for (const FFileHelper::EEncodingOptions Encoding : Encodings)
+	{
+		if (!TestTrue(TEXT("Saved the test file"), FFileHelper::SaveStringToFile(Content, *FilePath, Encoding)))
+		{
+			continue;
+		}
+
+		FString Expected;
+		FFileHelper::LoadFileToString(Expected, *FilePath);
+
+		// Odd chunk sizes so the multibyte sequences are split between chunks
+		for (const int32 ChunkSize : {16, 17, 1021, FDlgTextFileReader::DefaultChunkSize})
+		{
+			FString Loaded;
+			TestTrue(TEXT("Loaded in chunks"), FDlgTextFileReader::LoadFileToString(Loaded, FilePath, false, ChunkSize));
+			TestTrue(FString::Printf(TEXT("Chunked read, ChunkSize = %d"), ChunkSize), Loaded.Equals(Expected, ESearchCase::CaseSensitive));
+		}
+
+		FString Mapped;
+		TestTrue(TEXT("Loaded memory mapped"), FDlgTextFileReader::LoadFileToString(Mapped, FilePath, true));
+		TestTrue(TEXT("Memory mapped read"), Mapped.Equals(Expected, ESearchCase::CaseSensitive));
+	}
+
+	FString Missing;
+	TestFalse(TEXT("Missing file"), FDlgTextFileReader::LoadFileToString(Missing, FilePath + TEXT(".missing")));
+
+	IFileManager::Get().Delete(*FilePath);
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,148 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+#include "DlgBenchmarkTypes.h"
+#include "DlgDialogueGenerator.h"
+#include "DlgSystem/DlgContext.h"
+#include "DlgSystem/DlgDialogue.h"
+#include "DlgSystem/DlgManager.h"
+#include "DlgSystem/DlgMemory.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class FDlgTraversalBenchmark
+{
+public:
+	// Runs all the cases for the dialogue of size NumNodes
+	static void BenchmarkDialogue(FDlgBenchmarkReport& Report, int32 NumNodes, int32 Iterations, int32 Seed);
+
+	static double BenchmarkCanStartDialogue(UDlgDialogue* Dialogue, const TArray<UObject*>& Participants, int32 Iterations);
+	static double BenchmarkStartDialogue(UDlgDialogue* Dialogue, const TArray<UObject*>& Participants, int32 Iterations);
+	static double BenchmarkChooseOption(UDlgDialogue* Dialogue, const TArray<UObject*>& Participants, int32 Iterations, FRandomStream& RandomStream);
+	static double BenchmarkReevaluateOptions(UDlgDialogue* Dialogue, const TArray<UObject*>& Participants, int32 Iterations);
+};
+
+void FDlgTraversalBenchmark::BenchmarkDialogue(FDlgBenchmarkReport& Report, int32 NumNodes, int32 Iterations, int32 Seed)
+{
+	FDlgDialogueGeneratorOptions Options;
+	Options.Seed = Seed;
+	Options.NumNodes = NumNodes;
+	Options.NumParticipants = FMath::Clamp(NumNodes / 25, 2, 8);
+	UDlgDialogue* Dialogue = FDlgDialogueGenerator::GenerateDialogue(Options);
+	TArray<UObject*> Participants = UDlgTestParticipant::CreateParticipantsForDialogue(Dialogue, Seed);
+
+	// Nothing here should be garbage collected while measuring
+	Dialogue->AddToRoot();
+	for (UObject* Participant : Participants)
+	{
+		Participant->AddToRoot();
+	}
+
+	FRandomStream RandomStream(Seed);
+	Report.AddResult(TEXT("CanStartDialogue"), NumNodes, Iterations, BenchmarkCanStartDialogue(Dialogue, Participants, Iterations));
+	Report.AddResult(TEXT("StartDialogue"), NumNodes, Iterations, BenchmarkStartDialogue(Dialogue, Participants, Iterations));
+	Report.AddResult(TEXT("ChooseOption"), NumNodes, Iterations, BenchmarkChooseOption(Dialogue, Participants, Iterations, RandomStream));
+	Report.AddResult(TEXT("ReevaluateOptions"), NumNodes, Iterations, BenchmarkReevaluateOptions(Dialogue, Participants, Iterations));
+
+	FDlgMemory::Get().Empty();
+	for (UObject* Participant : Participants)
+	{
+		Participant->RemoveFromRoot();
+	}
+	Dialogue->RemoveFromRoot();
+}
+
+double FDlgTraversalBenchmark::BenchmarkCanStartDialogue(UDlgDialogue* Dialogue, const TArray<UObject*>& Participants, int32 Iterations)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Iterations; Index++)
+	{
+		UDlgManager::CanStartDialogue(Dialogue, Participants);
+	}
+	return FPlatformTime::Seconds() - StartTime;
+}
+
+double FDlgTraversalBenchmark::BenchmarkStartDialogue(UDlgDialogue* Dialogue, const TArray<UObject*>& Participants, int32 Iterations)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Iterations; Index++)
+	{
+		UDlgManager::StartDialogue(Dialogue, Participants);
+	}
+	return FPlatformTime::Seconds() - StartTime;
+}
+
+double FDlgTraversalBenchmark::BenchmarkChooseOption(UDlgDialogue* Dialogue, const TArray<UObject*>& Participants, int32 Iterations, FRandomStream& RandomStream)
+{
+	// Only the ChooseOption calls are measured, restarting the dialogue is not
+	uint64 TotalCycles = 0;
+	UDlgContext* Context = nullptr;
+	for (int32 Index = 0; Index < Iterations; Index++)
+	{
+		if (!Context || Context->HasDialogueEnded() || Context->GetOptionsNum() == 0)
+		{
+			Context = UDlgManager::StartDialogue(Dialogue, Participants);
+			if (!Context || Context->GetOptionsNum() == 0)
+			{
+				continue;
+			}
+		}
+
+		const int32 OptionIndex = RandomStream.RandRange(0, Context->GetOptionsNum() - 1);
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		Context->ChooseOption(OptionIndex);
+		TotalCycles += FPlatformTime::Cycles64() - StartCycles;
+	}
+	return FPlatformTime::ToSeconds64(TotalCycles);
+}
+
+double FDlgTraversalBenchmark::BenchmarkReevaluateOptions(UDlgDialogue* Dialogue, const TArray<UObject*>& Participants, int32 Iterations)
+{
+	UDlgContext* Context = UDlgManager::StartDialogue(Dialogue, Participants);
+	if (!Context)
+	{
+		return 0.0;
+	}
+
+	uint64 TotalCycles = 0;
+	for (int32 Index = 0; Index < Iterations; Index++)
+	{
+		if (Context->HasDialogueEnded())
+		{
+			Context = UDlgManager::StartDialogue(Dialogue, Participants);
+			if (!Context)
+			{
+				break;
+			}
+		}
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		Context->ReevaluateOptions();
+		TotalCycles += FPlatformTime::Cycles64() - StartCycles;
+	}
+	return FPlatformTime::ToSeconds64(TotalCycles);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgTraversalBenchmarkTest,
+	"DlgSystem.Benchmarks.Traversal",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FDlgTraversalBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const UDlgBenchmarkSettings* Settings = GetDefault<UDlgBenchmarkSettings>();
+	FDlgBenchmarkReport Report(TEXT("Traversal"));
+	for (const int32 NumNodes : Settings->DialogueSizes)
+	{
+		FDlgTraversalBenchmark::BenchmarkDialogue(Report, NumNodes, Settings->Iterations, Settings->Seed);
+	}
+
+	return Report.ReportTo(*this);
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
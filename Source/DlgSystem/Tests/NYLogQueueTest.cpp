@@ -0,0 +1,71 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+
+#include "DlgSystem/Logging/INYLogger.h"
+#include "DlgSystem/Logging/NYLogQueue.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNYLogQueueTest,
+	"DlgSystem.Logging.LogQueue",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FNYLogQueueTest::RunTest(const FString& Parameters)
+{
+	TArray<FString> Output;
+	auto Collect = [&Output](ENYLoggerLogLevel Level, const FString& Message)
+	{
+		Output.Add(Message);
+	};
+
+	// Identical messages of the same batch are merged
+	{
+		FNYLogQueue Queue;
+		Queue.SetMaxMessagesPerKeyPerSecond(0);
+		Queue.Enqueue(ENYLoggerLogLevel::Error, TEXT("A"), 1);
+		Queue.Enqueue(ENYLoggerLogLevel::Error, TEXT("B"), 2);
+		Queue.Enqueue(ENYLoggerLogLevel::Error, TEXT("A"), 1);
+		Queue.Enqueue(ENYLoggerLogLevel::Warning, TEXT("A"), 1);
+
+		Output.Empty();
+		TestEqual(TEXT("Merged output count"), Queue.Drain(Collect), 3);
+		TestEqual(TEXT("First message"), Output[0], FString(TEXT("A (repeated 2 times)")));
+		TestEqual(TEXT("Second message"), Output[1], FString(TEXT("B")));
+		TestEqual(TEXT("Different level is not merged"), Output[2], FString(TEXT("A")));
+		TestTrue(TEXT("Queue is empty after drain"), Queue.IsEmpty());
+	}
+
+	// Rate limit per key
+	{
+		FNYLogQueue Queue;
+		Queue.SetMaxMessagesPerKeyPerSecond(2);
+		Output.Empty();
+		for (int32 Index = 0; Index < 5; Index++)
+		{
+			Queue.Enqueue(ENYLoggerLogLevel::Error, FString::Printf(TEXT("Message %d"), Index), 7);
+			Queue.Drain(Collect);
+		}
+		TestEqual(TEXT("Rate limited output count"), Output.Num(), 2);
+	}
+
+	// Bounded
+	{
+		FNYLogQueue Queue;
+		Queue.SetMaxQueuedMessages(2);
+		TestTrue(TEXT("First message fits"), Queue.Enqueue(ENYLoggerLogLevel::Info, TEXT("1"), 1));
+		TestTrue(TEXT("Second message fits"), Queue.Enqueue(ENYLoggerLogLevel::Info, TEXT("2"), 2));
+		TestFalse(TEXT("Third message is dropped"), Queue.Enqueue(ENYLoggerLogLevel::Info, TEXT("3"), 3));
+
+		Output.Empty();
+		TestEqual(TEXT("Output count with the dropped warning"), Queue.Drain(Collect), 3);
+		TestTrue(TEXT("Dropped messages are reported"), Output.Last().StartsWith(TEXT("Dropped 1 log messages")));
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -51,6 +51,25 @@ public:
 	// Add Dialogue that containt this participant.
 	void AddDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue) { Dialogues.Add(Dialogue); }
 
+	// Removes the Dialogue from this participant and from all its variables, the variables left without any Dialogue are removed.
+	void RemoveDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue)
+	{
+		Dialogues.Remove(Dialogue);
+		RemoveDialogueFromVariables(&Events, Dialogue);
+		RemoveDialogueFromVariables(&UnrealFunctions, Dialogue);
+		RemoveDialogueFromVariables<UClass*>(&CustomEvents, Dialogue);
+		RemoveDialogueFromVariables(&Conditions, Dialogue);
+		RemoveDialogueFromVariables(&Integers, Dialogue);
+		RemoveDialogueFromVariables(&Floats, Dialogue);
+		RemoveDialogueFromVariables(&Bools, Dialogue);
+		RemoveDialogueFromVariables(&FNames, Dialogue);
+		RemoveDialogueFromVariables(&ClassIntegers, Dialogue);
+		RemoveDialogueFromVariables(&ClassFloats, Dialogue);
+		RemoveDialogueFromVariables(&ClassBools, Dialogue);
+		RemoveDialogueFromVariables(&ClassFNames, Dialogue);
+		RemoveDialogueFromVariables(&ClassFTexts, Dialogue);
+	}
+
 	// Returns the EventName Property
 	TSharedPtr<VariablePropertyType> AddDialogueToEvent(FName EventName, TWeakObjectPtr<const UDlgDialogue> Dialogue)
 	{
@@ -199,6 +218,22 @@ protected:
 		return VariableProps;
 	}
 
+	template <typename KeyType>
+	void RemoveDialogueFromVariables(
+		TMap<KeyType, TSharedPtr<VariablePropertyType>>* VariableMap,
+		TWeakObjectPtr<const UDlgDialogue> Dialogue
+	)
+	{
+		for (auto It = VariableMap->CreateIterator(); It; ++It)
+		{
+			It->Value->RemoveDialogue(Dialogue);
+			if (!It->Value->HasDialogues())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
 protected:
 	/**
 	 * Dialogues that contain this participant
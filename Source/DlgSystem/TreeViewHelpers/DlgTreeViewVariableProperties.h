@@ -17,6 +17,8 @@ public:
 
 	// Dialogues:
 	virtual void AddDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue) { Dialogues.Add(Dialogue); }
+	virtual void RemoveDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue) { Dialogues.Remove(Dialogue); }
+	bool HasDialogues() const { return Dialogues.Num() > 0; }
 	const TSet<TWeakObjectPtr<const UDlgDialogue>>& GetDialogues() const { return Dialogues; }
 
 	/** Sorts all the properties it can */
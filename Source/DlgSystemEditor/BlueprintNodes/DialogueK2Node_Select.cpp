@@ -10,6 +10,7 @@
 #include "EditorStyleSet.h"
 
 #include "DlgSystem/DlgManager.h"
+#include "DlgSystemEditor/Search/DlgSuggestionCache.h"
 #include "DlgBlueprintUtilities.h"
 
 #define LOCTEXT_NAMESPACE "DlgK2Node_Select"
@@ -532,19 +533,19 @@ bool UDialogueK2Node_Select::RefreshPinNames()
 	switch (VariableType)
 	{
 		case EDlgVariableType::Float:
-			NewPinNames.Append(UDlgManager::GetDialoguesParticipantFloatNames(ParticipantName));
+			NewPinNames.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::FloatVariable, ParticipantName));
 			break;
 
 		case EDlgVariableType::Int:
-			NewPinNames.Append(UDlgManager::GetDialoguesParticipantIntNames(ParticipantName));
+			NewPinNames.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::IntVariable, ParticipantName));
 			break;
 
 		case EDlgVariableType::Name:
-			NewPinNames.Append(UDlgManager::GetDialoguesParticipantFNameNames(ParticipantName));
+			NewPinNames.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::FNameVariable, ParticipantName));
 			break;
 
 		case EDlgVariableType::SpeakerState:
-			NewPinNames.Append(UDlgManager::GetDialoguesSpeakerStates());
+			NewPinNames.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::SpeakerState));
 			break;
 
 		default:
@@ -7,6 +7,7 @@
 #include "Kismet/KismetMathLibrary.h"
 
 #include "DlgSystem/DlgManager.h"
+#include "DlgSystemEditor/Search/DlgSuggestionCache.h"
 #include "DlgBlueprintUtilities.h"
 
 #define LOCTEXT_NAMESPACE "DlgK2Node_Select"
@@ -189,27 +190,27 @@ bool UDialogueK2Node_SwitchDialogueCallback::RefreshPinNames()
 	switch (CallbackType)
 	{
 		case EDlgDialogueCallback::Event:
-			NewPinNames.Append(UDlgManager::GetDialoguesParticipantEventNames(ParticipantName));
+			NewPinNames.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::Event, ParticipantName));
 			break;
 
 		case EDlgDialogueCallback::Condition:
-			NewPinNames.Append(UDlgManager::GetDialoguesParticipantConditionNames(ParticipantName));
+			NewPinNames.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::Condition, ParticipantName));
 			break;
 
 		case EDlgDialogueCallback::FloatValue:
-			NewPinNames.Append(UDlgManager::GetDialoguesParticipantFloatNames(ParticipantName));
+			NewPinNames.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::FloatVariable, ParticipantName));
 			break;
 
 		case EDlgDialogueCallback::IntValue:
-			NewPinNames.Append(UDlgManager::GetDialoguesParticipantIntNames(ParticipantName));
+			NewPinNames.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::IntVariable, ParticipantName));
 			break;
 
 		case EDlgDialogueCallback::BoolValue:
-			NewPinNames.Append(UDlgManager::GetDialoguesParticipantBoolNames(ParticipantName));
+			NewPinNames.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::BoolVariable, ParticipantName));
 			break;
 
 		case EDlgDialogueCallback::NameValue:
-			NewPinNames.Append(UDlgManager::GetDialoguesParticipantFNameNames(ParticipantName));
+			NewPinNames.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::FNameVariable, ParticipantName));
 			break;
 
 		default:
@@ -1,48 +1,19 @@
 // Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
 #include "DlgBrowserTreeVariableProperties.h"
 
+#include "DlgSystem/DlgDialogue.h"
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // FDialogueTreeVariableProperties
-FDlgBrowserTreeVariableProperties::FDlgBrowserTreeVariableProperties(const TSet<TWeakObjectPtr<const UDlgDialogue>>& InDialogues)
-	: Super(InDialogues)
+void FDlgBrowserTreeVariableProperties::RemoveDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue)
 {
-	// Empty initialize the graph nodes
-	for (TWeakObjectPtr<const UDlgDialogue> Dialogue: InDialogues)
-	{
-		GraphNodes.Add(Dialogue->GetGUID(), {});
-	}
+	Super::RemoveDialogue(Dialogue);
 
-	// Empty initialize the edge nodes
-	for (TWeakObjectPtr<const UDlgDialogue> Dialogue : InDialogues)
+	// The nodes are searched again the next time the Dialogue is displayed
+	if (Dialogue.IsValid())
 	{
-		EdgeNodes.Add(Dialogue->GetGUID(), {});
-	}
-}
-
-void FDlgBrowserTreeVariableProperties::AddDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue)
-{
-	Super::AddDialogue(Dialogue);
-
-	// Initialize the graph nodes
-	{
-		const FGuid Id = Dialogue->GetGUID();
-		auto* SetPtr = GraphNodes.Find(Id);
-		if (SetPtr == nullptr)
-		{
-			// Does not exist, empty initialize.
-			GraphNodes.Add(Id, {});
-		}
-	}
-
-	// Initialize the edge nodes
-	{
-
-		const FGuid ID = Dialogue->GetGUID();
-		auto* SetPtr = EdgeNodes.Find(ID);
-		if (SetPtr == nullptr)
-		{
-			// Does not exist, empty initialize.
-			EdgeNodes.Add(ID, {});
-		}
+		const FGuid DialogueGUID = Dialogue->GetGUID();
+		GraphNodes.Remove(DialogueGUID);
+		EdgeNodes.Remove(DialogueGUID);
 	}
 }
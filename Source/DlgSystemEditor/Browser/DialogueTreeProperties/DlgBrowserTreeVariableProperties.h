@@ -17,10 +17,21 @@ class FDlgBrowserTreeVariableProperties : public FDlgTreeViewVariableProperties
 	typedef FDlgTreeViewVariableProperties Super;
 
 public:
-	FDlgBrowserTreeVariableProperties(const TSet<TWeakObjectPtr<const UDlgDialogue>>& InDialogues);
+	FDlgBrowserTreeVariableProperties(const TSet<TWeakObjectPtr<const UDlgDialogue>>& InDialogues) : Super(InDialogues) {}
 
 	// Dialogues:
-	void AddDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue) override;
+	void RemoveDialogue(TWeakObjectPtr<const UDlgDialogue> Dialogue) override;
+
+	// The GraphNodes and EdgeNodes of a Dialogue are only searched for when it is displayed, see SDlgBrowser::BuildGraphNodeChildrenForItem
+	void SetNodeSets(
+		const FGuid& DialogueGUID,
+		const TArray<TWeakObjectPtr<const UDialogueGraphNode>>& InGraphNodes,
+		const TArray<TWeakObjectPtr<const UDialogueGraphNode_Edge>>& InEdgeNodes
+	)
+	{
+		GraphNodes.Add(DialogueGUID, TSet<TWeakObjectPtr<const UDialogueGraphNode>>(InGraphNodes));
+		EdgeNodes.Add(DialogueGUID, TSet<TWeakObjectPtr<const UDialogueGraphNode_Edge>>(InEdgeNodes));
+	}
 
 	// GraphNodes:
 	bool HasGraphNodeSet(const FGuid& DialogueGUID) { return GraphNodes.Find(DialogueGUID) != nullptr; }
@@ -51,14 +62,14 @@ public:
 protected:
 	/**
 	 * All the nodes that contain this variable property
-	 * Key: The unique identifier for the Dialogue
+	 * Key: The unique identifier for the Dialogue, only set once the Dialogue was searched
 	 * Value: All nodes in the Dialogue that contain this variable name.
 	 */
 	TMap<FGuid, TSet<TWeakObjectPtr<const UDialogueGraphNode>>> GraphNodes;
 
 	/**
 	 * All the edge nodes that contain this variable property
-	 * Key: The unique identifier for the Dialogue
+	 * Key: The unique identifier for the Dialogue, only set once the Dialogue was searched
 	 * Value: All edge in the Dialogue that contain this condition.
 	 */
 	TMap<FGuid, TSet<TWeakObjectPtr<const UDialogueGraphNode_Edge>>> EdgeNodes;
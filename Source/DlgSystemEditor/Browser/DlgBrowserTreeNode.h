@@ -407,6 +407,10 @@ public:
 	const TWeakObjectPtr<const UDlgDialogue>& GetDialogue() const { return Dialogue; }
 	FReply OnClick() override;
 
+	// GraphNode Children are only added when the row is generated
+	bool HasBuiltGraphNodeChildren() const { return bHasBuiltGraphNodeChildren; }
+	void SetHasBuiltGraphNodeChildren(bool bValue) { bHasBuiltGraphNodeChildren = bValue; }
+
 	bool IsEqual(const Super& Other) const override
 	{
 		if (const Self* OtherSelf = static_cast<const Self*>(&Other))
@@ -419,6 +423,9 @@ public:
 protected:
 	// The Dialogue this represents.
 	TWeakObjectPtr<const UDlgDialogue> Dialogue;
+
+	// Were the InlineChildren (GraphNodes and EdgeNodes) added?
+	bool bHasBuiltGraphNodeChildren = false;
 };
 
 
@@ -13,6 +13,7 @@
 #include "DlgSystem/DlgDialogue.h"
 #include "DlgSystemEditor/DlgStyle.h"
 #include "DlgSystemEditor/Search/DlgSearchUtilities.h"
+#include "DlgSystemEditor/Search/DlgSearchManager.h"
 #include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode.h"
 #include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode_Edge.h"
 #include "DlgBrowserUtilities.h"
@@ -237,223 +238,219 @@ void SDlgBrowser::Construct(const FArguments& InArgs)
 	];
 
 	RefreshTree(false);
+
+	// Keep the tree up to date with the modified Dialogues
+	FDlgSearchManager::Get()->OnDialoguesChanged().AddSP(this, &Self::HandleDialoguesChanged);
 }
 
 void SDlgBrowser::RefreshTree(bool bPreserveExpansion)
 {
-	// First, save off current expansion state
-	TSet<TSharedPtr<FDlgBrowserTreeNode>> OldExpansionState;
-	if (bPreserveExpansion)
+	ParticipantsProperties.Empty();
+	DialoguesParticipants.Empty();
+
+	// Build fast lookup structure for participants (the ParticipantsProperties)
+	// NOTE: the graph nodes of each variable are only searched when they are displayed, see BuildGraphNodeChildrenForItem
+	TSet<FName> ParticipantNames;
+	for (const UDlgDialogue* Dialogue : UDlgManager::GetAllDialoguesFromMemory())
 	{
-		ParticipantsTreeView->GetExpandedItems(OldExpansionState);
+		AddDialogueToProperties(Dialogue, ParticipantNames);
 	}
 
-	RootTreeItem->ClearChildren();
-	RootChildren.Empty();
-	ParticipantsProperties.Empty();
-
-	auto PopulateVariablePropertiesFromSearchResult = [](
-		const TSharedPtr<FDlgBrowserTreeVariableProperties> VariableProperties,
-		const TSharedPtr<FDlgSearchFoundResult> SearchResult,
-		const FGuid& DialogueGUID
-	)
+	// Sort the properties
+	for (const auto& Elem : ParticipantsProperties)
 	{
-		if (VariableProperties->HasGraphNodeSet(DialogueGUID))
+		Elem.Value->Sort();
+	}
+
+	BuildTree(bPreserveExpansion);
+}
+
+void SDlgBrowser::AddDialogueToProperties(const UDlgDialogue* Dialogue, TSet<FName>& OutParticipantNames)
+{
+	// Populate Participants
+	const TSet<FName> ParticipantsNames = Dialogue->GetParticipantNames();
+	DialoguesParticipants.Add(Dialogue, ParticipantsNames);
+	OutParticipantNames.Append(ParticipantsNames);
+	for (const FName& ParticipantName : ParticipantsNames)
+	{
+		TSharedPtr<FDlgBrowserTreeParticipantProperties>* ParticipantPropsPtr = ParticipantsProperties.Find(ParticipantName);
+		TSharedPtr<FDlgBrowserTreeParticipantProperties> ParticipantProps;
+		if (ParticipantPropsPtr == nullptr)
 		{
-			VariableProperties
-				->GetMutableGraphNodeSet(DialogueGUID)
-				->Append(SearchResult->GraphNodes);
+			// participant does not exist, create it
+			const TSet<TWeakObjectPtr<const UDlgDialogue>> SetArgument{Dialogue};
+			ParticipantProps = MakeShared<FDlgBrowserTreeParticipantProperties>(SetArgument);
+			ParticipantsProperties.Add(ParticipantName, ParticipantProps);
 		}
-		if (VariableProperties->HasEdgeNodeSet(DialogueGUID))
+		else
 		{
-			VariableProperties
-				->GetMutableEdgeNodeSet(DialogueGUID)
-				->Append(SearchResult->EdgeNodes);
+			// exists
+			ParticipantProps = *ParticipantPropsPtr;
+			ParticipantProps->AddDialogue(Dialogue);
 		}
-	};
 
-	// Build fast lookup structure for participants (the ParticipantsProperties)
-	TArray<UDlgDialogue*> Dialogues = UDlgManager::GetAllDialoguesFromMemory();
-	for (const UDlgDialogue* Dialogue : Dialogues)
-	{
-		const FGuid DialogueGUID = Dialogue->GetGUID();
+		// Populate events
+		for (const FName& EventName : Dialogue->GetParticipantEventNames(ParticipantName))
+		{
+			ParticipantProps->AddDialogueToEvent(EventName, Dialogue);
+		}
 
-		// Populate Participants
-		TSet<FName> ParticipantsNames = Dialogue->GetParticipantNames();
-		for (const FName& ParticipantName : ParticipantsNames)
+		// Populate Unreal Function Names, displayed with the events
+		for (const FName& FunctionName : Dialogue->GetParticipantFunctionNames(ParticipantName))
 		{
-			TSharedPtr<FDlgBrowserTreeParticipantProperties>* ParticipantPropsPtr = ParticipantsProperties.Find(ParticipantName);
-			TSharedPtr<FDlgBrowserTreeParticipantProperties> ParticipantProps;
-			if (ParticipantPropsPtr == nullptr)
-			{
-				// participant does not exist, create it
-				const TSet<TWeakObjectPtr<const UDlgDialogue>> SetArgument{Dialogue};
-				ParticipantProps = MakeShared<FDlgBrowserTreeParticipantProperties>(SetArgument);
-				ParticipantsProperties.Add(ParticipantName, ParticipantProps);
-			}
-			else
-			{
-				// exists
-				ParticipantProps = *ParticipantPropsPtr;
-				ParticipantProps->AddDialogue(Dialogue);
-			}
+			ParticipantProps->AddDialogueToEvent(FunctionName, Dialogue);
+		}
 
-			// Populate events
-			const TSet<FName> EventsNames = Dialogue->GetParticipantEventNames(ParticipantName);
-			for (const FName& EventName : EventsNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToEvent(EventName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForEventEventName(EventName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate Custom events
+		for (UClass* EventClass : Dialogue->GetParticipantCustomEvents(ParticipantName))
+		{
+			ParticipantProps->AddDialogueToCustomEvent(EventClass, Dialogue);
+		}
 
-			// Populate Unreal Function Names
-			const TSet<FName> FunctionNames = Dialogue->GetParticipantFunctionNames(ParticipantName);
-			for (const FName& FunctionName : FunctionNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToEvent(FunctionName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForFunctionEventName(FunctionName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate conditions
+		for (const FName& ConditionName : Dialogue->GetParticipantConditionNames(ParticipantName))
+		{
+			ParticipantProps->AddDialogueToCondition(ConditionName, Dialogue);
+		}
 
-			// Populate Custom events
-			const TSet<UClass*> CustomEventsClasses = Dialogue->GetParticipantCustomEvents(ParticipantName);
-			for (UClass* EventClass : CustomEventsClasses)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToCustomEvent(EventClass, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForCustomEvent(EventClass, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate int variable names
+		for (const FName& IntVariableName : Dialogue->GetParticipantIntNames(ParticipantName))
+		{
+			ParticipantProps->AddDialogueToIntVariable(IntVariableName, Dialogue);
+		}
 
-			// Populate conditions
-			const TSet<FName> ConditionNames = Dialogue->GetParticipantConditionNames(ParticipantName);
-			for (const FName& ConditionName : ConditionNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToCondition(ConditionName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForConditionEventCallName(ConditionName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate float variable names
+		for (const FName& FloatVariableName : Dialogue->GetParticipantFloatNames(ParticipantName))
+		{
+			ParticipantProps->AddDialogueToFloatVariable(FloatVariableName, Dialogue);
+		}
 
-			// Populate int variable names
-			const TSet<FName> IntVariableNames = Dialogue->GetParticipantIntNames(ParticipantName);
-			for (const FName& IntVariableName : IntVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToIntVariable(IntVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForIntVariableName(IntVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate bool variable names
+		for (const FName& BoolVariableName : Dialogue->GetParticipantBoolNames(ParticipantName))
+		{
+			ParticipantProps->AddDialogueToBoolVariable(BoolVariableName, Dialogue);
+		}
 
-			// Populate float variable names
-			const TSet<FName> FloatVariableNames = Dialogue->GetParticipantFloatNames(ParticipantName);
-			for (const FName& FloatVariableName : FloatVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToFloatVariable(FloatVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForFloatVariableName(FloatVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate FName variable names
+		for (const FName& NameVariableName : Dialogue->GetParticipantFNameNames(ParticipantName))
+		{
+			ParticipantProps->AddDialogueToFNameVariable(NameVariableName, Dialogue);
+		}
 
-			// Populate bool variable names
-			const TSet<FName> BoolVariableNames = Dialogue->GetParticipantBoolNames(ParticipantName);
-			for (const FName& BoolVariableName : BoolVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToBoolVariable(BoolVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForBoolVariableName(BoolVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate UClass int variable names
+		for (const FName& IntVariableName : Dialogue->GetParticipantClassIntNames(ParticipantName))
+		{
+			ParticipantProps->AddDialogueToClassIntVariable(IntVariableName, Dialogue);
+		}
 
-			// Populate FName variable names
-			const TSet<FName> FNameVariableNames = Dialogue->GetParticipantFNameNames(ParticipantName);
-			for (const FName& NameVariableName : FNameVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToFNameVariable(NameVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForFNameVariableName(NameVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate UClass float variable names
+		for (const FName& FloatVariableName : Dialogue->GetParticipantClassFloatNames(ParticipantName))
+		{
+			ParticipantProps->AddDialogueToClassFloatVariable(FloatVariableName, Dialogue);
+		}
 
-			// Populate UClass int variable names
-			const TSet<FName> ClassIntVariableNames = Dialogue->GetParticipantClassIntNames(ParticipantName);
-			for (const FName& IntVariableName : ClassIntVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToClassIntVariable(IntVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForClassIntVariableName(IntVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate UClass bool variable names
+		for (const FName& BoolVariableName : Dialogue->GetParticipantClassBoolNames(ParticipantName))
+		{
+			ParticipantProps->AddDialogueToClassBoolVariable(BoolVariableName, Dialogue);
+		}
 
-			// Populate UClass float variable names
-			const TSet<FName> ClassFloatVariableNames = Dialogue->GetParticipantClassFloatNames(ParticipantName);
-			for (const FName& FloatVariableName : ClassFloatVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToClassFloatVariable(FloatVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForClassFloatVariableName(FloatVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate UClass FName variable names
+		for (const FName& NameVariableName : Dialogue->GetParticipantClassFNameNames(ParticipantName))
+		{
+			ParticipantProps->AddDialogueToClassFNameVariable(NameVariableName, Dialogue);
+		}
 
-			// Populate UClass bool variable names
-			const TSet<FName> ClassBoolVariableNames = Dialogue->GetParticipantClassBoolNames(ParticipantName);
-			for (const FName& BoolVariableName : ClassBoolVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToClassBoolVariable(BoolVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForClassBoolVariableName(BoolVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+		// Populate UClass FText variable names
+		for (const FName& TextVariableName : Dialogue->GetParticipantClassFTextNames(ParticipantName))
+		{
+			ParticipantProps->AddDialogueToClassFTextVariable(TextVariableName, Dialogue);
+		}
+	}
+}
 
-			// Populate UClass FName variable names
-			const TSet<FName> ClassFNameVariableNames = Dialogue->GetParticipantClassFNameNames(ParticipantName);
-			for (const FName& NameVariableName : ClassFNameVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToClassFNameVariable(NameVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForClassFNameVariableName(NameVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+void SDlgBrowser::RemoveDialogueFromProperties(TWeakObjectPtr<const UDlgDialogue> Dialogue, TSet<FName>& OutParticipantNames)
+{
+	// The participants it had when it was added, the Dialogue could have changed since (or be gone)
+	TSet<FName> ParticipantsNames;
+	if (!DialoguesParticipants.RemoveAndCopyValue(Dialogue, ParticipantsNames))
+	{
+		return;
+	}
 
-			// Populate UClass FText variable names
-			const TSet<FName> ClassFTextVariableNames = Dialogue->GetParticipantClassFTextNames(ParticipantName);
-			for (const FName& TextVariableName : ClassFTextVariableNames)
-			{
-				PopulateVariablePropertiesFromSearchResult(
-					ParticipantProps->AddDialogueToClassFTextVariable(TextVariableName, Dialogue),
-					FDlgSearchUtilities::GetGraphNodesForClassFTextVariableName(TextVariableName, Dialogue),
-					DialogueGUID
-				);
-			}
+	OutParticipantNames.Append(ParticipantsNames);
+	for (const FName& ParticipantName : ParticipantsNames)
+	{
+		TSharedPtr<FDlgBrowserTreeParticipantProperties>* ParticipantPropsPtr = ParticipantsProperties.Find(ParticipantName);
+		if (ParticipantPropsPtr == nullptr)
+		{
+			continue;
+		}
+
+		(*ParticipantPropsPtr)->RemoveDialogue(Dialogue);
+		if (!(*ParticipantPropsPtr)->HasDialogues())
+		{
+			ParticipantsProperties.Remove(ParticipantName);
 		}
 	}
+}
 
-	// Sort the properties
-	TArray<FName> AllParticipants;
-	for (const auto& Elem : ParticipantsProperties)
+void SDlgBrowser::HandleDialoguesChanged(
+	const TArray<TWeakObjectPtr<UDlgDialogue>>& ChangedDialogues,
+	const TArray<TWeakObjectPtr<UDlgDialogue>>& RemovedDialogues
+)
+{
+	TSet<FName> ParticipantNames;
+	for (const TWeakObjectPtr<UDlgDialogue>& Dialogue : RemovedDialogues)
 	{
-		AllParticipants.Add(Elem.Key);
-		TSharedPtr<FDlgBrowserTreeParticipantProperties> Property = Elem.Value;
+		RemoveDialogueFromProperties(Dialogue, ParticipantNames);
+	}
+	for (const TWeakObjectPtr<UDlgDialogue>& Dialogue : ChangedDialogues)
+	{
+		RemoveDialogueFromProperties(Dialogue, ParticipantNames);
+		if (IsValid(Dialogue.Get()))
+		{
+			AddDialogueToProperties(Dialogue.Get(), ParticipantNames);
+		}
+	}
+
+	// No participant changed, nothing to display
+	if (ParticipantNames.Num() == 0)
+	{
+		return;
+	}
+
+	// Sort only the properties that changed
+	for (const FName& ParticipantName : ParticipantNames)
+	{
+		if (const TSharedPtr<FDlgBrowserTreeParticipantProperties>* ParticipantPropsPtr = ParticipantsProperties.Find(ParticipantName))
+		{
+			(*ParticipantPropsPtr)->Sort();
+		}
+	}
+
+	BuildTree(true);
+	if (!FilterString.IsEmpty())
+	{
+		GenerateFilteredItems();
+	}
+}
 
-		// sort
-		Property->Sort();
+void SDlgBrowser::BuildTree(bool bPreserveExpansion)
+{
+	// First, save off current expansion state
+	TSet<TSharedPtr<FDlgBrowserTreeNode>> OldExpansionState;
+	if (bPreserveExpansion)
+	{
+		ParticipantsTreeView->GetExpandedItems(OldExpansionState);
 	}
 
+	RootTreeItem->ClearChildren();
+	RootChildren.Empty();
+
+	TArray<FName> AllParticipants;
+	ParticipantsProperties.GetKeys(AllParticipants);
+
 	// Sort the participant names
 	if (SelectedSortOption->IsByName())
 	{
@@ -508,7 +505,7 @@ void SDlgBrowser::GenerateFilteredItems()
 	if (FilterString.IsEmpty())
 	{
 		// No filtering, empty filter, restore original
-		RefreshTree(false);
+		BuildTree(false);
 		return;
 	}
 
@@ -640,6 +637,7 @@ void SDlgBrowser::AddEdgeNodeChildrenToItem(
 void SDlgBrowser::AddGraphNodeBaseChildrenToItemFromProperty(
 	const TSharedPtr<FDlgBrowserTreeNode>& InItem,
 	const TSharedPtr<FDlgBrowserTreeVariableProperties>* PropertyPtr,
+	TFunctionRef<TSharedPtr<FDlgSearchFoundResult>(const UDlgDialogue*)> SearchGraphNodes,
 	EDlgTreeNodeTextType GraphNodeTextType,
 	EDlgTreeNodeTextType EdgeNodeTextType
 )
@@ -659,6 +657,13 @@ void SDlgBrowser::AddGraphNodeBaseChildrenToItemFromProperty(
 	const UDlgDialogue* Dialogue = DialogueItem->GetDialogue().Get();
 	const FGuid DialogueGUID = Dialogue->GetGUID();
 
+	// First time this Dialogue is displayed for this Property
+	if (!Property->HasGraphNodeSet(DialogueGUID))
+	{
+		const TSharedPtr<FDlgSearchFoundResult> SearchResult = SearchGraphNodes(Dialogue);
+		Property->SetNodeSets(DialogueGUID, SearchResult->GraphNodes, SearchResult->EdgeNodes);
+	}
+
 	// Display the GraphNode
 	if (Property->HasGraphNodeSet(DialogueGUID))
 	{
@@ -962,118 +967,6 @@ void SDlgBrowser::BuildTreeViewItem(const TSharedPtr<FDlgBrowserTreeNode>& Item)
 			);
 			break;
 
-		case EDlgTreeNodeTextType::EventDialogue:
-			// List the graph nodes for the dialogue that contains this event
-			AddGraphNodeBaseChildrenToItemFromProperty(
-				Item,
-				ParticipantProperties->GetEvents().Find(Item->GetParentVariableName()),
-				EDlgTreeNodeTextType::EventGraphNode,
-				EDlgTreeNodeTextType::EventGraphNode
-			);
-			break;
-
-		case EDlgTreeNodeTextType::CustomEventDialogue:
-			// List the graph nodes for the dialogue that contains this event
-			AddGraphNodeBaseChildrenToItemFromProperty(
-				Item,
-				ParticipantProperties->GetCustomEvents().Find(Item->GetParentClass()),
-				EDlgTreeNodeTextType::CustomEventGraphNode,
-				EDlgTreeNodeTextType::CustomEventGraphNode
-			);
-			break;
-
-		case EDlgTreeNodeTextType::ConditionDialogue:
-			// List the graph nodes for the dialogue that contains this condition
-			AddGraphNodeBaseChildrenToItemFromProperty(Item,
-				ParticipantProperties->GetConditions().Find(Item->GetParentVariableName()),
-				EDlgTreeNodeTextType::ConditionGraphNode,
-				EDlgTreeNodeTextType::ConditionEdgeNode);
-			break;
-
-		case EDlgTreeNodeTextType::IntVariableDialogue:
-			// List the graph nodes for the dialogue that contains this int variable
-			AddGraphNodeBaseChildrenToItemFromProperty(
-				Item,
-				ParticipantProperties->GetIntegers().Find(Item->GetParentVariableName()),
-				EDlgTreeNodeTextType::IntVariableGraphNode,
-				EDlgTreeNodeTextType::IntVariableEdgeNode
-			);
-			break;
-		case EDlgTreeNodeTextType::FloatVariableDialogue:
-			// List the graph nodes for the dialogue that contains this float variable
-			AddGraphNodeBaseChildrenToItemFromProperty(
-				Item,
-				ParticipantProperties->GetFloats().Find(Item->GetParentVariableName()),
-				EDlgTreeNodeTextType::FloatVariableGraphNode,
-				EDlgTreeNodeTextType::FloatVariableEdgeNode
-			);
-			break;
-		case EDlgTreeNodeTextType::BoolVariableDialogue:
-			// List the graph nodes for the dialogue that contains this bool variable
-			AddGraphNodeBaseChildrenToItemFromProperty(
-				Item,
-				ParticipantProperties->GetBools().Find(Item->GetParentVariableName()),
-				EDlgTreeNodeTextType::BoolVariableGraphNode,
-				EDlgTreeNodeTextType::BoolVariableEdgeNode
-			);
-			break;
-		case EDlgTreeNodeTextType::FNameVariableDialogue:
-			// List the graph nodes for the dialogue that contains this FName variable
-			AddGraphNodeBaseChildrenToItemFromProperty(
-				Item,
-				ParticipantProperties->GetFNames().Find(Item->GetParentVariableName()),
-				EDlgTreeNodeTextType::FNameVariableGraphNode,
-				EDlgTreeNodeTextType::FNameVariableEdgeNode
-			);
-			break;
-
-		case EDlgTreeNodeTextType::IntClassVariableDialogue:
-			// List the graph nodes for the dialogue that contains this UClass int variable
-			AddGraphNodeBaseChildrenToItemFromProperty(
-				Item,
-				ParticipantProperties->GetClassIntegers().Find(Item->GetParentVariableName()),
-				EDlgTreeNodeTextType::IntVariableGraphNode,
-				EDlgTreeNodeTextType::IntVariableEdgeNode
-			);
-			break;
-		case EDlgTreeNodeTextType::FloatClassVariableDialogue:
-			// List the graph nodes for the dialogue that contains this UClass float variable
-			AddGraphNodeBaseChildrenToItemFromProperty(
-				Item,
-				ParticipantProperties->GetClassFloats().Find(Item->GetParentVariableName()),
-				EDlgTreeNodeTextType::FloatVariableGraphNode,
-				EDlgTreeNodeTextType::FloatVariableEdgeNode
-			);
-			break;
-		case EDlgTreeNodeTextType::BoolClassVariableDialogue:
-			// List the graph nodes for the dialogue that contains this UClass bool variable
-			AddGraphNodeBaseChildrenToItemFromProperty(
-				Item,
-				ParticipantProperties->GetClassBools().Find(Item->GetParentVariableName()),
-				EDlgTreeNodeTextType::BoolVariableGraphNode,
-				EDlgTreeNodeTextType::BoolVariableEdgeNode
-			);
-			break;
-		case EDlgTreeNodeTextType::FNameClassVariableDialogue:
-			// List the graph nodes for the dialogue that contains this UClass FName variable
-			AddGraphNodeBaseChildrenToItemFromProperty(
-				Item,
-				ParticipantProperties->GetClassFNames().Find(Item->GetParentVariableName()),
-				EDlgTreeNodeTextType::FNameVariableGraphNode,
-				EDlgTreeNodeTextType::FNameVariableEdgeNode
-			);
-			break;
-
-		case EDlgTreeNodeTextType::FTextClassVariableDialogue:
-			// List the graph nodes for the dialogue that contains this UClass FText variable
-			AddGraphNodeBaseChildrenToItemFromProperty(
-				Item,
-				ParticipantProperties->GetClassFTexts().Find(Item->GetParentVariableName()),
-				EDlgTreeNodeTextType::FTextVariableGraphNode,
-				EDlgTreeNodeTextType::FTextVariableEdgeNode
-			);
-			break;
-
 		default:
 			break;
 		}
@@ -1092,6 +985,171 @@ void SDlgBrowser::BuildTreeViewItem(const TSharedPtr<FDlgBrowserTreeNode>& Item)
 	}
 }
 
+void SDlgBrowser::BuildGraphNodeChildrenForItem(const TSharedPtr<FDlgBrowserTreeNode>& Item)
+{
+	// Only the Dialogues of a variable have graph nodes
+	if (!Item->IsDialogueText() || Item->GetTextType() == EDlgTreeNodeTextType::ParticipantDialogue)
+	{
+		return;
+	}
+
+	const TSharedPtr<FDialogueBrowserTreeDialogueNode> DialogueItem = StaticCastSharedPtr<FDialogueBrowserTreeDialogueNode>(Item);
+	if (DialogueItem->HasBuiltGraphNodeChildren())
+	{
+		return;
+	}
+	DialogueItem->SetHasBuiltGraphNodeChildren(true);
+
+	const TSharedPtr<FDlgBrowserTreeParticipantProperties>* ParticipantPropertiesPtr = ParticipantsProperties.Find(Item->GetParentParticipantName());
+	if (ParticipantPropertiesPtr == nullptr)
+	{
+		return;
+	}
+
+	const TSharedPtr<FDlgBrowserTreeParticipantProperties> ParticipantProperties = *ParticipantPropertiesPtr;
+	const FName VariableName = Item->GetParentVariableName();
+	UClass* EventClass = Item->GetParentClass();
+	switch (Item->GetTextType())
+	{
+	case EDlgTreeNodeTextType::EventDialogue:
+		// List the graph nodes for the dialogue that contains this event
+		AddGraphNodeBaseChildrenToItemFromProperty(
+			Item,
+			ParticipantProperties->GetEvents().Find(VariableName),
+			[VariableName](const UDlgDialogue* Dialogue)
+			{
+				// The Unreal Functions are displayed with the events
+				TSharedPtr<FDlgSearchFoundResult> SearchResult = FDlgSearchUtilities::GetGraphNodesForEventEventName(VariableName, Dialogue);
+				const TSharedPtr<FDlgSearchFoundResult> FunctionSearchResult = FDlgSearchUtilities::GetGraphNodesForFunctionEventName(VariableName, Dialogue);
+				SearchResult->GraphNodes.Append(FunctionSearchResult->GraphNodes);
+				SearchResult->EdgeNodes.Append(FunctionSearchResult->EdgeNodes);
+				return SearchResult;
+			},
+			EDlgTreeNodeTextType::EventGraphNode,
+			EDlgTreeNodeTextType::EventGraphNode
+		);
+		break;
+
+	case EDlgTreeNodeTextType::CustomEventDialogue:
+		// List the graph nodes for the dialogue that contains this event
+		AddGraphNodeBaseChildrenToItemFromProperty(
+			Item,
+			ParticipantProperties->GetCustomEvents().Find(EventClass),
+			[EventClass](const UDlgDialogue* Dialogue) { return FDlgSearchUtilities::GetGraphNodesForCustomEvent(EventClass, Dialogue); },
+			EDlgTreeNodeTextType::CustomEventGraphNode,
+			EDlgTreeNodeTextType::CustomEventGraphNode
+		);
+		break;
+
+	case EDlgTreeNodeTextType::ConditionDialogue:
+		// List the graph nodes for the dialogue that contains this condition
+		AddGraphNodeBaseChildrenToItemFromProperty(
+			Item,
+			ParticipantProperties->GetConditions().Find(VariableName),
+			[VariableName](const UDlgDialogue* Dialogue) { return FDlgSearchUtilities::GetGraphNodesForConditionEventCallName(VariableName, Dialogue); },
+			EDlgTreeNodeTextType::ConditionGraphNode,
+			EDlgTreeNodeTextType::ConditionEdgeNode
+		);
+		break;
+
+	case EDlgTreeNodeTextType::IntVariableDialogue:
+		// List the graph nodes for the dialogue that contains this int variable
+		AddGraphNodeBaseChildrenToItemFromProperty(
+			Item,
+			ParticipantProperties->GetIntegers().Find(VariableName),
+			[VariableName](const UDlgDialogue* Dialogue) { return FDlgSearchUtilities::GetGraphNodesForIntVariableName(VariableName, Dialogue); },
+			EDlgTreeNodeTextType::IntVariableGraphNode,
+			EDlgTreeNodeTextType::IntVariableEdgeNode
+		);
+		break;
+	case EDlgTreeNodeTextType::FloatVariableDialogue:
+		// List the graph nodes for the dialogue that contains this float variable
+		AddGraphNodeBaseChildrenToItemFromProperty(
+			Item,
+			ParticipantProperties->GetFloats().Find(VariableName),
+			[VariableName](const UDlgDialogue* Dialogue) { return FDlgSearchUtilities::GetGraphNodesForFloatVariableName(VariableName, Dialogue); },
+			EDlgTreeNodeTextType::FloatVariableGraphNode,
+			EDlgTreeNodeTextType::FloatVariableEdgeNode
+		);
+		break;
+	case EDlgTreeNodeTextType::BoolVariableDialogue:
+		// List the graph nodes for the dialogue that contains this bool variable
+		AddGraphNodeBaseChildrenToItemFromProperty(
+			Item,
+			ParticipantProperties->GetBools().Find(VariableName),
+			[VariableName](const UDlgDialogue* Dialogue) { return FDlgSearchUtilities::GetGraphNodesForBoolVariableName(VariableName, Dialogue); },
+			EDlgTreeNodeTextType::BoolVariableGraphNode,
+			EDlgTreeNodeTextType::BoolVariableEdgeNode
+		);
+		break;
+	case EDlgTreeNodeTextType::FNameVariableDialogue:
+		// List the graph nodes for the dialogue that contains this FName variable
+		AddGraphNodeBaseChildrenToItemFromProperty(
+			Item,
+			ParticipantProperties->GetFNames().Find(VariableName),
+			[VariableName](const UDlgDialogue* Dialogue) { return FDlgSearchUtilities::GetGraphNodesForFNameVariableName(VariableName, Dialogue); },
+			EDlgTreeNodeTextType::FNameVariableGraphNode,
+			EDlgTreeNodeTextType::FNameVariableEdgeNode
+		);
+		break;
+
+	case EDlgTreeNodeTextType::IntClassVariableDialogue:
+		// List the graph nodes for the dialogue that contains this UClass int variable
+		AddGraphNodeBaseChildrenToItemFromProperty(
+			Item,
+			ParticipantProperties->GetClassIntegers().Find(VariableName),
+			[VariableName](const UDlgDialogue* Dialogue) { return FDlgSearchUtilities::GetGraphNodesForClassIntVariableName(VariableName, Dialogue); },
+			EDlgTreeNodeTextType::IntVariableGraphNode,
+			EDlgTreeNodeTextType::IntVariableEdgeNode
+		);
+		break;
+	case EDlgTreeNodeTextType::FloatClassVariableDialogue:
+		// List the graph nodes for the dialogue that contains this UClass float variable
+		AddGraphNodeBaseChildrenToItemFromProperty(
+			Item,
+			ParticipantProperties->GetClassFloats().Find(VariableName),
+			[VariableName](const UDlgDialogue* Dialogue) { return FDlgSearchUtilities::GetGraphNodesForClassFloatVariableName(VariableName, Dialogue); },
+			EDlgTreeNodeTextType::FloatVariableGraphNode,
+			EDlgTreeNodeTextType::FloatVariableEdgeNode
+		);
+		break;
+	case EDlgTreeNodeTextType::BoolClassVariableDialogue:
+		// List the graph nodes for the dialogue that contains this UClass bool variable
+		AddGraphNodeBaseChildrenToItemFromProperty(
+			Item,
+			ParticipantProperties->GetClassBools().Find(VariableName),
+			[VariableName](const UDlgDialogue* Dialogue) { return FDlgSearchUtilities::GetGraphNodesForClassBoolVariableName(VariableName, Dialogue); },
+			EDlgTreeNodeTextType::BoolVariableGraphNode,
+			EDlgTreeNodeTextType::BoolVariableEdgeNode
+		);
+		break;
+	case EDlgTreeNodeTextType::FNameClassVariableDialogue:
+		// List the graph nodes for the dialogue that contains this UClass FName variable
+		AddGraphNodeBaseChildrenToItemFromProperty(
+			Item,
+			ParticipantProperties->GetClassFNames().Find(VariableName),
+			[VariableName](const UDlgDialogue* Dialogue) { return FDlgSearchUtilities::GetGraphNodesForClassFNameVariableName(VariableName, Dialogue); },
+			EDlgTreeNodeTextType::FNameVariableGraphNode,
+			EDlgTreeNodeTextType::FNameVariableEdgeNode
+		);
+		break;
+
+	case EDlgTreeNodeTextType::FTextClassVariableDialogue:
+		// List the graph nodes for the dialogue that contains this UClass FText variable
+		AddGraphNodeBaseChildrenToItemFromProperty(
+			Item,
+			ParticipantProperties->GetClassFTexts().Find(VariableName),
+			[VariableName](const UDlgDialogue* Dialogue) { return FDlgSearchUtilities::GetGraphNodesForClassFTextVariableName(VariableName, Dialogue); },
+			EDlgTreeNodeTextType::FTextVariableGraphNode,
+			EDlgTreeNodeTextType::FTextVariableEdgeNode
+		);
+		break;
+
+	default:
+		break;
+	}
+}
+
 TSharedRef<SWidget> SDlgBrowser::MakeButtonWidgetForGraphNodes(
 	const TArray<TSharedPtr<FDlgBrowserTreeNode>>& InChildren
 )
@@ -1339,6 +1397,8 @@ TSharedRef<ITableRow> SDlgBrowser::HandleGenerateRow(
 	}
 	else if (InItem->IsText())
 	{
+		// Only now that it is displayed
+		BuildGraphNodeChildrenForItem(InItem);
 		if (InItem->HasInlineChildren())
 		{
 			RowContent = MakeInlineWidget(InItem);
@@ -1491,7 +1551,7 @@ void SDlgBrowser::HandleSortSelectionChanged(SortOptionType Selection, ESelectIn
 	if (Selection.IsValid())
 	{
 		SelectedSortOption = Selection;
-		RefreshTree(true);
+		BuildTree(true);
 	}
 }
 
@@ -1880,7 +1940,7 @@ TSharedRef<SWidget> SDlgBrowser::FillViewOptionsEntries()
 			{
 				UDlgSystemSettings* Settings = GetMutableDefault<UDlgSystemSettings>();
 				Settings->SetHideEmptyDialogueBrowserCategories(!Settings->bHideEmptyDialogueBrowserCategories);
-				RefreshTree(true);
+				BuildTree(true);
 			}),
 			FCanExecuteAction(),
 			FIsActionChecked::CreateLambda([]() -> bool
@@ -14,6 +14,7 @@
 enum class EDlgBlueprintOpenType : unsigned char;
 class UDlgDialogue;
 class SImage;
+struct FDlgSearchFoundResult;
 
 /**
  * Implements the Dialogue Browser
@@ -29,13 +30,28 @@ public:
 
 	void Construct(const FArguments& InArgs);
 
-	// Updates the participants tree.
+	// Rebuilds the participants properties from all the Dialogues in memory and updates the participants tree.
 	void RefreshTree(bool bPreserveExpansion);
 
+	// Updates the participants tree from the participants properties.
+	void BuildTree(bool bPreserveExpansion);
+
 	// Get current filter text
 	FText GetFilterText() const { return FilterTextBoxWidget->GetText(); }
 
 protected:
+	// Adds the Dialogue to the ParticipantsProperties, the participants that changed are added to OutParticipantNames.
+	void AddDialogueToProperties(const UDlgDialogue* Dialogue, TSet<FName>& OutParticipantNames);
+
+	// Removes the Dialogue from the ParticipantsProperties, the participants that changed are added to OutParticipantNames.
+	void RemoveDialogueFromProperties(TWeakObjectPtr<const UDlgDialogue> Dialogue, TSet<FName>& OutParticipantNames);
+
+	// Updates only the changed Dialogues, called by the FDlgSearchManager once they are reindexed.
+	void HandleDialoguesChanged(
+		const TArray<TWeakObjectPtr<UDlgDialogue>>& ChangedDialogues,
+		const TArray<TWeakObjectPtr<UDlgDialogue>>& RemovedDialogues
+	);
+
 	// Handle filtering.
 	void GenerateFilteredItems();
 
@@ -63,13 +79,17 @@ protected:
 		EDlgTreeNodeTextType TextType
 	);
 
-	// Add both GraphNode Children and EdgeNode Children to the InItem from The Property.
+	// Add both GraphNode Children and EdgeNode Children to the InItem from The Property, searches the Dialogue of InItem if the Property does not have its nodes yet.
 	void AddGraphNodeBaseChildrenToItemFromProperty(
 		const TSharedPtr<FDlgBrowserTreeNode>& InItem,
 		const TSharedPtr<FDlgBrowserTreeVariableProperties>* PropertyPtr,
+		TFunctionRef<TSharedPtr<FDlgSearchFoundResult>(const UDlgDialogue*)> SearchGraphNodes,
 		EDlgTreeNodeTextType GraphNodeTextType,
 		EDlgTreeNodeTextType EdgeNodeTextType);
 
+	// Adds the GraphNode Children of the Dialogue item the first time its row is generated, the Dialogue is only searched then.
+	void BuildGraphNodeChildrenForItem(const TSharedPtr<FDlgBrowserTreeNode>& Item);
+
 	// Adds the Variables to the Item
 	void AddVariableChildrenToItem(
 		const TSharedPtr<FDlgBrowserTreeNode>& Item,
@@ -195,6 +215,13 @@ protected:
 	 */
 	TMap<FName, TSharedPtr<FDlgBrowserTreeParticipantProperties>> ParticipantsProperties;
 
+	/**
+	 * The Dialogues added to the ParticipantsProperties, so that one Dialogue can be updated without the others
+	 * Key: Dialogue
+	 * Value: the participants names of the Dialogue at the time it was added
+	 */
+	TMap<TWeakObjectPtr<const UDlgDialogue>, TSet<FName>> DialoguesParticipants;
+
 	//
 	// Sort variables
 	//
@@ -6,6 +6,7 @@
 #include "FileHelpers.h"
 #include "DlgSystem/DlgDialogue.h"
 #include "DlgSystem/DlgManager.h"
+#include "DlgSystemEditor/DlgEditorUtilities.h"
 
 
 class FDlgCommandletHelper
@@ -24,16 +25,8 @@ public:
 
 	static bool SaveAllDialogues()
 	{
-		TArray<UDlgDialogue*> Dialogues = UDlgManager::GetAllDialoguesFromMemory();
-		TArray<UPackage*> PackagesToSave;
-		for (UDlgDialogue* Dialogue : Dialogues)
-		{
-			Dialogue->OnPreAssetSaved();
-			Dialogue->MarkPackageDirty();
-			PackagesToSave.Add(Dialogue->GetOutermost());
-		}
-
-		static constexpr bool bCheckDirty = false;
-		return UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, bCheckDirty);
+		static constexpr bool bPromptForCheckout = false;
+		static constexpr bool bShowProgress = false;
+		return FDlgEditorUtilities::SaveDialogues(UDlgManager::GetAllDialoguesFromMemory(), bPromptForCheckout, bShowProgress);
 	}
 };
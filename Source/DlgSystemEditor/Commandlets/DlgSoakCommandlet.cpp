@@ -0,0 +1,218 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "DlgSoakCommandlet.h"
+
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include "DlgSystem/DlgManager.h"
+#include "DlgSystem/DlgDialogue.h"
+#include "DlgSystem/DlgContext.h"
+#include "DlgSystem/Logging/DlgLogger.h"
+#include "DlgSystem/Tests/DlgDialogueGenerator.h"
+
+
+DEFINE_LOG_CATEGORY(LogDlgSoakCommandlet);
+
+UDlgSoakCommandlet::UDlgSoakCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = false;
+	ShowErrorCount = false;
+}
+
+int32 UDlgSoakCommandlet::Main(const FString& Params)
+{
+	UE_LOG(LogDlgSoakCommandlet, Display, TEXT("Starting"));
+
+	// Parse command line - we're interested in the param vals
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamVals;
+	UCommandlet::ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+
+	FDlgSoakOptions Options;
+	if (const FString* Value = ParamVals.Find(TEXT("Sessions")))
+	{
+		Options.NumSessions = FMath::Max(1, FCString::Atoi(**Value));
+	}
+	if (const FString* Value = ParamVals.Find(TEXT("MaxSteps")))
+	{
+		Options.MaxStepsPerSession = FMath::Max(1, FCString::Atoi(**Value));
+	}
+	if (const FString* Value = ParamVals.Find(TEXT("Seed")))
+	{
+		Options.Seed = FCString::Atoi(**Value);
+	}
+	if (const FString* Value = ParamVals.Find(TEXT("Filter")))
+	{
+		Options.DialogueFilter = *Value;
+	}
+	if (const FString* Value = ParamVals.Find(TEXT("CSV")))
+	{
+		Options.CSVPath = FPaths::IsRelative(*Value) ? FPaths::Combine(FPaths::ProjectDir(), *Value) : *Value;
+	}
+	Options.bScripted = Switches.Contains(TEXT("Scripted"));
+	Options.bTrackMemory = Switches.Contains(TEXT("TrackMemory"));
+
+	UDlgManager::LoadAllDialoguesIntoMemory();
+	TArray<UDlgDialogue*> Dialogues;
+	for (UDlgDialogue* Dialogue : UDlgManager::GetAllDialoguesFromMemory())
+	{
+		if (Options.DialogueFilter.IsEmpty() || Dialogue->GetPathName().Contains(Options.DialogueFilter))
+		{
+			Dialogues.Add(Dialogue);
+		}
+	}
+	UE_LOG(LogDlgSoakCommandlet, Display, TEXT("Soaking %d dialogues, %d sessions each, max %d steps per session"), Dialogues.Num(), Options.NumSessions, Options.MaxStepsPerSession);
+
+	TArray<FDlgSoakDialogueStats> AllStats;
+	AllStats.SetNum(Dialogues.Num());
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 DialogueIndex = 0; DialogueIndex < Dialogues.Num(); DialogueIndex++)
+	{
+		AllStats[DialogueIndex] = SoakDialogue(Dialogues[DialogueIndex], Options, Options.Seed + DialogueIndex);
+	}
+	const double TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// Commandlets do not tick, write the queued messages (if async logging is enabled) with the soak outputs
+	FDlgLogger::Get().Flush();
+
+	// Most expensive first
+	AllStats.Sort([](const FDlgSoakDialogueStats& A, const FDlgSoakDialogueStats& B)
+	{
+		return A.P99Microseconds > B.P99Microseconds;
+	});
+
+	int64 TotalSteps = 0;
+	for (const FDlgSoakDialogueStats& Stats : AllStats)
+	{
+		TotalSteps += Stats.NumSteps;
+		UE_LOG(LogDlgSoakCommandlet, Display,
+			TEXT("Dialogue = %s. Steps/sec = %.1f, p50 = %.2f us, p99 = %.2f us, Max EnterNode depth = %d, Process memory growth = %s, Steps = %d, Failed starts = %d/%d"),
+			*Stats.DialoguePath, Stats.GetStepsPerSecond(), Stats.P50Microseconds, Stats.P99Microseconds, Stats.MaxEnterNodeDepth,
+			Options.bTrackMemory ? *FString::Printf(TEXT("%lld bytes"), Stats.ProcessMemoryGrowthBytes) : TEXT("not tracked"),
+			Stats.NumSteps, Stats.NumFailedStarts, Stats.NumSessions
+		);
+	}
+
+	UE_LOG(LogDlgSoakCommandlet, Display,
+		LINE_TERMINATOR TEXT("Stats:") LINE_TERMINATOR
+		TEXT("Dialogues = %d") LINE_TERMINATOR
+		TEXT("Total Steps = %lld") LINE_TERMINATOR
+		TEXT("Total Time = %.2f seconds"),
+		AllStats.Num(), TotalSteps, TotalSeconds);
+
+	if (!Options.CSVPath.IsEmpty())
+	{
+		if (!FFileHelper::SaveStringToFile(StatsToCSV(AllStats), *Options.CSVPath))
+		{
+			UE_LOG(LogDlgSoakCommandlet, Error, TEXT("Could not write the CSV file = `%s`"), *Options.CSVPath);
+			return -1;
+		}
+		UE_LOG(LogDlgSoakCommandlet, Display, TEXT("Wrote CSV file = `%s`"), *Options.CSVPath);
+	}
+
+	return 0;
+}
+
+FDlgSoakDialogueStats UDlgSoakCommandlet::SoakDialogue(UDlgDialogue* Dialogue, const FDlgSoakOptions& Options, int32 DialogueSeed)
+{
+	check(Dialogue);
+	FDlgSoakDialogueStats Stats;
+	Stats.DialoguePath = Dialogue->GetPathName();
+	Stats.NumSessions = Options.NumSessions;
+
+	// The growth of the whole process, not only the allocations of this dialogue
+	const uint64 StartUsedPhysical = Options.bTrackMemory ? FPlatformMemory::GetStats().UsedPhysical : 0;
+	const TArray<UObject*> Participants = UDlgTestParticipant::CreateParticipantsForDialogue(Dialogue, DialogueSeed, !Options.bScripted);
+	if (Participants.Num() == 0)
+	{
+		Stats.NumFailedStarts = Options.NumSessions;
+		return Stats;
+	}
+	if (Options.bScripted)
+	{
+		// Every condition/variable the dialogue uses gets a fixed value, the same for every session
+		for (UObject* Participant : Participants)
+		{
+			UDlgTestParticipant* TestParticipant = CastChecked<UDlgTestParticipant>(Participant);
+			TestParticipant->ScriptValuesFromParticipantData(Dialogue->GetParticipantsData().FindChecked(TestParticipant->ParticipantName));
+		}
+	}
+
+	FRandomStream RandomStream(DialogueSeed);
+	TArray<double> StepMicroseconds;
+	StepMicroseconds.Reserve(Options.NumSessions * 4);
+	uint64 TotalCycles = 0;
+	auto AddStep = [&](uint64 Cycles)
+	{
+		TotalCycles += Cycles;
+		StepMicroseconds.Add(FPlatformTime::ToSeconds64(Cycles) * 1000000.0);
+	};
+
+	for (int32 Session = 0; Session < Options.NumSessions; Session++)
+	{
+		// Starting counts as a step, it enters the first node
+		uint64 StartCycles = FPlatformTime::Cycles64();
+		UDlgContext* Context = UDlgManager::StartDialogueWithContext(TEXT("DlgSoak"), Dialogue, Participants);
+		AddStep(FPlatformTime::Cycles64() - StartCycles);
+		if (!Context)
+		{
+			Stats.NumFailedStarts++;
+			continue;
+		}
+
+		for (int32 Step = 0; Step < Options.MaxStepsPerSession && !Context->HasDialogueEnded(); Step++)
+		{
+			const int32 NumOptions = Context->GetOptionsNum();
+			if (NumOptions == 0)
+			{
+				break;
+			}
+
+			const int32 OptionIndex = RandomStream.RandRange(0, NumOptions - 1);
+			StartCycles = FPlatformTime::Cycles64();
+			Context->ChooseOption(OptionIndex);
+			AddStep(FPlatformTime::Cycles64() - StartCycles);
+		}
+
+		Stats.MaxEnterNodeDepth = FMath::Max(Stats.MaxEnterNodeDepth, Context->GetMaxEnterNodeDepth());
+	}
+
+	if (Options.bTrackMemory)
+	{
+		Stats.ProcessMemoryGrowthBytes = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(StartUsedPhysical);
+	}
+	Stats.NumSteps = StepMicroseconds.Num();
+	Stats.TotalSeconds = FPlatformTime::ToSeconds64(TotalCycles);
+	if (StepMicroseconds.Num() > 0)
+	{
+		StepMicroseconds.Sort();
+		const int32 LastIndex = StepMicroseconds.Num() - 1;
+		Stats.P50Microseconds = StepMicroseconds[FMath::RoundToInt(LastIndex * 0.50)];
+		Stats.P99Microseconds = StepMicroseconds[FMath::RoundToInt(LastIndex * 0.99)];
+	}
+
+	return Stats;
+}
+
+FString UDlgSoakCommandlet::StatsToCSV(const TArray<FDlgSoakDialogueStats>& AllStats)
+{
+	FString CSV = TEXT("Dialogue,Sessions,FailedStarts,Steps,StepsPerSecond,P50Microseconds,P99Microseconds,MaxEnterNodeDepth,ProcessMemoryGrowthBytes\n");
+	for (const FDlgSoakDialogueStats& Stats : AllStats)
+	{
+		CSV += FString::Printf(
+			TEXT("%s,%d,%d,%d,%f,%f,%f,%d,%lld\n"),
+			*Stats.DialoguePath, Stats.NumSessions, Stats.NumFailedStarts, Stats.NumSteps, Stats.GetStepsPerSecond(),
+			Stats.P50Microseconds, Stats.P99Microseconds, Stats.MaxEnterNodeDepth, Stats.ProcessMemoryGrowthBytes
+		);
+	}
+
+	return CSV;
+}
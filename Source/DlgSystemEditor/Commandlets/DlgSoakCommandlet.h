@@ -0,0 +1,87 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "DlgSoakCommandlet.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDlgSoakCommandlet, All, All);
+
+
+class UDlgDialogue;
+
+
+// Options parsed from the command line
+struct FDlgSoakOptions
+{
+public:
+	// Number of random sessions per dialogue
+	int32 NumSessions = 1000;
+
+	// A session ends after this many steps even if the dialogue did not end
+	int32 MaxStepsPerSession = 200;
+
+	int32 Seed = 0;
+
+	// If true the conditions and variables of the participants are fixed for the whole run, picked from the participants data
+	// of the dialogue. The unknown ones return the default values instead of random ones.
+	bool bScripted = false;
+
+	// Measure the growth of the process memory while each dialogue runs, see FPlatformMemory::GetStats
+	bool bTrackMemory = false;
+
+	// Only dialogues with path names that contain this are used
+	FString DialogueFilter;
+
+	// Optional CSV output file
+	FString CSVPath;
+};
+
+
+// Results of a single dialogue
+struct FDlgSoakDialogueStats
+{
+public:
+	FString DialoguePath;
+	int32 NumSessions = 0;
+	int32 NumFailedStarts = 0;
+	int32 NumSteps = 0;
+	double TotalSeconds = 0.0;
+	double P50Microseconds = 0.0;
+	double P99Microseconds = 0.0;
+	int32 MaxEnterNodeDepth = 0;
+
+	// Growth of the used physical memory of the whole process while the dialogue ran, only if tracked.
+	// Not the memory cost of the dialogue, the allocator caches, the garbage collection and the other threads change it too.
+	int64 ProcessMemoryGrowthBytes = 0;
+
+	double GetStepsPerSecond() const { return TotalSeconds > 0.0 ? NumSteps / TotalSeconds : 0.0; }
+};
+
+
+/**
+ * Loads every dialogue and drives random sessions against mock participants (UDlgTestParticipant).
+ * Reports steps/sec, p50/p99 step latency, max EnterNode recursion depth and the process memory growth while each dialogue ran.
+ * Everything runs on the game thread, the dialogues call into UObjects (participants, custom conditions/events).
+ *
+ * Usage: -run=DlgSoak [-Sessions=1000] [-MaxSteps=200] [-Seed=0] [-Scripted] [-TrackMemory] [-Filter=/Game/Dialogues] [-CSV=Saved/Soak.csv]
+ */
+UCLASS()
+class UDlgSoakCommandlet: public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UDlgSoakCommandlet();
+
+public:
+
+	//~ UCommandlet interface
+	int32 Main(const FString& Params) override;
+
+	// Runs all the sessions of a single dialogue
+	static FDlgSoakDialogueStats SoakDialogue(UDlgDialogue* Dialogue, const FDlgSoakOptions& Options, int32 DialogueSeed);
+
+protected:
+	static FString StatsToCSV(const TArray<FDlgSoakDialogueStats>& AllStats);
+};
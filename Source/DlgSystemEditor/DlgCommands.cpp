@@ -14,6 +14,13 @@ void FDlgCommands::RegisterCommands()
 		EUserInterfaceActionType::Button, FInputChord()
 	);
 
+	UI_COMMAND(
+		AutoPositionNodes,
+		"Auto Position",
+		"Automatically positions all the nodes of the Graph in layers. Can be undone.",
+		EUserInterfaceActionType::Button, FInputChord()
+	);
+
 	UI_COMMAND(
 		ToggleShowEdgeText,
 		"Show Edge Texts",
@@ -28,6 +28,9 @@ public:
 	// Reloads the dialogue data from the .dlg text file that match the name of this dialogue
 	TSharedPtr<FUICommandInfo> DialogueReloadData;
 
+	// Automatically positions all the nodes of the graph
+	TSharedPtr<FUICommandInfo> AutoPositionNodes;
+
 	// Draw edge texts
 	TSharedPtr<FUICommandInfo> ToggleShowEdgeText;
 
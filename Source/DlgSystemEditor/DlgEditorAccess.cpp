@@ -9,6 +9,7 @@
 #include "Editor/Nodes/DialogueGraphNode_Edge.h"
 #include "Editor/DlgCompiler.h"
 #include "DlgSystem/Nodes/DlgNode.h"
+#include "Search/DlgSearchData.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // FDlgEditorAccess
@@ -35,7 +36,10 @@ void FDlgEditorAccess::CompileDialogueNodesFromGraphNodes(UDlgDialogue* Dialogue
 	FCompilerResultsLog MessageLog;
 	const UDlgSystemSettings* Settings = GetDefault<UDlgSystemSettings>();
 	FDlgCompilerContext CompilerContext(Dialogue, Settings, MessageLog);
-	CompilerContext.Compile();
+	if (!CompilerContext.CompileIncremental())
+	{
+		CompilerContext.Compile();
+	}
 	//FDlgEditorUtilities::RefreshDetailsView(Dialogue->GetGraph(), true);
 }
 
@@ -142,3 +146,8 @@ void FDlgEditorAccess::SetNewOuterForObjectFromGraphNode(UObject* Object, UEdGra
 
 	Object->Rename(nullptr, ClosestNode, REN_DontCreateRedirectors);
 }
+
+FString FDlgEditorAccess::GetSearchDataTagValue(const UDlgDialogue* Dialogue) const
+{
+	return FDlgSearchDialogueData::Extract(Dialogue)->ToTagValue();
+}
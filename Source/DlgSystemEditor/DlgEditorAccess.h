@@ -20,6 +20,7 @@ public:
 	void RemoveAllGraphNodes(UDlgDialogue* Dialogue) const override;
 	void UpdateDialogueToVersion_UseOnlyOneOutputAndInputPin(UDlgDialogue* Dialogue) const override;
 	void SetNewOuterForObjectFromGraphNode(UObject* Object, UEdGraphNode* GraphNode) const override;
+	FString GetSearchDataTagValue(const UDlgDialogue* Dialogue) const override;
 
 	bool AreDialogueNodesInSyncWithGraphNodes(UDlgDialogue* Dialogue) const override
 	{
@@ -1,39 +1,35 @@
 // Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
 #include "DlgEditorUtilities.h"
 
+#include <atomic>
+
 #include "Toolkits/IToolkit.h"
 #include "Toolkits/ToolkitManager.h"
 #include "Templates/Casts.h"
-#include "Containers/Queue.h"
 #include "EdGraphNode_Comment.h"
 #include "FileHelpers.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/SClassPickerDialog.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Engine/Blueprint.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopedSlowTask.h"
 
 #include "DlgSystemEditorModule.h"
 #include "Editor/IDlgEditor.h"
+#include "Editor/DlgGraphLayout.h"
 #include "Editor/Nodes/DialogueGraphNode.h"
 #include "Editor/Nodes/DialogueGraphNode_Edge.h"
 #include "DlgSystem/DlgHelper.h"
 #include "DlgSystem/DlgManager.h"
+#include "DlgSystem/IO/IDlgParser.h"
+#include "DlgSystem/IO/IDlgWriter.h"
 #include "Factories/DlgClassViewerFilters.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "K2Node_Event.h"
 
-/** Useful for auto positioning */
-struct NodeWithParentPosition
-{
-	NodeWithParentPosition() {}
-	NodeWithParentPosition(UDialogueGraphNode* InNode, const int32 InParentNodeX, const int32 InParentNodeY) :
-		Node(InNode), ParentNodeX(InParentNodeX), ParentNodeY(InParentNodeY) {}
-
-	UDialogueGraphNode* Node = nullptr;
-	int32 ParentNodeX = 0;
-	int32 ParentNodeY = 0;
-};
-
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // FDlgEditorUtilities
 void FDlgEditorUtilities::LoadAllDialoguesAndCheckGUIDs()
@@ -397,162 +393,20 @@ UDlgNode* FDlgEditorUtilities::GetClosestNodeFromGraphNode(UEdGraphNode* GraphNo
 }
 
 void FDlgEditorUtilities::AutoPositionGraphNodes(
-	UDialogueGraphNode* RootNode,
 	const TArray<UDialogueGraphNode*>& GraphNodes,
 	int32 OffsetBetweenColumnsX,
 	int32 OffsetBetweenRowsY,
 	bool bIsDirectionVertical
 )
 {
-	TSet<UDialogueGraphNode*> VisitedNodes;
-	VisitedNodes.Add(RootNode);
-	TQueue<NodeWithParentPosition> Queue;
-	verify(Queue.Enqueue(NodeWithParentPosition(RootNode, 0, 0)));
-
-	// Find first node with children so that we do not get all the graph with orphan nodes
-	{
-		UDialogueGraphNode* Node = RootNode;
-		int32 Index = 0;
-		while (Index < GraphNodes.Num() && Node->GetOutputPin()->LinkedTo.Num() == 0)
-		{
-			Node = GraphNodes[Index];
-			Index++;
-		}
-		if (Node != RootNode)
-		{
-			NodeWithParentPosition ParentPosition;
-			if (bIsDirectionVertical)
-			{
-				ParentPosition = NodeWithParentPosition(Node, 0, OffsetBetweenRowsY);
-			}
-			else
-			{
-				ParentPosition = NodeWithParentPosition(Node, OffsetBetweenColumnsX, 0);
-			}
-
-			verify(Queue.Enqueue(ParentPosition));
-		}
-	}
-
-	// Just some BFS
-	while (!Queue.IsEmpty())
-	{
-		NodeWithParentPosition NodeWithPosition;
-		verify(Queue.Dequeue(NodeWithPosition));
-		UDialogueGraphNode* Node = NodeWithPosition.Node;
-
-		if (bIsDirectionVertical)
-		{
-			// Position this node at the same level only one row further (down)
-			Node->SetPosition(
-				NodeWithPosition.ParentNodeX,
-				NodeWithPosition.ParentNodeY + OffsetBetweenRowsY
-			);
-		}
-		else
-		{
-			// Position this node at the same level only one column further (to the right)
-			Node->SetPosition(
-				NodeWithPosition.ParentNodeX + OffsetBetweenColumnsX,
-				NodeWithPosition.ParentNodeY
-			);
-		}
-
-		// Gather the list of unvisited child nodes, useful for not drawing weird children
-		TArray<UDialogueGraphNode*> ChildNodesUnvisited;
-		for (UDialogueGraphNode* ChildNode : Node->GetChildNodes())
-		{
-			// Prevent double visiting
-			if (!VisitedNodes.Contains(ChildNode))
-			{
-				ChildNodesUnvisited.Add(ChildNode);
-			}
-		}
-
-		// Adjust
-		int32 ChildOffsetPos;
-		if (bIsDirectionVertical)
-		{
-			// Adjust for the number of nodes, so that we are left, down by half
-			int32 ChildOffsetPosX = Node->NodePosX;
-			if (ChildNodesUnvisited.Num() > 1) // only adjust X position if we have more than one child
-			{
-				ChildOffsetPosX -= OffsetBetweenColumnsX * ChildNodesUnvisited.Num() / 2;
-			}
-
-			ChildOffsetPos = ChildOffsetPosX;
-		}
-		else
-		{
-			// Adjust for the number of nodes, so that we are right above (top) by half
-			int32 ChildOffsetPosY = Node->NodePosY;
-			if (ChildNodesUnvisited.Num() > 1) // only adjust Y position if we have more than one child
-			{
-				ChildOffsetPosY -= OffsetBetweenRowsY * ChildNodesUnvisited.Num() / 2;
-			}
-
-			ChildOffsetPos = ChildOffsetPosY;
-		}
-
-		// Position children
-		for (int32 ChildIndex = 0, ChildNum = ChildNodesUnvisited.Num(); ChildIndex < ChildNum; ChildIndex++)
-		{
-			UDialogueGraphNode* ChildNode = ChildNodesUnvisited[ChildIndex];
-			if (bIsDirectionVertical)
-			{
-				ChildNode->SetPosition(ChildOffsetPos, Node->NodePosY);
-			}
-			else
-			{
-				ChildNode->SetPosition(Node->NodePosX, ChildOffsetPos);
-			}
-
-			VisitedNodes.Add(ChildNode);
-
-			NodeWithParentPosition ParentPosition;
-			if (bIsDirectionVertical)
-			{
-				ParentPosition = NodeWithParentPosition(ChildNode, ChildOffsetPos, Node->NodePosY);
-				ChildOffsetPos += OffsetBetweenColumnsX + ChildNode->EstimateNodeWidth();
-			}
-			else
-			{
-				// Next child on this level will set X aka columns to Node->NodePosX + OffsetBetweenColumnsX
-				// And Y aka row will be the same as this parent node, so it will be ChildOffsetPosY
-				ParentPosition = NodeWithParentPosition(ChildNode, Node->NodePosX + ChildNode->EstimateNodeWidth() * 1.5, ChildOffsetPos);
-				ChildOffsetPos += OffsetBetweenRowsY;
-			}
-
-			Queue.Enqueue(ParentPosition);
-		}
-	}
-
-	// Fix position of orphans (nodes/node group with no parents)
-	if (GraphNodes.Num() != VisitedNodes.Num())
-	{
-		TSet<UDialogueGraphNode*> NodesSet(GraphNodes);
-		// Nodes that are in the graph but not in the visited nodes set
-		TSet<UDialogueGraphNode*> OrphanedNodes = NodesSet.Difference(VisitedNodes);
-		for (UDialogueGraphNode* Node : OrphanedNodes)
-		{
-			// Finds the highest bottom left point
-			const FVector2D NodePos = Node->GetGraph()->GetGoodPlaceForNewNode();
-			if (bIsDirectionVertical)
-			{
-				Node->SetPosition(
-					NodePos.X,
-					NodePos.Y + OffsetBetweenRowsY
-				);
-			}
-			else
-			{
-				Node->SetPosition(
-					NodePos.X + OffsetBetweenColumnsX,
-					NodePos.Y
-				);
-			}
-		}
-	}
+	FDlgGraphLayoutSettings LayoutSettings;
+	LayoutSettings.OffsetBetweenColumnsX = OffsetBetweenColumnsX;
+	LayoutSettings.OffsetBetweenRowsY = OffsetBetweenRowsY;
+	LayoutSettings.bIsDirectionVertical = bIsDirectionVertical;
+
+	const TSharedRef<FDlgGraphLayout> Layout = FDlgGraphLayout::FromGraphNodes(GraphNodes, LayoutSettings);
+	Layout->Compute();
+	Layout->ApplyToGraphNodes(false);
 }
 
 bool FDlgEditorUtilities::CanConvertSpeechNodesToSpeechSequence(
@@ -913,45 +767,385 @@ UDlgDialogue* FDlgEditorUtilities::GetDialogueFromGraphNode(const UEdGraphNode*
 	return nullptr;
 }
 
+// Number of text files handled at once by the batch operations, the progress and the cancellation are checked between the batches
+static constexpr int32 DlgTextFileBatchSize = 64;
+
+// The text formats with a file for TextFormat, All means all of them
+static TArray<EDlgDialogueTextFormat> GetBatchTextFormats(EDlgDialogueTextFormat TextFormat)
+{
+	TArray<EDlgDialogueTextFormat> TextFormats;
+	if (TextFormat == EDlgDialogueTextFormat::All)
+	{
+		const int32 TextFormatsNum = static_cast<int32>(EDlgDialogueTextFormat::NumTextFormats);
+		for (int32 TextFormatIndex = static_cast<int32>(EDlgDialogueTextFormat::StartTextFormats);
+				   TextFormatIndex < TextFormatsNum; TextFormatIndex++)
+		{
+			TextFormats.Add(static_cast<EDlgDialogueTextFormat>(TextFormatIndex));
+		}
+	}
+	else if (UDlgSystemSettings::HasTextFileExtension(TextFormat))
+	{
+		TextFormats.Add(TextFormat);
+	}
+
+	return TextFormats;
+}
+
+TArray<UDlgDialogue*> FDlgEditorUtilities::GetAllBatchDialogues()
+{
+	TArray<UDlgDialogue*> Dialogues = UDlgManager::GetAllDialoguesFromMemory();
+	if (GetDefault<UDlgSystemSettings>()->bBatchOnlyInGameDialogues)
+	{
+		// Ignore, not in game directory
+		Dialogues.RemoveAll([](const UDlgDialogue* Dialogue)
+		{
+			return !Dialogue->IsInProjectDirectory();
+		});
+	}
+
+	return Dialogues;
+}
+
 bool FDlgEditorUtilities::SaveAllDialogues()
 {
-	const TArray<UDlgDialogue*> Dialogues = UDlgManager::GetAllDialoguesFromMemory();
+	return SaveDialogues(GetAllBatchDialogues());
+}
+
+bool FDlgEditorUtilities::SaveDialogues(const TArray<UDlgDialogue*>& Dialogues, bool bPromptForCheckout, bool bShowProgress)
+{
+	check(IsInGameThread());
 	TArray<UPackage*> PackagesToSave;
-	const bool bBatchOnlyInGameDialogues = GetDefault<UDlgSystemSettings>()->bBatchOnlyInGameDialogues;
+	for (UDlgDialogue* Dialogue : Dialogues)
+	{
+		// The text files are written all at once at the end
+		Dialogue->DisableExportToFileOnSave();
+		Dialogue->MarkPackageDirty();
+		PackagesToSave.AddUnique(Dialogue->GetOutermost());
+	}
 
+	static constexpr bool bCheckDirty = false;
+	bool bSaved = false;
+	if (bPromptForCheckout)
+	{
+		static constexpr bool bPromptToSave = false;
+		bSaved = FEditorFileUtils::PromptForCheckoutAndSave(PackagesToSave, bCheckDirty, bPromptToSave) == FEditorFileUtils::EPromptReturnCode::PR_Success;
+	}
+	else
+	{
+		bSaved = UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, bCheckDirty);
+	}
+
+	// A saved package is not dirty anymore, the dialogues that failed to save (or were not checked out) keep their old text files
+	TArray<UDlgDialogue*> SavedDialogues;
 	for (UDlgDialogue* Dialogue : Dialogues)
 	{
-		// Ignore, not in game directory
-		if (bBatchOnlyInGameDialogues && !Dialogue->IsInProjectDirectory())
+		Dialogue->EnableExportToFileOnSave();
+		if (!Dialogue->GetOutermost()->IsDirty())
+		{
+			SavedDialogues.Add(Dialogue);
+		}
+	}
+
+	const FDlgTextFileBatchResult ExportResult = ExportDialoguesToTextFiles(SavedDialogues, GetDefault<UDlgSystemSettings>()->DialogueTextFormat, bShowProgress);
+	return bSaved && ExportResult.IsSuccess();
+}
+
+FDlgTextFileBatchResult FDlgEditorUtilities::ExportDialoguesToTextFiles(
+	const TArray<UDlgDialogue*>& Dialogues,
+	EDlgDialogueTextFormat TextFormat,
+	bool bShowProgress
+)
+{
+	check(IsInGameThread());
+	FDlgTextFileBatchResult Result;
+
+	// One job for each dialogue and text format
+	struct FExportJob
+	{
+		UDlgDialogue* Dialogue = nullptr;
+		EDlgDialogueTextFormat TextFormat = EDlgDialogueTextFormat::None;
+		FString TextFileName;
+
+		// Has the snapshot and then the serialized data, only alive while its batch is written
+		TUniquePtr<IDlgWriter> Writer;
+
+		// Of the serialized data, see UDlgDialogue::UpdateTextFileContentHash
+		uint64 ContentHash = 0;
+		bool bSucceeded = false;
+	};
+	TArray<FExportJob> Jobs;
+	const TArray<EDlgDialogueTextFormat> TextFormats = GetBatchTextFormats(TextFormat);
+	for (UDlgDialogue* Dialogue : Dialogues)
+	{
+		if (!IsValid(Dialogue))
 		{
 			continue;
 		}
 
-		Dialogue->MarkPackageDirty();
-		PackagesToSave.Add(Dialogue->GetOutermost());
+		for (const EDlgDialogueTextFormat CurrentTextFormat : TextFormats)
+		{
+			FExportJob& Job = Jobs.AddDefaulted_GetRef();
+			Job.Dialogue = Dialogue;
+			Job.TextFormat = CurrentTextFormat;
+			Job.TextFileName = Dialogue->GetTextFilePathName(CurrentTextFormat);
+		}
+	}
+	if (Jobs.Num() == 0)
+	{
+		return Result;
 	}
 
-	static constexpr bool bCheckDirty = false;
-	static constexpr bool bPromptToSave = false;
-	return FEditorFileUtils::PromptForCheckoutAndSave(PackagesToSave, bCheckDirty, bPromptToSave) == FEditorFileUtils::EPromptReturnCode::PR_Success;
+	FScopedSlowTask SlowTask(Jobs.Num(), NSLOCTEXT("DlgEditorUtilities", "ExportDialoguesToTextFiles", "Exporting Dialogues to text files"));
+	if (bShowProgress)
+	{
+		SlowTask.MakeDialog(true);
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	int32 NumProcessedJobs = 0;
+	for (int32 BatchStart = 0; BatchStart < Jobs.Num(); BatchStart += DlgTextFileBatchSize)
+	{
+		if (SlowTask.ShouldCancel())
+		{
+			Result.bCanceled = true;
+			break;
+		}
+
+		const int32 BatchNum = FMath::Min(DlgTextFileBatchSize, Jobs.Num() - BatchStart);
+		SlowTask.EnterProgressFrame(
+			BatchNum,
+			FText::Format(
+				NSLOCTEXT("DlgEditorUtilities", "ExportDialoguesToTextFilesProgress", "Exporting Dialogues to text files ({0}/{1})"),
+				FText::AsNumber(BatchStart), FText::AsNumber(Jobs.Num())
+			)
+		);
+
+		// Snapshot on the game thread, the writers read the UObjects through reflection
+		for (int32 Index = BatchStart; Index < BatchStart + BatchNum; Index++)
+		{
+			FExportJob& Job = Jobs[Index];
+			if (Job.TextFileName.IsEmpty())
+			{
+				continue;
+			}
+
+			Job.Writer = UDlgDialogue::CreateTextFormatWriter(Job.TextFormat);
+			Job.Writer->WriteSnapshot(Job.Dialogue->GetClass(), Job.Dialogue);
+			Job.ContentHash = Job.Dialogue->ComputeTextFileContentHash(Job.TextFormat);
+		}
+
+		// Serialize the snapshots and write the files in parallel, no UObject is touched here
+		ParallelFor(BatchNum, [&Jobs, BatchStart](int32 Index)
+		{
+			FExportJob& Job = Jobs[BatchStart + Index];
+			if (Job.Writer.IsValid())
+			{
+				Job.Writer->FinishWrite();
+				Job.bSucceeded = Job.Writer->ExportToFile(Job.TextFileName);
+			}
+		});
+
+		for (int32 Index = BatchStart; Index < BatchStart + BatchNum; Index++)
+		{
+			FExportJob& Job = Jobs[Index];
+			Job.Writer.Reset();
+			if (Job.bSucceeded)
+			{
+				Job.Dialogue->UpdateTextFileContentHash(Job.ContentHash);
+			}
+		}
+		NumProcessedJobs += BatchNum;
+	}
+
+	for (int32 Index = 0; Index < NumProcessedJobs; Index++)
+	{
+		const FExportJob& Job = Jobs[Index];
+		if (Job.bSucceeded)
+		{
+			Result.NumSucceeded++;
+		}
+		else
+		{
+			Result.NumFailed++;
+			UE_LOG(
+				LogDlgSystemEditor,
+				Error,
+				TEXT("ExportDialoguesToTextFiles - Could not export Dialogue = `%s` TO file = `%s`"),
+				*Job.Dialogue->GetPathName(), *Job.TextFileName
+			);
+		}
+	}
+
+	UE_LOG(
+		LogDlgSystemEditor,
+		Log,
+		TEXT("ExportDialoguesToTextFiles - Exported %d text files in %.2f seconds, %d failed%s"),
+		Result.NumSucceeded, FPlatformTime::Seconds() - StartTime, Result.NumFailed, Result.bCanceled ? TEXT(", canceled") : TEXT("")
+	);
+	return Result;
+}
+
+FDlgTextFileBatchResult FDlgEditorUtilities::ImportDialoguesFromTextFiles(
+	const TArray<UDlgDialogue*>& Dialogues,
+	EDlgDialogueTextFormat TextFormat,
+	bool bShowProgress
+)
+{
+	check(IsInGameThread());
+	FDlgTextFileBatchResult Result;
+
+	// One job for each dialogue and text format
+	struct FImportJob
+	{
+		UDlgDialogue* Dialogue = nullptr;
+		EDlgDialogueTextFormat TextFormat = EDlgDialogueTextFormat::None;
+		FString TextFileName;
+		bool bFileExists = false;
+
+		// Has the parsed data, only alive while its batch is applied
+		TUniquePtr<IDlgParser> Parser;
+	};
+	TArray<FImportJob> Jobs;
+	const TArray<EDlgDialogueTextFormat> TextFormats = GetBatchTextFormats(TextFormat);
+	for (UDlgDialogue* Dialogue : Dialogues)
+	{
+		if (!IsValid(Dialogue))
+		{
+			continue;
+		}
+
+		for (const EDlgDialogueTextFormat CurrentTextFormat : TextFormats)
+		{
+			FImportJob& Job = Jobs.AddDefaulted_GetRef();
+			Job.Dialogue = Dialogue;
+			Job.TextFormat = CurrentTextFormat;
+			Job.TextFileName = Dialogue->GetTextFilePathName(CurrentTextFormat);
+		}
+	}
+	if (Jobs.Num() == 0)
+	{
+		return Result;
+	}
+
+	FScopedSlowTask SlowTask(Jobs.Num(), NSLOCTEXT("DlgEditorUtilities", "ImportDialoguesFromTextFiles", "Importing Dialogues from text files"));
+	if (bShowProgress)
+	{
+		SlowTask.MakeDialog(true);
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 BatchStart = 0; BatchStart < Jobs.Num(); BatchStart += DlgTextFileBatchSize)
+	{
+		if (SlowTask.ShouldCancel())
+		{
+			Result.bCanceled = true;
+			break;
+		}
+
+		const int32 BatchNum = FMath::Min(DlgTextFileBatchSize, Jobs.Num() - BatchStart);
+		SlowTask.EnterProgressFrame(
+			BatchNum,
+			FText::Format(
+				NSLOCTEXT("DlgEditorUtilities", "ImportDialoguesFromTextFilesProgress", "Importing Dialogues from text files ({0}/{1})"),
+				FText::AsNumber(BatchStart), FText::AsNumber(Jobs.Num())
+			)
+		);
+
+		// Load and parse the files in parallel, no UObject is touched here
+		ParallelFor(BatchNum, [&Jobs, BatchStart](int32 Index)
+		{
+			FImportJob& Job = Jobs[BatchStart + Index];
+			Job.bFileExists = !Job.TextFileName.IsEmpty() && IFileManager::Get().FileExists(*Job.TextFileName);
+			if (!Job.bFileExists)
+			{
+				return;
+			}
+
+			Job.Parser = UDlgDialogue::CreateTextFormatParser(Job.TextFormat);
+			Job.Parser->InitializeParser(Job.TextFileName);
+			if (Job.Parser->IsValidFile())
+			{
+				Job.Parser->PreParse();
+			}
+		});
+
+		// Apply to the dialogues on the game thread, in order
+		for (int32 Index = BatchStart; Index < BatchStart + BatchNum; Index++)
+		{
+			FImportJob& Job = Jobs[Index];
+
+			// Same as ImportFromFileFormat, with All only the existing files are imported
+			if (!Job.bFileExists)
+			{
+				if (TextFormat != EDlgDialogueTextFormat::All)
+				{
+					Result.NumFailed++;
+					UE_LOG(
+						LogDlgSystemEditor,
+						Error,
+						TEXT("ImportDialoguesFromTextFiles - Reloading data for Dialogue = `%s` FROM file = `%s` FAILED, because the file does not exist"),
+						*Job.Dialogue->GetPathName(), *Job.TextFileName
+					);
+				}
+				continue;
+			}
+			if (!Job.Parser->IsValidFile())
+			{
+				Result.NumFailed++;
+				Job.Parser.Reset();
+				continue;
+			}
+
+			// Same as FDlgEditor::OnCommandDialogueReload, text file -> dialogue data -> graph
+			Job.Dialogue->ImportFromParser(*Job.Parser, Job.TextFileName);
+			Job.Dialogue->ClearGraph();
+			Job.Dialogue->MarkPackageDirty();
+			Job.Parser.Reset();
+			Result.NumSucceeded++;
+		}
+	}
+
+	UE_LOG(
+		LogDlgSystemEditor,
+		Log,
+		TEXT("ImportDialoguesFromTextFiles - Imported %d text files in %.2f seconds, %d failed%s"),
+		Result.NumSucceeded, FPlatformTime::Seconds() - StartTime, Result.NumFailed, Result.bCanceled ? TEXT(", canceled") : TEXT("")
+	);
+	return Result;
 }
 
 bool FDlgEditorUtilities::DeleteAllDialoguesTextFiles()
 {
-	const TArray<UDlgDialogue*> Dialogues = UDlgManager::GetAllDialoguesFromMemory();
-	const bool bBatchOnlyInGameDialogues = GetDefault<UDlgSystemSettings>()->bBatchOnlyInGameDialogues;
-	for (const UDlgDialogue* Dialogue : Dialogues)
+	// Collect the paths here, only the file system is touched in parallel
+	TArray<FString> TextFilePathNames;
+	const TSet<FString>& FileExtensions = GetDefault<UDlgSystemSettings>()->GetAllTextFileExtensions();
+	for (const UDlgDialogue* Dialogue : GetAllBatchDialogues())
 	{
-		// Ignore, not in game directory
-		if (bBatchOnlyInGameDialogues && !Dialogue->IsInProjectDirectory())
+		const FString TextFilePathName = Dialogue->GetTextFilePathName(false);
+		if (TextFilePathName.IsEmpty())
 		{
 			continue;
 		}
 
-		Dialogue->DeleteAllTextFiles();
+		for (const FString& FileExtension : FileExtensions)
+		{
+			TextFilePathNames.Add(TextFilePathName + FileExtension);
+		}
 	}
 
-	return true;
+	std::atomic<int32> NumFailed(0);
+	ParallelFor(TextFilePathNames.Num(), [&TextFilePathNames, &NumFailed](int32 Index)
+	{
+		IFileManager& FileManager = IFileManager::Get();
+		const FString& PathName = TextFilePathNames[Index];
+		if (FileManager.FileExists(*PathName) && !FileManager.Delete(*PathName))
+		{
+			UE_LOG(LogDlgSystemEditor, Error, TEXT("Can't delete file at path = `%s`"), *PathName);
+			NumFailed++;
+		}
+	});
+
+	return NumFailed == 0;
 }
 
 bool FDlgEditorUtilities::PickChildrenOfClass(const FText& TitleText, UClass*& OutChosenClass, UClass* Class)
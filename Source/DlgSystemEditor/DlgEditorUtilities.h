@@ -7,6 +7,7 @@
 #include "Editor/Graph/DialogueGraph.h"
 #include "DlgSystem/Nodes/DlgNode.h"
 #include "DlgSystem/NYEngineVersionHelpers.h"
+#include "DlgSystem/DlgSystemSettings.h"
 #include "Subsystems/AssetEditorSubsystem.h"
 
 enum class EDlgBlueprintOpenType : uint8
@@ -16,6 +17,19 @@ enum class EDlgBlueprintOpenType : uint8
 	Event
 };
 
+// Result of the batch text file operations, see FDlgEditorUtilities::ExportDialoguesToTextFiles
+struct FDlgTextFileBatchResult
+{
+	// Number of text files written/read
+	int32 NumSucceeded = 0;
+	int32 NumFailed = 0;
+
+	// Canceled from the progress dialog, the files after the canceled batch were not touched
+	bool bCanceled = false;
+
+	bool IsSuccess() const { return NumFailed == 0 && !bCanceled; }
+};
+
 //////////////////////////////////////////////////////////////////////////
 // FDlgEditorUtilities
 
@@ -113,16 +127,14 @@ public:
 	}
 
 	/**
-	 * Automatically reposition all the nodes in the graph.
+	 * Automatically reposition all the nodes in the graph, in layers, see FDlgGraphLayout.
 	 *
-	 * @param	RootNode				The Node that is considered the node
-	 * @param	GraphNodes				The rest of the graph nodes
+	 * @param	GraphNodes				All the graph nodes, including the root nodes
 	 * @param	OffsetBetweenColumnsX   The offset between nodes on the X axis
 	 * @param	OffsetBetweenRowsY		The offset between nodes on the Y axis
 	 * @param	bIsDirectionVertical	Is direction vertical? If false it is horizontal
 	 */
 	static void AutoPositionGraphNodes(
-		UDialogueGraphNode* RootNode,
 		const TArray<UDialogueGraphNode*>& GraphNodes,
 		int32 OffsetBetweenColumnsX,
 		int32 OffsetBetweenRowsY,
@@ -226,10 +238,49 @@ public:
 	// Gets the Dialogue for the provided UEdGraphNode
 	static UDlgDialogue* GetDialogueFromGraphNode(const UEdGraphNode* GraphNode);
 
-	// Save all the dialogues.
+	// Save all the dialogues, see SaveDialogues.
 	// @return True on success or false on failure.
 	static bool SaveAllDialogues();
 
+	/**
+	 * Saves the packages of the Dialogues. Their text files are written at the end with ExportDialoguesToTextFiles
+	 * instead of one by one while saving, only for the dialogues that were saved.
+	 *
+	 * @param	bPromptForCheckout	Prompts for the source control checkout of the packages, otherwise they are saved directly (e.g. commandlets)
+	 * @param	bShowProgress		See ExportDialoguesToTextFiles
+	 * @return True on success or false on failure.
+	 */
+	static bool SaveDialogues(const TArray<UDlgDialogue*>& Dialogues, bool bPromptForCheckout = true, bool bShowProgress = true);
+
+	/**
+	 * Exports the Dialogues into their text files of TextFormat (every format for All).
+	 * The game thread only snapshots the dialogues (see IDlgWriter::WriteSnapshot), the snapshots are serialized
+	 * and the files are written on the task graph, in batches.
+	 *
+	 * @param	bShowProgress	Shows a progress dialog, it can cancel between the batches
+	 */
+	static FDlgTextFileBatchResult ExportDialoguesToTextFiles(
+		const TArray<UDlgDialogue*>& Dialogues,
+		EDlgDialogueTextFormat TextFormat,
+		bool bShowProgress = true
+	);
+
+	/**
+	 * Imports the Dialogues from their text files of TextFormat (every existing format for All).
+	 * The files are loaded and parsed (as far as possible without touching UObjects, see IDlgParser::PreParse) on the task graph in batches,
+	 * the parsed data is applied to the dialogues on the game thread.
+	 *
+	 * @param	bShowProgress	Shows a progress dialog, it can cancel between the batches
+	 */
+	static FDlgTextFileBatchResult ImportDialoguesFromTextFiles(
+		const TArray<UDlgDialogue*>& Dialogues,
+		EDlgDialogueTextFormat TextFormat,
+		bool bShowProgress = true
+	);
+
+	// All the dialogues from memory the batch operations work on, see bBatchOnlyInGameDialogues
+	static TArray<UDlgDialogue*> GetAllBatchDialogues();
+
 	// Deletes all the dialogues text files
 	// @return True on success or false on failure.
 	static bool DeleteAllDialoguesTextFiles();
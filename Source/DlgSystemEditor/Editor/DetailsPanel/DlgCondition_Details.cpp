@@ -414,7 +414,7 @@ TArray<FName> FDlgCondition_Details::GetCallbackNamesForParticipant(bool bCurren
 			}
 			else
 			{
-				Suggestions.Append(UDlgManager::GetDialoguesParticipantBoolNames(ParticipantName));
+				Suggestions.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::BoolVariable, ParticipantName));
 			}
 		}
 		break;
@@ -438,7 +438,7 @@ TArray<FName> FDlgCondition_Details::GetCallbackNamesForParticipant(bool bCurren
 			}
 			else
 			{
-				Suggestions.Append(UDlgManager::GetDialoguesParticipantFloatNames(ParticipantName));
+				Suggestions.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::FloatVariable, ParticipantName));
 			}
 		}
 		break;
@@ -462,7 +462,7 @@ TArray<FName> FDlgCondition_Details::GetCallbackNamesForParticipant(bool bCurren
 			}
 			else
 			{
-				Suggestions.Append(UDlgManager::GetDialoguesParticipantIntNames(ParticipantName));
+				Suggestions.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::IntVariable, ParticipantName));
 			}
 		}
 		break;
@@ -486,7 +486,7 @@ TArray<FName> FDlgCondition_Details::GetCallbackNamesForParticipant(bool bCurren
 			}
 			else
 			{
-				Suggestions.Append(UDlgManager::GetDialoguesParticipantFNameNames(ParticipantName));
+				Suggestions.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::FNameVariable, ParticipantName));
 			}
 		}
 		break;
@@ -500,7 +500,7 @@ TArray<FName> FDlgCondition_Details::GetCallbackNamesForParticipant(bool bCurren
 		}
 		else
 		{
-			Suggestions.Append(UDlgManager::GetDialoguesParticipantConditionNames(ParticipantName));
+			Suggestions.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::Condition, ParticipantName));
 		}
 		break;
 	}
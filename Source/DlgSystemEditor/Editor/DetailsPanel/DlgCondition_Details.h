@@ -8,6 +8,7 @@
 #include "DlgSystem/DlgDialogue.h"
 #include "DlgSystem/DlgCondition.h"
 #include "DlgSystem/DlgManager.h"
+#include "DlgSystemEditor/Search/DlgSuggestionCache.h"
 #include "DlgDetailsPanelUtils.h"
 #include "DlgSystemEditor/Editor/DetailsPanel/Widgets/DlgTextPropertyPickList_CustomRowHelper.h"
 
@@ -183,7 +184,7 @@ private:
 	// Gets the ParticipantNames from all Dialogues.
 	TArray<FName> GetDialoguesParticipantNames() const
 	{
-		return UDlgManager::GetDialoguesParticipantNames();
+		return FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::ParticipantName);
 	}
 
 	// Gets the current Dialogue Participant Names.
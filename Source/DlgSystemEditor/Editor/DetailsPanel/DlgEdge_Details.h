@@ -5,6 +5,7 @@
 #include "Layout/Visibility.h"
 #include "DlgDetailsPanelUtils.h"
 #include "DlgSystem/DlgManager.h"
+#include "DlgSystemEditor/Search/DlgSuggestionCache.h"
 
 class UDlgDialogue;
 class FDlgMultiLineEditableTextBox_CustomRowHelper;
@@ -48,7 +49,7 @@ public:
 	/** Gets the Speaker States from all Dialogues. */
 	TArray<FName> GetDialoguesSpeakerStates() const
 	{
-		return UDlgManager::GetDialoguesSpeakerStates();
+		return FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::SpeakerState);
 	}
 
 	/** Handler for when the speaker state is changed */
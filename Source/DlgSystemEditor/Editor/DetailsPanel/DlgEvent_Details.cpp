@@ -205,19 +205,19 @@ TArray<FName> FDlgEvent_Details::GetDialoguesParticipantEventNames() const
 	switch (EventType)
 	{
 	case EDlgEventType::ModifyBool:
-		Suggestions.Append(UDlgManager::GetDialoguesParticipantBoolNames(ParticipantName));
+		Suggestions.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::BoolVariable, ParticipantName));
 		break;
 
 	case EDlgEventType::ModifyFloat:
-		Suggestions.Append(UDlgManager::GetDialoguesParticipantFloatNames(ParticipantName));
+		Suggestions.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::FloatVariable, ParticipantName));
 		break;
 
 	case EDlgEventType::ModifyInt:
-		Suggestions.Append(UDlgManager::GetDialoguesParticipantIntNames(ParticipantName));
+		Suggestions.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::IntVariable, ParticipantName));
 		break;
 
 	case EDlgEventType::ModifyName:
-		Suggestions.Append(UDlgManager::GetDialoguesParticipantFNameNames(ParticipantName));
+		Suggestions.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::FNameVariable, ParticipantName));
 		break;
 
 	case EDlgEventType::ModifyClassIntVariable:
@@ -278,7 +278,7 @@ TArray<FName> FDlgEvent_Details::GetDialoguesParticipantEventNames() const
 
 	case EDlgEventType::Event:
 	default:
-		Suggestions.Append(UDlgManager::GetDialoguesParticipantEventNames(ParticipantName));
+		Suggestions.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::Event, ParticipantName));
 		break;
 	}
 
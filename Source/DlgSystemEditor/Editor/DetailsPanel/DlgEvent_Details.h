@@ -7,6 +7,7 @@
 
 #include "DlgSystem/DlgEvent.h"
 #include "DlgSystem/DlgManager.h"
+#include "DlgSystemEditor/Search/DlgSuggestionCache.h"
 #include "DlgDetailsPanelUtils.h"
 
 class FDlgTextPropertyPickList_CustomRowHelper;
@@ -110,7 +111,7 @@ private:
 	// Gets the ParticipantNames from all Dialogues.
 	TArray<FName> GetDialoguesParticipantNames() const
 	{
-		return UDlgManager::GetDialoguesParticipantNames();
+		return FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::ParticipantName);
 	}
 
 	// Gets the current Dialogue Participant Names.
@@ -5,6 +5,7 @@
 #include "IDetailPropertyRow.h"
 
 #include "DlgSystem/DlgManager.h"
+#include "DlgSystemEditor/Search/DlgSuggestionCache.h"
 #include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode.h"
 #include "DlgDetailsPanelUtils.h"
 
@@ -37,7 +38,7 @@ private:
 	/** Gets the ParticipantNames from all Dialogues. */
 	TArray<FName> GetDialoguesParticipantNames() const
 	{
-		return UDlgManager::GetDialoguesParticipantNames();
+		return FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::ParticipantName);
 	}
 
 	/** Gets the current Dialogue Participant Names. */
@@ -49,7 +50,7 @@ private:
 	/** Gets the Speaker States from all Dialogues. */
 	TArray<FName> GetDialoguesSpeakerStates() const
 	{
-		return UDlgManager::GetDialoguesSpeakerStates();
+		return FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::SpeakerState);
 	}
 
 	/** Handler for when text in the editable text box changed */
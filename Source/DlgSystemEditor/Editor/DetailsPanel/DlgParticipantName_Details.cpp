@@ -8,7 +8,7 @@
 #include "DlgSystemEditor/Editor/DetailsPanel/Widgets/DlgTextPropertyPickList_CustomRowHelper.h"
 
 #include "DlgSystem/DlgParticipantName.h"
-#include "DlgSystem/DlgManager.h"
+#include "DlgSystemEditor/Search/DlgSuggestionCache.h"
 
 #define LOCTEXT_NAMESPACE "DialogueParticipantName_Details"
 
@@ -41,7 +41,7 @@ void FDlgParticipantName_Details::CustomizeChildren(TSharedRef<IPropertyHandle>
 
 TArray<FName> FDlgParticipantName_Details::GetAllParticipantNames() const
 {
-	return UDlgManager::GetDialoguesParticipantNames();
+	return FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::ParticipantName);
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -5,6 +5,7 @@
 #include "IDetailPropertyRow.h"
 
 #include "DlgSystem/DlgManager.h"
+#include "DlgSystemEditor/Search/DlgSuggestionCache.h"
 #include "DlgDetailsPanelUtils.h"
 
 class FDlgTextPropertyPickList_CustomRowHelper;
@@ -49,13 +50,13 @@ private:
 	/** Gets the ParticipantNames from all Dialogues. */
 	TArray<FName> GetDialoguesParticipantNames() const
 	{
-		return UDlgManager::GetDialoguesParticipantNames();
+		return FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::ParticipantName);
 	}
 
 	/** Gets the Speaker States from all Dialogues. */
 	TArray<FName> GetDialoguesSpeakerStates() const
 	{
-		return UDlgManager::GetDialoguesSpeakerStates();
+		return FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::SpeakerState);
 	}
 
 	/** Gets the current Dialogue Participant Names. */
@@ -144,7 +144,7 @@ TArray<FName> FDlgTextArgument_Details::GetDialogueVariableNames(bool bCurrentOn
 			}
 			else
 			{
-				Suggestions.Append(UDlgManager::GetDialoguesParticipantIntNames(ParticipantName));
+				Suggestions.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::IntVariable, ParticipantName));
 			}
 			break;
 
@@ -165,7 +165,7 @@ TArray<FName> FDlgTextArgument_Details::GetDialogueVariableNames(bool bCurrentOn
 			}
 			else
 			{
-				Suggestions.Append(UDlgManager::GetDialoguesParticipantFloatNames(ParticipantName));
+				Suggestions.Append(FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::FloatVariable, ParticipantName));
 			}
 			break;
 
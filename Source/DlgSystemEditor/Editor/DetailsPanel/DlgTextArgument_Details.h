@@ -7,6 +7,7 @@
 #include "DlgSystem/DlgTextArgument.h"
 #include "DlgDetailsPanelUtils.h"
 #include "DlgSystem/DlgManager.h"
+#include "DlgSystemEditor/Search/DlgSuggestionCache.h"
 
 class FDlgTextPropertyPickList_CustomRowHelper;
 class IDetailPropertyRow;
@@ -82,7 +83,7 @@ private:
 	/** Gets the ParticipantNames from all Dialogues. */
 	TArray<FName> GetDialoguesParticipantNames() const
 	{
-		return UDlgManager::GetDialoguesParticipantNames();
+		return FDlgSuggestionCache::Get().GetSuggestions(EDlgSuggestionType::ParticipantName);
 	}
 
 	/** Gets the current Dialogue Participant Names. */
@@ -315,6 +315,7 @@ void SDlgTextPropertyPickList::HandleComboBoxOpened()
 {
 	GetSearchBoxWidget();
 	FocusSearchBox();
+	RebuildSuggestionIndex();
 	UpdateSuggestionList();
 }
 
@@ -448,16 +449,14 @@ void SDlgTextPropertyPickList::HandleListSelectionChanged(TextListItem NewValue,
 void SDlgTextPropertyPickList::HandleContextCheckboxChanged(ECheckBoxState CheckState)
 {
 	bIsContextCheckBoxChecked = CheckState == ECheckBoxState::Checked;
+	RebuildSuggestionIndex();
 	UpdateSuggestionList();
 	// Return focus to search input so it is easier to navigate down.
 	FocusSearchBox();
 }
 
-void SDlgTextPropertyPickList::UpdateSuggestionList()
+void SDlgTextPropertyPickList::RebuildSuggestionIndex()
 {
-	const FString TypedText = InputTextWidget.IsValid() ? InputTextWidget->GetText().ToString() : TEXT("");
-	Suggestions.Empty();
-
 	// Find out what pool of suggestions to use
 	TArray<FString> AllSuggestions;
 	if (bUseStringSuggestions)
@@ -478,21 +477,39 @@ void SDlgTextPropertyPickList::UpdateSuggestionList()
 			Temp = SuggestionAttributes.Get();
 		}
 
+		AllSuggestions.Reserve(Temp.Num());
 		for (FName Name : Temp)
 		{
 			AllSuggestions.Add(Name.ToString());
 		}
 	}
 
+	SuggestionIndex = FDlgSuggestionIndex(AllSuggestions);
+	LastFilterText.Reset();
+	LastFilterIndices.Reset();
+}
+
+void SDlgTextPropertyPickList::UpdateSuggestionList()
+{
+	const FString TypedText = InputTextWidget.IsValid() ? InputTextWidget->GetText().ToString() : TEXT("");
+	Suggestions.Empty();
 
 	// Must have typed something, but that something must be different from the set value
 	const bool bTypedSomething = TypedText.Len() > 0 && TypedText != TextAttribute.Get().ToString();
-	for (const FString& Suggestion : AllSuggestions)
+	const FString FilterText = bTypedSomething ? TypedText : FString();
+
+	// Typed more characters, the suggestions can only be the ones found before
+	const bool bNarrowDown = !LastFilterText.IsEmpty() && FilterText.StartsWith(LastFilterText, ESearchCase::IgnoreCase);
+	TArray<int32> FilterIndices;
+	SuggestionIndex.FindSuggestions(FilterText, bNarrowDown ? &LastFilterIndices : nullptr, FilterIndices);
+	LastFilterText = FilterText;
+	LastFilterIndices = FilterIndices;
+
+	const TArray<FString>& AllSuggestions = SuggestionIndex.GetSuggestions();
+	Suggestions.Reserve(FilterIndices.Num());
+	for (const int32 Index : FilterIndices)
 	{
-		if (!bTypedSomething || Suggestion.Contains(TypedText))
-		{
-			Suggestions.Add(MakeShared<FString>(Suggestion));
-		}
+		Suggestions.Add(MakeShared<FString>(AllSuggestions[Index]));
 	}
 
 	if (ListViewWidget.IsValid())
@@ -8,6 +8,8 @@
 #include "Widgets/Input/SComboButton.h"
 #include "Widgets/Input/SCheckBox.h"
 
+#include "DlgSystemEditor/Search/DlgSuggestionCache.h"
+
 class IPropertyHandle;
 
 /**
@@ -207,6 +209,9 @@ private:
 		return bIsContextCheckBoxChecked ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 	}
 
+	/** Takes a snapshot of the suggestions attributes into the SuggestionIndex, the attributes are not queried while typing */
+	void RebuildSuggestionIndex();
+
 	/** Updates and shows or hides the suggestion list */
 	void UpdateSuggestionList();
 
@@ -281,6 +286,13 @@ private:
 	 */
 	TArray<TextListItem> Suggestions;
 
+	/** All possible suggestions at the time the menu was opened (or the context checkbox changed). See RebuildSuggestionIndex. */
+	FDlgSuggestionIndex SuggestionIndex;
+
+	/** The text the Suggestions were filtered with and their indices in the SuggestionIndex, typing more only filters these */
+	FString LastFilterText;
+	TArray<int32> LastFilterIndices;
+
 	/** Whether the SearchBox should delay notifying listeners of text changed events until the user is done typing */
 	bool bDelayChangeNotificationsWhileTyping = true;
 
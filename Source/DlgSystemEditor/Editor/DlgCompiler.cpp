@@ -28,6 +28,10 @@ void FDlgCompilerContext::Compile()
 	IndicesHistory.Empty();
 	NodesPath.Empty();
 	NextAvailableIndex = 0;
+	for (UDialogueGraphNode* GraphNode : DialogueGraphNodes)
+	{
+		GraphNode->SetCompiledParentNode(nullptr);
+	}
 
 	// The code below tries to reconstruct the Dialogue Nodes from the Graph Nodes (aka compile).
 	// The tricky part of the reconstructing (the Dialogue Nodes) is the node indices, because it takes
@@ -77,10 +81,171 @@ void FDlgCompilerContext::Compile()
 	FixBrokenOldIndicesAndUpdateGUID();
 
 	Dialogue->PostEditChange();
+	DialogueGraph->ClearDirtyGraphNodes();
 
 	FDlgEditorUtilities::RefreshDialogueEditorForGraph(DialogueGraph);
 }
 
+bool FDlgCompilerContext::CompileIncremental()
+{
+	check(Dialogue);
+	UDialogueGraph* DialogueGraph = CastChecked<UDialogueGraph>(Dialogue->GetGraph());
+	if (DialogueGraph->NeedsFullCompile() || DialogueGraph->GetDirtyGraphNodes().Num() == 0)
+	{
+		return false;
+	}
+
+	// The indices only stay the same if the BFS of Compile reaches every node from the same parent node as last time
+	// and the parent nodes reach their children in the same order. Only the dirty nodes changed their connections,
+	// for every other node this is already true.
+	// NOTE: unlike Compile, the children of the nodes that are not dirty are not sorted again, moving nodes is picked up
+	// by the next full compile (saving the Dialogue).
+
+	// Step 1. All the dirty nodes must still be in the graph
+	TArray<UDialogueGraphNode*> DirtyGraphNodes;
+	for (const TWeakObjectPtr<UDialogueGraphNode>& WeakGraphNode : DialogueGraph->GetDirtyGraphNodes())
+	{
+		UDialogueGraphNode* GraphNode = WeakGraphNode.Get();
+		if (!IsValid(GraphNode) || GraphNode->GetGraph() != DialogueGraph)
+		{
+			return false;
+		}
+		DirtyGraphNodes.Add(GraphNode);
+	}
+
+	// Step 2. The start nodes must stay in the same order
+	GraphNodeRoots = DialogueGraph->GetRootGraphNodes();
+	OrderRootGraphNodes();
+	const TArray<UDlgNode*>& StartNodes = Dialogue->GetStartNodes();
+	if (StartNodes.Num() != GraphNodeRoots.Num())
+	{
+		return false;
+	}
+	for (int32 Index = 0; Index < StartNodes.Num(); Index++)
+	{
+		if (StartNodes[Index]->GetGraphNode() != GraphNodeRoots[Index])
+		{
+			return false;
+		}
+	}
+
+	// Step 3. The dirty nodes must be reached from the same parent
+	for (const UDialogueGraphNode* GraphNode : DirtyGraphNodes)
+	{
+		if (!GraphNode->IsRootNode() && !IsReachedFromSameParentNode(GraphNode))
+		{
+			return false;
+		}
+	}
+
+	// Step 4. The dirty nodes must reach their children in the same order, the BFS tree is the same as last time after this
+	for (UDialogueGraphNode* GraphNode : DirtyGraphNodes)
+	{
+		GraphNode->SortChildrenBasedOnXLocation();
+		int32 LastChildOrder = INDEX_NONE;
+		for (const UDialogueGraphNode* ChildNode : GraphNode->GetChildNodes())
+		{
+			if (ChildNode->GetCompiledParentNode() != GraphNode)
+			{
+				continue;
+			}
+			if (GetBFSOrder(ChildNode) <= LastChildOrder)
+			{
+				return false;
+			}
+			LastChildOrder = GetBFSOrder(ChildNode);
+		}
+	}
+
+	// Step 5. Compile only the dirty nodes, the rest of the nodes and edges are the same
+	for (UDialogueGraphNode* GraphNode : DirtyGraphNodes)
+	{
+		GraphNode->CheckDialogueNodeSyncWithGraphNode();
+		const TArray<UDialogueGraphNode*> ChildNodes = GraphNode->GetChildNodes();
+		for (int32 ChildIndex = 0; ChildIndex < ChildNodes.Num(); ChildIndex++)
+		{
+			GraphNode->SetEdgeTargetIndexAt(ChildIndex, ChildNodes[ChildIndex]->GetDialogueNodeIndex());
+		}
+		SetChildEdgesCategorization(GraphNode);
+
+		GraphNode->ApplyCompilerWarnings();
+		GraphNode->CheckDialogueNodeSyncWithGraphNode(true);
+		UDlgNode* DialogueNode = GraphNode->GetMutableDialogueNode();
+		if (!DialogueNode->HasGUID())
+		{
+			DialogueNode->RegenerateGUID();
+		}
+	}
+
+	Dialogue->PostEditChange();
+	DialogueGraph->ClearDirtyGraphNodes();
+
+	FDlgEditorUtilities::RefreshDialogueEditorForGraph(DialogueGraph);
+	return true;
+}
+
+int32 FDlgCompilerContext::GetBFSOrder(const UDialogueGraphNode* GraphNode) const
+{
+	if (GraphNode->IsRootNode())
+	{
+		return GraphNodeRoots.IndexOfByKey(GraphNode) - GraphNodeRoots.Num();
+	}
+
+	return GraphNode->GetDialogueNodeIndex();
+}
+
+bool FDlgCompilerContext::IsReachedFromSameParentNode(const UDialogueGraphNode* GraphNode) const
+{
+	// Unknown or the first node of an isolated group, which one is first depends on the whole graph
+	const UDialogueGraphNode* CompiledParentNode = GraphNode->GetCompiledParentNode();
+	if (CompiledParentNode == nullptr)
+	{
+		return false;
+	}
+
+	// The BFS takes the nodes from the queue in order, the first parent in that order reaches this node
+	const UDialogueGraphNode* FirstParentNode = nullptr;
+	int32 FirstParentOrder = MAX_int32;
+	for (const UDialogueGraphNode* ParentNode : GraphNode->GetParentNodes())
+	{
+		const int32 ParentOrder = GetBFSOrder(ParentNode);
+		if (ParentOrder < FirstParentOrder)
+		{
+			FirstParentNode = ParentNode;
+			FirstParentOrder = ParentOrder;
+		}
+	}
+
+	return FirstParentNode == CompiledParentNode && FirstParentOrder < GetBFSOrder(GraphNode);
+}
+
+void FDlgCompilerContext::SetChildEdgesCategorization(const UDialogueGraphNode* GraphNode) const
+{
+	// Same as SetEdgesCategorization, the root nodes and the nodes no root node reaches are ignored
+	if (GraphNode->IsRootNode())
+	{
+		return;
+	}
+
+	// The path from the root node to the GraphNode, through the BFS tree
+	TSet<const UDialogueGraphNode*> PathNodes;
+	const UDialogueGraphNode* CurrentNode = GraphNode;
+	while (!CurrentNode->IsRootNode())
+	{
+		PathNodes.Add(CurrentNode);
+		CurrentNode = CurrentNode->GetCompiledParentNode();
+		if (CurrentNode == nullptr)
+		{
+			return;
+		}
+	}
+
+	for (UDialogueGraphNode_Edge* ChildEdgeNode : GraphNode->GetChildEdgeNodes())
+	{
+		ChildEdgeNode->SetIsPrimaryEdge(!PathNodes.Contains(ChildEdgeNode->GetChildNode()));
+	}
+}
+
 void FDlgCompilerContext::OrderRootGraphNodes()
 {
 	// order based on position
@@ -169,6 +334,7 @@ void FDlgCompilerContext::CompileGraphNode(UDialogueGraphNode* GraphNode)
 
 		// From This Node => Parent Node
 		NodesPath.Add(ChildNode, GraphNode);
+		ChildNode->SetCompiledParentNode(GraphNode);
 		NodeUnvisitedChildrenNum++;
 
 		// Assume they will be added in order.
@@ -233,35 +399,49 @@ bool FDlgCompilerContext::GetPathToNode(
 	return true;
 }
 
-bool FDlgCompilerContext::GetPathToNodeAsSet(
-	const UDialogueGraphNode* SourceNode,
-	const UDialogueGraphNode* TargetNode,
-	TSet<const UDialogueGraphNode*>& OutNodesInPath
-)
+void FDlgCompilerContext::SetEdgesCategorization()
 {
-	OutNodesInPath.Empty();
-	OutNodesInPath.Add(TargetNode);
+	// If the child node (the node the edge points to) of an edge is not on the path from the root node to the parent node of
+	// the edge, the path to the child node through this edge is unique and the edge is primary, otherwise it is secondary.
+	// The paths (NodesPath) form a spanning forest with a tree for each root node. Numbering the nodes when a DFS of this forest
+	// enters and exits them tells if a node is on the path to another node (is an ancestor of it) in constant time.
+	// Complexity O(|V| + |E|)
+	TMap<const UDialogueGraphNode*, TArray<const UDialogueGraphNode*>> TreeChildren;
+	TreeChildren.Reserve(VisitedNodes.Num());
+	for (const auto& Elem : NodesPath)
+	{
+		TreeChildren.FindOrAdd(Elem.Value).Add(Elem.Key);
+	}
 
-	const UDialogueGraphNode* CurrentNode = TargetNode;
-	while (CurrentNode != SourceNode)
+	// Node => (enter time, exit time)
+	TMap<const UDialogueGraphNode*, FIntPoint> VisitTimes;
+	VisitTimes.Reserve(VisitedNodes.Num());
+	int32 Time = 0;
+
+	// Node => index of the next tree child to visit
+	TArray<TPair<const UDialogueGraphNode*, int32>> Stack;
+	for (const UDialogueGraphNode_Root* RootNode : GraphNodeRoots)
 	{
-		const UDialogueGraphNode** ParentNodePtr = NodesPath.Find(CurrentNode);
-		if (ParentNodePtr == nullptr)
+		VisitTimes.Add(RootNode, FIntPoint(Time++, INDEX_NONE));
+		Stack.Emplace(RootNode, 0);
+		while (Stack.Num() > 0)
 		{
-			return false;
+			TPair<const UDialogueGraphNode*, int32>& Top = Stack.Last();
+			const TArray<const UDialogueGraphNode*>* Children = TreeChildren.Find(Top.Key);
+			if (Children && Top.Value < Children->Num())
+			{
+				const UDialogueGraphNode* ChildNode = (*Children)[Top.Value++];
+				VisitTimes.Add(ChildNode, FIntPoint(Time++, INDEX_NONE));
+				Stack.Emplace(ChildNode, 0);
+			}
+			else
+			{
+				VisitTimes.FindChecked(Top.Key).Y = Time++;
+				Stack.Pop();
+			}
 		}
-
-		OutNodesInPath.Add(*ParentNodePtr);
-		CurrentNode = *ParentNodePtr;
 	}
 
-	return true;
-}
-
-void FDlgCompilerContext::SetEdgesCategorization()
-{
-	// If there is an unique path from any root node to the child node (the node the edge points to) of this edge it means the
-	// edge is primary, otherwise it is secondary.
 	for (UDialogueGraphNode* GraphNode : VisitedNodes)
 	{
 		// Ignore the root nodes
@@ -270,19 +450,9 @@ void FDlgCompilerContext::SetEdgesCategorization()
 			continue;
 		}
 
-		// Get existing path from all root nodes, multiple root node could lead to the same node
-		TArray<TSet<const UDialogueGraphNode*>> PathListToThisNodeSet;
-		for (int32 i = 0; i < GraphNodeRoots.Num(); ++i)
-		{
-			TSet<const UDialogueGraphNode*> Path;
-			if (GetPathToNodeAsSet(GraphNodeRoots[0], GraphNode, Path))
-			{
-				PathListToThisNodeSet.Add(Path);
-			}
-		}
-
 		// not a single root node reaches the node -> skip
-		if (PathListToThisNodeSet.Num() == 0)
+		const FIntPoint* NodeTimes = VisitTimes.Find(GraphNode);
+		if (NodeTimes == nullptr)
 		{
 			UE_LOG(LogDlgSystemEditor, Warning, TEXT("Can't find a path from the root node to the node with index = %d"), GraphNode->GetDialogueNodeIndex());
 			continue;
@@ -291,22 +461,10 @@ void FDlgCompilerContext::SetEdgesCategorization()
 		// (input pin) GraphNode (output pin) -> (input pin) ChildEdgeNode (output pin) -> (input pin) ChildNode (output pin)
 		for (UDialogueGraphNode_Edge* ChildEdgeNode : GraphNode->GetChildEdgeNodes())
 		{
-			// Unique path is determined by:
-			// If the path to the parent Node of this Edge (aka PathToThisNode) does not contain the ChildNode
-			// it means this path is unique (primary edge) to the ChildNode
-
-			// if any path is unique the edge is considered to be primary
-			bool bHasPrimaryPath = false;
-			for (int32 i = 0; i < PathListToThisNodeSet.Num(); ++i)
-			{
-				if (!PathListToThisNodeSet[i].Contains(ChildEdgeNode->GetChildNode()))
-				{
-					bHasPrimaryPath = true;
-					break;
-				}
-			}
-
-			ChildEdgeNode->SetIsPrimaryEdge(bHasPrimaryPath);
+			// Is the ChildNode on the path to the GraphNode (or the GraphNode itself)?
+			const FIntPoint* ChildTimes = VisitTimes.Find(ChildEdgeNode->GetChildNode());
+			const bool bIsOnPath = ChildTimes && ChildTimes->X <= NodeTimes->X && NodeTimes->Y <= ChildTimes->Y;
+			ChildEdgeNode->SetIsPrimaryEdge(!bIsOnPath);
 		}
 	}
 }
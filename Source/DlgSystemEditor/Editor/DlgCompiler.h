@@ -23,7 +23,22 @@ public:
 	/** Compile the Dialogue from its graph nodes */
 	void Compile();
 
+	/**
+	 * Compiles only the graph nodes changed since the last compile (see UDialogueGraph::MarkGraphNodeDirty).
+	 * Only possible if Compile would reach every node from the same parent in the same order, aka no node index changes.
+	 * @return False if nothing was compiled and the full Compile is needed.
+	 */
+	bool CompileIncremental();
+
 private:
+	/** The order in which the BFS takes the nodes from the queue, the root nodes are before all the other nodes. */
+	int32 GetBFSOrder(const UDialogueGraphNode* GraphNode) const;
+
+	/** Is the parent node that the BFS reaches first still the one from the last compile? */
+	bool IsReachedFromSameParentNode(const UDialogueGraphNode* GraphNode) const;
+
+	/** Sets the Edge category of each child edge of the GraphNode, from the BFS tree of the last compile. */
+	void SetChildEdgesCategorization(const UDialogueGraphNode* GraphNode) const;
 
 	/** Reorders start nodes based on their position */
 	void OrderRootGraphNodes();
@@ -43,10 +58,7 @@ private:
 	/** Gets the Path from SourceNode to the TargetNode in the OutPath. Returns false if no path can be found.  */
 	bool GetPathToNode(const UDialogueGraphNode* SourceNode, const UDialogueGraphNode* TargetNode, TArray<const UDialogueGraphNode*>& OutPath);
 
-	/** Same as above only return a set. */
-	bool GetPathToNodeAsSet(const UDialogueGraphNode* SourceNode, const UDialogueGraphNode* TargetNode, TSet<const UDialogueGraphNode*>& OutNodesInPath);
-
-	/** Sets the Edge category of each edge. */
+	/** Sets the Edge category of each edge, in linear time from the paths of the BFS of all the root nodes. */
 	void SetEdgesCategorization();
 
 	/** Compiles/handles all remaining isolated nodes of the graph. */
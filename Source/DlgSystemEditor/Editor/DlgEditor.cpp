@@ -17,6 +17,7 @@
 #include "EdGraphUtilities.h"
 #include "HAL/PlatformApplicationMisc.h"
 #include "Editor/Transactor.h"
+#include "Async/Async.h"
 
 #include "DlgSystemEditor/DlgSystemEditorModule.h"
 #include "DlgSystem/DlgDialogue.h"
@@ -28,6 +29,7 @@
 #include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode_Edge.h"
 #include "DlgSystemEditor/Editor/Graph/DialogueGraphSchema.h"
 #include "DlgSystemEditor/DlgCommands.h"
+#include "DlgSystemEditor/Editor/DlgGraphLayout.h"
 #include "Graph/SchemaActions/DlgConvertSpeechSequenceNodeToSpeechNodes_GraphSchemaAction.h"
 #include "DlgSystemEditor/Search/DlgSearchManager.h"
 #include "DlgSystemEditor/Search/SDlgFindInDialogues.h"
@@ -154,6 +156,8 @@ void FDlgEditor::PostUndo(bool bSuccess)
 {
 	if (bSuccess)
 	{
+		// The graph is not what the last compile has seen
+		GetDialogueGraph()->MarkNeedsFullCompile();
 		Refresh(false);
 		CheckAll();
 	}
@@ -163,6 +167,8 @@ void FDlgEditor::PostRedo(bool bSuccess)
 {
 	if (bSuccess)
 	{
+		// The graph is not what the last compile has seen
+		GetDialogueGraph()->MarkNeedsFullCompile();
 		Refresh(false);
 		CheckAll();
 	}
@@ -605,6 +611,13 @@ void FDlgEditor::BindEditorCommands()
 		})
 	);
 
+	// The toolbar auto position button
+	ToolkitCommands->MapAction(
+		DialogueCommands.AutoPositionNodes,
+		FExecuteAction::CreateSP(this, &Self::OnCommandAutoPositionNodes),
+		FCanExecuteAction::CreateLambda([this] { return !bIsAutoPositioningNodes; })
+	);
+
 	// The Show Edge Text button
 	ToolkitCommands->MapAction(
 		DialogueCommands.ToggleShowEdgeText,
@@ -763,6 +776,7 @@ void FDlgEditor::ExtendToolbar()
 				{
 					ToolbarBuilder.AddToolBarButton(FDlgCommands::Get().DialogueReloadData);
 					ToolbarBuilder.AddToolBarButton(FDlgCommands::Get().FindInDialogue);
+					ToolbarBuilder.AddToolBarButton(FDlgCommands::Get().AutoPositionNodes);
 
 					ToolbarBuilder.AddToolBarButton(FDlgCommands::Get().ToggleShowEdgeText);
 
@@ -1057,6 +1071,8 @@ void FDlgEditor::OnCommandDeleteSelectedNodes() const
 	DialogueBeingEdited->EnableCompileDialogue();
 	if (NumBaseDialogueNodesRemoved > 0)
 	{
+		// The indices of the nodes after the removed ones changed
+		DialogueGraph->MarkNeedsFullCompile();
 		DialogueBeingEdited->CompileDialogueNodesFromGraphNodes();
 		DialogueBeingEdited->PostEditChange();
 		DialogueBeingEdited->MarkPackageDirty();
@@ -1278,6 +1294,7 @@ void FDlgEditor::PasteNodesHere(const FNYVector2f& Location)
 	// Compile
 	CheckAll();
 	DialogueBeingEdited->EnableCompileDialogue();
+	GetDialogueGraph()->MarkNeedsFullCompile();
 	DialogueBeingEdited->CompileDialogueNodesFromGraphNodes();
 
 	// Notify objects of change
@@ -1346,6 +1363,51 @@ void FDlgEditor::OnCommandDialogueReload() const
 	DialogueBeingEdited->MarkPackageDirty();
 }
 
+void FDlgEditor::OnCommandAutoPositionNodes()
+{
+	if (bIsAutoPositioningNodes || !DialogueBeingEdited)
+	{
+		return;
+	}
+
+	// Only the layout runs in the background, the graph nodes are read and positioned on the game thread
+	const TSharedRef<FDlgGraphLayout> Layout = FDlgGraphLayout::FromGraphNodes(
+		GetDialogueGraph()->GetAllDialogueGraphNodes(),
+		FDlgGraphLayoutSettings::FromSystemSettings()
+	);
+	bIsAutoPositioningNodes = true;
+
+	const TWeakPtr<FDlgEditor> WeakEditor = SharedThis(this);
+	Async(EAsyncExecution::ThreadPool, [Layout, WeakEditor]()
+	{
+		Layout->Compute();
+		AsyncTask(ENamedThreads::GameThread, [Layout, WeakEditor]()
+		{
+			// The editor could have been closed in the meantime
+			if (TSharedPtr<FDlgEditor> Editor = WeakEditor.Pin())
+			{
+				Editor->OnAutoPositionNodesComputed(*Layout);
+			}
+		});
+	});
+}
+
+void FDlgEditor::OnAutoPositionNodesComputed(const FDlgGraphLayout& Layout)
+{
+	bIsAutoPositioningNodes = false;
+	if (!DialogueBeingEdited)
+	{
+		return;
+	}
+
+	// The nodes removed while computing are skipped, the ones added keep their position
+	const FScopedTransaction Transaction(LOCTEXT("DialogueEditorAutoPositionNodes", "Dialogue Editor: Auto Position Nodes"));
+	if (Layout.ApplyToGraphNodes(true) > 0)
+	{
+		GetDialogueGraph()->NotifyGraphChanged();
+	}
+}
+
 void FDlgEditor::OnSelectedNodesChanged(const TSet<UObject*>& NewSelection)
 {
 	TArray<UObject*> ViewSelection;
@@ -18,6 +18,7 @@ class IDetailsView;
 class UDlgDialogue;
 class SDlgEditorPalette;
 class SDlgFindInDialogues;
+class FDlgGraphLayout;
 class FTabManager;
 
 //////////////////////////////////////////////////////////////////////////
@@ -271,6 +272,12 @@ private:
 	// Reloads the Dialogue from the file
 	void OnCommandDialogueReload() const;
 
+	// Computes the layout of the graph in the background, see OnAutoPositionNodesComputed
+	void OnCommandAutoPositionNodes();
+
+	// Applies the computed layout to the graph nodes in one transaction
+	void OnAutoPositionNodesComputed(const FDlgGraphLayout& Layout);
+
 	//
 	// Graph events
 	//
@@ -329,6 +336,9 @@ private:
 	// Command list for this editor. Synced with FDlgEditorCommands. Aka list of shortcuts supported.
 	TSharedPtr<FUICommandList> GraphEditorCommands;
 
+	// The layout of the graph is being computed in the background, see OnCommandAutoPositionNodes
+	bool bIsAutoPositioningNodes = false;
+
 	/** Keep the reference to the target Node Edge before dragging. Only set on output pins from UDialogueGraphNode. */
 	UDialogueGraphNode_Edge* LastTargetGraphEdgeBeforeDrag = nullptr;
 
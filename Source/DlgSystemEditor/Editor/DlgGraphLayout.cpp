@@ -0,0 +1,449 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgGraphLayout.h"
+
+#include "Algo/StableSort.h"
+
+#include "DlgSystem/DlgSystemSettings.h"
+#include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode.h"
+
+FDlgGraphLayoutSettings FDlgGraphLayoutSettings::FromSystemSettings(bool bInIsDirectionVertical)
+{
+	const UDlgSystemSettings* SystemSettings = GetDefault<UDlgSystemSettings>();
+	FDlgGraphLayoutSettings LayoutSettings;
+	LayoutSettings.OffsetBetweenColumnsX = SystemSettings->OffsetBetweenColumnsX;
+	LayoutSettings.OffsetBetweenRowsY = SystemSettings->OffsetBetweenRowsY;
+	LayoutSettings.bIsDirectionVertical = bInIsDirectionVertical;
+	return LayoutSettings;
+}
+
+TSharedRef<FDlgGraphLayout> FDlgGraphLayout::FromGraphNodes(const TArray<UDialogueGraphNode*>& InGraphNodes, const FDlgGraphLayoutSettings& InSettings)
+{
+	check(IsInGameThread());
+	TSharedRef<FDlgGraphLayout> Layout = MakeShared<FDlgGraphLayout>(InSettings);
+
+	TMap<const UDialogueGraphNode*, int32> NodeIndices;
+	NodeIndices.Reserve(InGraphNodes.Num());
+	Layout->GraphNodes.Reserve(InGraphNodes.Num());
+	for (UDialogueGraphNode* GraphNode : InGraphNodes)
+	{
+		// The height is not known, the offset between rows is used
+		NodeIndices.Add(GraphNode, Layout->AddNode(FIntPoint(GraphNode->EstimateNodeWidth(), 0), GraphNode->IsRootNode()));
+		Layout->GraphNodes.Add(GraphNode);
+	}
+
+	// Same order as the compiler, by the current position
+	TArray<int32> RootOrder;
+	for (int32 NodeIndex = 0; NodeIndex < InGraphNodes.Num(); NodeIndex++)
+	{
+		if (InGraphNodes[NodeIndex]->IsRootNode())
+		{
+			RootOrder.Add(NodeIndex);
+		}
+	}
+	Algo::StableSort(RootOrder, [&InGraphNodes](int32 A, int32 B)
+	{
+		const FIntPoint PositionA = InGraphNodes[A]->GetPosition();
+		const FIntPoint PositionB = InGraphNodes[B]->GetPosition();
+		return PositionA.X != PositionB.X ? PositionA.X < PositionB.X : PositionA.Y < PositionB.Y;
+	});
+	Layout->SetRootOrder(RootOrder);
+
+	for (const UDialogueGraphNode* GraphNode : InGraphNodes)
+	{
+		const int32 ParentIndex = NodeIndices.FindChecked(GraphNode);
+		for (const UDialogueGraphNode* ChildNode : GraphNode->GetChildNodes())
+		{
+			if (const int32* ChildIndex = NodeIndices.Find(ChildNode))
+			{
+				Layout->AddEdge(ParentIndex, *ChildIndex);
+			}
+		}
+	}
+
+	return Layout;
+}
+
+int32 FDlgGraphLayout::AddNode(const FIntPoint& Size, bool bIsRoot)
+{
+	IsRoot.Add(bIsRoot);
+	Children.AddDefaulted();
+	const int32 NodeIndex = Sizes.Add(Size);
+	if (bIsRoot)
+	{
+		RootOrder.Add(NodeIndex);
+	}
+	return NodeIndex;
+}
+
+void FDlgGraphLayout::SetRootOrder(const TArray<int32>& InRootOrder)
+{
+	check(InRootOrder.Num() == RootOrder.Num());
+	for (const int32 NodeIndex : InRootOrder)
+	{
+		check(IsRoot.IsValidIndex(NodeIndex) && IsRoot[NodeIndex]);
+	}
+	RootOrder = InRootOrder;
+}
+
+void FDlgGraphLayout::AddEdge(int32 ParentIndex, int32 ChildIndex)
+{
+	check(Sizes.IsValidIndex(ParentIndex) && Sizes.IsValidIndex(ChildIndex));
+	Children[ParentIndex].Add(ChildIndex);
+}
+
+void FDlgGraphLayout::Compute()
+{
+	BreakCycles();
+	AssignLayers();
+	MinimizeCrossings();
+	AssignCoordinates();
+}
+
+int32 FDlgGraphLayout::ApplyToGraphNodes(bool bModify) const
+{
+	check(IsInGameThread());
+	check(Positions.Num() == NumNodes());
+
+	int32 NumPositioned = 0;
+	for (int32 NodeIndex = 0; NodeIndex < GraphNodes.Num(); NodeIndex++)
+	{
+		UDialogueGraphNode* GraphNode = GraphNodes[NodeIndex].Get();
+		if (!IsValid(GraphNode))
+		{
+			continue;
+		}
+
+		if (bModify)
+		{
+			GraphNode->Modify();
+		}
+		GraphNode->SetPosition(Positions[NodeIndex].X, Positions[NodeIndex].Y);
+		NumPositioned++;
+	}
+
+	return NumPositioned;
+}
+
+void FDlgGraphLayout::BreakCycles()
+{
+	// Iterative DFS, the edges to the nodes on the stack (back edges) close a cycle, they are reversed.
+	// The root nodes go first so that the edges leaving them are never reversed, in the root order so that the first layer starts with them.
+	const int32 Num = NumNodes();
+	DAGChildren.Empty(Num);
+	DAGChildren.SetNum(Num);
+	DAGParents.Empty(Num);
+	DAGParents.SetNum(Num);
+	DFSOrder.Empty(Num);
+
+	enum class EVisitState : uint8
+	{
+		NotVisited,
+		OnStack,
+		Done
+	};
+	TArray<EVisitState> States;
+	States.Init(EVisitState::NotVisited, Num);
+
+	// Node => index of the next child to visit
+	TArray<TPair<int32, int32>> Stack;
+	const auto Visit = [this, &States, &Stack](int32 StartIndex)
+	{
+		if (States[StartIndex] != EVisitState::NotVisited)
+		{
+			return;
+		}
+
+		States[StartIndex] = EVisitState::OnStack;
+		DFSOrder.Add(StartIndex);
+		Stack.Emplace(StartIndex, 0);
+		while (Stack.Num() > 0)
+		{
+			const int32 NodeIndex = Stack.Last().Key;
+			int32& NextChild = Stack.Last().Value;
+			if (NextChild >= Children[NodeIndex].Num())
+			{
+				States[NodeIndex] = EVisitState::Done;
+				Stack.Pop();
+				continue;
+			}
+
+			const int32 ChildIndex = Children[NodeIndex][NextChild++];
+			if (ChildIndex == NodeIndex)
+			{
+				// Does not matter for the layers
+				continue;
+			}
+
+			if (States[ChildIndex] == EVisitState::OnStack)
+			{
+				DAGChildren[ChildIndex].Add(NodeIndex);
+				DAGParents[NodeIndex].Add(ChildIndex);
+				continue;
+			}
+
+			DAGChildren[NodeIndex].Add(ChildIndex);
+			DAGParents[ChildIndex].Add(NodeIndex);
+			if (States[ChildIndex] == EVisitState::NotVisited)
+			{
+				States[ChildIndex] = EVisitState::OnStack;
+				DFSOrder.Add(ChildIndex);
+				Stack.Emplace(ChildIndex, 0);
+			}
+		}
+	};
+
+	for (const int32 NodeIndex : RootOrder)
+	{
+		Visit(NodeIndex);
+	}
+	for (int32 NodeIndex = 0; NodeIndex < Num; NodeIndex++)
+	{
+		Visit(NodeIndex);
+	}
+}
+
+void FDlgGraphLayout::AssignLayers()
+{
+	// Longest path from the nodes without parents, in topological order (Kahn)
+	const int32 Num = NumNodes();
+	Layers.Init(0, Num);
+
+	TArray<int32> NumParentsLeft;
+	NumParentsLeft.SetNumUninitialized(Num);
+	TArray<int32> TopologicalOrder;
+	TopologicalOrder.Reserve(Num);
+	for (const int32 NodeIndex : DFSOrder)
+	{
+		NumParentsLeft[NodeIndex] = DAGParents[NodeIndex].Num();
+		if (NumParentsLeft[NodeIndex] == 0)
+		{
+			TopologicalOrder.Add(NodeIndex);
+		}
+	}
+
+	for (int32 Index = 0; Index < TopologicalOrder.Num(); Index++)
+	{
+		const int32 NodeIndex = TopologicalOrder[Index];
+		for (const int32 ChildIndex : DAGChildren[NodeIndex])
+		{
+			Layers[ChildIndex] = FMath::Max(Layers[ChildIndex], Layers[NodeIndex] + 1);
+			if (--NumParentsLeft[ChildIndex] == 0)
+			{
+				TopologicalOrder.Add(ChildIndex);
+			}
+		}
+	}
+	check(TopologicalOrder.Num() == Num);
+
+	// The nodes without parents (other than the root nodes) go right above their first child instead of the first layer
+	int32 NumLayers = 0;
+	for (const int32 NodeIndex : TopologicalOrder)
+	{
+		if (!IsRoot[NodeIndex] && DAGParents[NodeIndex].Num() == 0 && DAGChildren[NodeIndex].Num() > 0)
+		{
+			int32 FirstChildLayer = MAX_int32;
+			for (const int32 ChildIndex : DAGChildren[NodeIndex])
+			{
+				FirstChildLayer = FMath::Min(FirstChildLayer, Layers[ChildIndex]);
+			}
+			Layers[NodeIndex] = FirstChildLayer - 1;
+		}
+		NumLayers = FMath::Max(NumLayers, Layers[NodeIndex] + 1);
+	}
+
+	// The DFS order keeps the children next to each other, in the order of the edges
+	LayerNodes.Empty(NumLayers);
+	LayerNodes.SetNum(NumLayers);
+	OrderInLayer.SetNumUninitialized(Num);
+	for (const int32 NodeIndex : DFSOrder)
+	{
+		OrderInLayer[NodeIndex] = LayerNodes[Layers[NodeIndex]].Add(NodeIndex);
+	}
+}
+
+void FDlgGraphLayout::MinimizeCrossings()
+{
+	for (int32 Sweep = 0; Sweep < Settings.NumCrossingSweeps; Sweep++)
+	{
+		for (int32 LayerIndex = 1; LayerIndex < LayerNodes.Num(); LayerIndex++)
+		{
+			SortLayerByBarycenter(LayerNodes[LayerIndex], DAGParents);
+		}
+		for (int32 LayerIndex = LayerNodes.Num() - 2; LayerIndex >= 0; LayerIndex--)
+		{
+			SortLayerByBarycenter(LayerNodes[LayerIndex], DAGChildren);
+		}
+	}
+}
+
+void FDlgGraphLayout::SortLayerByBarycenter(TArray<int32>& Layer, const TArray<TArray<int32>>& Neighbours)
+{
+	// The neighbours can be in any other layer (long edges), compare their relative order in their own layer.
+	// Nodes without neighbours and the root nodes (the order of the start nodes depends on it) keep their place.
+	const int32 LayerNum = Layer.Num();
+	TArray<TPair<double, int32>> Barycenters;
+	Barycenters.Reserve(LayerNum);
+	for (int32 Order = 0; Order < LayerNum; Order++)
+	{
+		const int32 NodeIndex = Layer[Order];
+		double Barycenter = (Order + 0.5) / LayerNum;
+		if (!IsRoot[NodeIndex] && Neighbours[NodeIndex].Num() > 0)
+		{
+			double Sum = 0.0;
+			for (const int32 NeighbourIndex : Neighbours[NodeIndex])
+			{
+				Sum += (OrderInLayer[NeighbourIndex] + 0.5) / LayerNodes[Layers[NeighbourIndex]].Num();
+			}
+			Barycenter = Sum / Neighbours[NodeIndex].Num();
+		}
+		Barycenters.Emplace(Barycenter, NodeIndex);
+	}
+
+	// Stable so that the children of the same parent stay in the order of the edges
+	Algo::StableSort(Barycenters, [](const TPair<double, int32>& A, const TPair<double, int32>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	// The places of the root nodes are filled with the roots in the root order
+	TArray<int32> LayerRoots;
+	for (const TPair<double, int32>& Pair : Barycenters)
+	{
+		if (IsRoot[Pair.Value])
+		{
+			LayerRoots.Add(Pair.Value);
+		}
+	}
+	if (LayerRoots.Num() > 1)
+	{
+		LayerRoots.Sort([this](int32 A, int32 B)
+		{
+			return RootOrder.IndexOfByKey(A) < RootOrder.IndexOfByKey(B);
+		});
+	}
+
+	int32 NextRoot = 0;
+	for (int32 Order = 0; Order < LayerNum; Order++)
+	{
+		const int32 NodeIndex = Barycenters[Order].Value;
+		Layer[Order] = IsRoot[NodeIndex] ? LayerRoots[NextRoot++] : NodeIndex;
+		OrderInLayer[Layer[Order]] = Order;
+	}
+}
+
+void FDlgGraphLayout::AssignCoordinates()
+{
+	const int32 Num = NumNodes();
+	const int32 OffsetAcross = Settings.bIsDirectionVertical ? Settings.OffsetBetweenRowsY : Settings.OffsetBetweenColumnsX;
+
+	// Across the layers, each layer after the biggest node of the previous one
+	TArray<int32> LayerPositions;
+	LayerPositions.SetNumZeroed(LayerNodes.Num());
+	for (int32 LayerIndex = 1; LayerIndex < LayerNodes.Num(); LayerIndex++)
+	{
+		int32 PreviousLayerSize = 0;
+		for (const int32 NodeIndex : LayerNodes[LayerIndex - 1])
+		{
+			PreviousLayerSize = FMath::Max(PreviousLayerSize, GetSizeAcross(NodeIndex));
+		}
+		LayerPositions[LayerIndex] = LayerPositions[LayerIndex - 1] + FMath::Max(OffsetAcross, PreviousLayerSize + Settings.MinimumSpaceBetweenNodes);
+	}
+
+	// Along the layers, start with the layers packed and centered then move the nodes towards their neighbours
+	Centers.SetNumZeroed(Num);
+	for (const TArray<int32>& Layer : LayerNodes)
+	{
+		double Center = 0.0;
+		for (int32 Order = 0; Order < Layer.Num(); Order++)
+		{
+			if (Order > 0)
+			{
+				Center += GetMinimumDistance(Layer[Order - 1], Layer[Order]);
+			}
+			Centers[Layer[Order]] = Center;
+		}
+		for (const int32 NodeIndex : Layer)
+		{
+			Centers[NodeIndex] -= Center * 0.5;
+		}
+	}
+	for (int32 Pass = 0; Pass < Settings.NumCoordinatePasses; Pass++)
+	{
+		if (Pass % 2 == 0)
+		{
+			for (int32 LayerIndex = 1; LayerIndex < LayerNodes.Num(); LayerIndex++)
+			{
+				PositionLayer(LayerNodes[LayerIndex], DAGParents);
+			}
+		}
+		else
+		{
+			for (int32 LayerIndex = LayerNodes.Num() - 2; LayerIndex >= 0; LayerIndex--)
+			{
+				PositionLayer(LayerNodes[LayerIndex], DAGChildren);
+			}
+		}
+	}
+
+	Positions.SetNumUninitialized(Num);
+	for (int32 NodeIndex = 0; NodeIndex < Num; NodeIndex++)
+	{
+		const int32 Along = FMath::RoundToInt(Centers[NodeIndex] - GetSizeAlong(NodeIndex) * 0.5);
+		const int32 Across = LayerPositions[Layers[NodeIndex]];
+		Positions[NodeIndex] = Settings.bIsDirectionVertical ? FIntPoint(Along, Across) : FIntPoint(Across, Along);
+	}
+}
+
+void FDlgGraphLayout::PositionLayer(const TArray<int32>& Layer, const TArray<TArray<int32>>& Neighbours)
+{
+	const int32 LayerNum = Layer.Num();
+	if (LayerNum == 0)
+	{
+		return;
+	}
+
+	// Where each node wants to be, the center of its neighbours, or where it already is
+	TArray<double> Desired;
+	Desired.SetNumUninitialized(LayerNum);
+	for (int32 Order = 0; Order < LayerNum; Order++)
+	{
+		const int32 NodeIndex = Layer[Order];
+		if (Neighbours[NodeIndex].Num() > 0)
+		{
+			double Sum = 0.0;
+			for (const int32 NeighbourIndex : Neighbours[NodeIndex])
+			{
+				Sum += Centers[NeighbourIndex];
+			}
+			Desired[Order] = Sum / Neighbours[NodeIndex].Num();
+		}
+		else
+		{
+			Desired[Order] = Centers[NodeIndex];
+		}
+	}
+
+	// No overlaps, this only pushes the nodes to the right so the order of the layer (and of the roots) never changes
+	TArray<double> Placed;
+	Placed.SetNumUninitialized(LayerNum);
+	Placed[0] = Desired[0];
+	double TotalPush = 0.0;
+	for (int32 Order = 1; Order < LayerNum; Order++)
+	{
+		Placed[Order] = FMath::Max(Desired[Order], Placed[Order - 1] + GetMinimumDistance(Layer[Order - 1], Layer[Order]));
+		TotalPush += Placed[Order] - Desired[Order];
+	}
+
+	// Move everything back to the left by the average push
+	const double Shift = TotalPush / LayerNum;
+	for (int32 Order = 0; Order < LayerNum; Order++)
+	{
+		Centers[Layer[Order]] = Placed[Order] - Shift;
+	}
+}
+
+double FDlgGraphLayout::GetMinimumDistance(int32 FirstIndex, int32 SecondIndex) const
+{
+	const int32 OffsetAlong = Settings.bIsDirectionVertical ? Settings.OffsetBetweenColumnsX : Settings.OffsetBetweenRowsY;
+	return FMath::Max<double>(OffsetAlong, (GetSizeAlong(FirstIndex) + GetSizeAlong(SecondIndex)) * 0.5 + Settings.MinimumSpaceBetweenNodes);
+}
@@ -0,0 +1,138 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UDialogueGraphNode;
+
+struct DLGSYSTEMEDITOR_API FDlgGraphLayoutSettings
+{
+	// The offset between the nodes on the X axis (left/right)
+	int32 OffsetBetweenColumnsX = 500;
+
+	// The offset between the nodes on the Y axis (up/down)
+	int32 OffsetBetweenRowsY = 200;
+
+	// The minimum free space between two nodes, in case the nodes are bigger than the offsets
+	int32 MinimumSpaceBetweenNodes = 50;
+
+	// Is direction vertical? (the layers are rows) If false it is horizontal (the layers are columns)
+	bool bIsDirectionVertical = true;
+
+	// Number of barycenter sweeps (each one down and up) used to reduce the edge crossings
+	int32 NumCrossingSweeps = 8;
+
+	// Number of passes (alternating down and up) used to center the nodes to their neighbours
+	int32 NumCoordinatePasses = 3;
+
+	// From the UDlgSystemSettings
+	static FDlgGraphLayoutSettings FromSystemSettings(bool bIsDirectionVertical = true);
+};
+
+/**
+ * Layered (Sugiyama style) layout of the dialogue graph nodes, used by FDlgEditorUtilities::AutoPositionGraphNodes.
+ *  1. Break the cycles, by reversing the back edges of a DFS started from the root nodes (in the root order, see SetRootOrder).
+ *  2. Assign the layers, longest path from the nodes without parents (root nodes are on the first layer).
+ *  3. Reduce the crossings, by sorting each layer by the barycenter of the neighbours in the other layers.
+ *  4. Assign the coordinates, center each node to its neighbours without overlapping the nodes of the same layer.
+ *
+ * Edges spanning multiple layers are not split in dummy nodes, their end nodes are used directly,
+ * so every step is O(|V| + |E|) (the sorting O(|V| log |V|)) even for graphs with thousands of nodes.
+ *
+ * The input is copied from the graph nodes (FromGraphNodes) on the game thread, Compute does not touch any UObject
+ * and can run on any thread, the result is applied on the game thread (ApplyToGraphNodes).
+ */
+class DLGSYSTEMEDITOR_API FDlgGraphLayout
+{
+public:
+	FDlgGraphLayout(const FDlgGraphLayoutSettings& InSettings) : Settings(InSettings) {}
+
+	/** Game thread only. Copies the nodes (their estimated size) and their connections. */
+	static TSharedRef<FDlgGraphLayout> FromGraphNodes(const TArray<UDialogueGraphNode*>& InGraphNodes, const FDlgGraphLayoutSettings& InSettings);
+
+	/** Adds a node, Size is only an estimate. Returns the index of the node. */
+	int32 AddNode(const FIntPoint& Size, bool bIsRoot);
+
+	/** Adds an edge between two added nodes. */
+	void AddEdge(int32 ParentIndex, int32 ChildIndex);
+
+	/**
+	 * The order of the root nodes in their layer, by default the order they were added.
+	 * The roots always keep this order, the compiler orders the start nodes by their position (see FDlgCompilerContext::OrderRootGraphNodes).
+	 */
+	void SetRootOrder(const TArray<int32>& InRootOrder);
+
+	/** Computes the positions of all the nodes. Can run on any thread. */
+	void Compute();
+
+	/** The top left position of each node, in the order they were added. */
+	const TArray<FIntPoint>& GetPositions() const { return Positions; }
+
+	/** The layer of each node, in the order they were added. */
+	const TArray<int32>& GetLayers() const { return Layers; }
+
+	int32 NumNodes() const { return Sizes.Num(); }
+
+	/**
+	 * Game thread only. Sets the computed positions of the graph nodes it was made from (FromGraphNodes), the nodes removed since are skipped.
+	 * @param bModify	Mark the nodes for the undo system, so that it can be applied in a transaction
+	 * @return The number of nodes positioned.
+	 */
+	int32 ApplyToGraphNodes(bool bModify) const;
+
+private:
+	void BreakCycles();
+	void AssignLayers();
+	void MinimizeCrossings();
+	void AssignCoordinates();
+
+	/** Sorts the layer by the barycenter (the average relative order) of the nodes in the Neighbours, the root nodes keep the root order */
+	void SortLayerByBarycenter(TArray<int32>& Layer, const TArray<TArray<int32>>& Neighbours);
+
+	/** Positions the layer along its axis, each node as close as possible to the center of its Neighbours */
+	void PositionLayer(const TArray<int32>& Layer, const TArray<TArray<int32>>& Neighbours);
+
+	/** The minimum distance between the centers of two neighbour nodes of the same layer */
+	double GetMinimumDistance(int32 FirstIndex, int32 SecondIndex) const;
+
+	/** The size of the node along the layer axis and across it */
+	int32 GetSizeAlong(int32 NodeIndex) const { return Settings.bIsDirectionVertical ? Sizes[NodeIndex].X : Sizes[NodeIndex].Y; }
+	int32 GetSizeAcross(int32 NodeIndex) const { return Settings.bIsDirectionVertical ? Sizes[NodeIndex].Y : Sizes[NodeIndex].X; }
+
+private:
+	FDlgGraphLayoutSettings Settings;
+
+	// Input
+	TArray<FIntPoint> Sizes;
+	TArray<bool> IsRoot;
+	TArray<TArray<int32>> Children;
+
+	// The root nodes, in the order they are placed
+	TArray<int32> RootOrder;
+
+	// The graph nodes, only used on the game thread
+	TArray<TWeakObjectPtr<UDialogueGraphNode>> GraphNodes;
+
+	// The edges without cycles (some reversed), no self edges
+	TArray<TArray<int32>> DAGChildren;
+	TArray<TArray<int32>> DAGParents;
+
+	// Order of the nodes in the DFS, used as the initial order of the layers
+	TArray<int32> DFSOrder;
+
+	// Node => layer index
+	TArray<int32> Layers;
+
+	// Layer => nodes, in the order they are placed
+	TArray<TArray<int32>> LayerNodes;
+
+	// Node => index in its layer
+	TArray<int32> OrderInLayer;
+
+	// Node => center along the layer axis
+	TArray<double> Centers;
+
+	// Output
+	TArray<FIntPoint> Positions;
+};
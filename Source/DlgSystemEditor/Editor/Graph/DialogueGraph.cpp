@@ -206,14 +206,11 @@ void UDialogueGraph::LinkGraphNodeToChildren(
 void UDialogueGraph::AutoPositionGraphNodes() const
 {
 	static constexpr bool bIsDirectionVertical = true;
-	// TODO: multiple start node support
-	UDialogueGraphNode_Root* RootNode = GetRootGraphNodes()[0];
 	const TArray<UDialogueGraphNode*> DialogueGraphNodes = GetAllDialogueGraphNodes();
 	const UDlgSystemSettings* Settings = GetDefault<UDlgSystemSettings>();
 
 	// TODO investigate Node->SnapToGrid
 	FDlgEditorUtilities::AutoPositionGraphNodes(
-		RootNode,
 		DialogueGraphNodes,
 		Settings->OffsetBetweenColumnsX,
 		Settings->OffsetBetweenRowsY,
@@ -234,3 +231,11 @@ const UDialogueGraphSchema* UDialogueGraph::GetDialogueGraphSchema() const
 {
 	return GetDefault<UDialogueGraphSchema>(Schema);
 }
+
+void UDialogueGraph::MarkGraphNodeDirty(UDialogueGraphNode* GraphNode)
+{
+	if (GraphNode)
+	{
+		DirtyGraphNodes.Add(GraphNode);
+	}
+}
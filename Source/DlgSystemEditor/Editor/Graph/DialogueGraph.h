@@ -75,6 +75,23 @@ public:
 	/** Helper method to get directly the Dialogue Graph Schema */
 	const UDialogueGraphSchema* GetDialogueGraphSchema() const;
 
+	// Incremental compile, see FDlgCompilerContext::CompileIncremental
+	/** Marks the graph node as having its connections (or edges) changed since the last compile. */
+	void MarkGraphNodeDirty(UDialogueGraphNode* GraphNode);
+
+	/** The next compile can't know what changed (undo, paste, delete, etc), the whole graph must be compiled. */
+	void MarkNeedsFullCompile() { bNeedsFullCompile = true; }
+	bool NeedsFullCompile() const { return bNeedsFullCompile; }
+
+	const TSet<TWeakObjectPtr<UDialogueGraphNode>>& GetDirtyGraphNodes() const { return DirtyGraphNodes; }
+
+	/** Called after every compile. */
+	void ClearDirtyGraphNodes()
+	{
+		DirtyGraphNodes.Empty();
+		bNeedsFullCompile = false;
+	}
+
 private:
 	UDialogueGraph(const FObjectInitializer& ObjectInitializer);
 
@@ -84,4 +101,11 @@ private:
 		const UDlgNode& NodeDialogue,
 		UDialogueGraphNode* NodeGraph
 	) const;
+
+private:
+	/** The graph nodes changed since the last compile. Not saved, not transacted. */
+	TSet<TWeakObjectPtr<UDialogueGraphNode>> DirtyGraphNodes;
+
+	/** Nothing is known about the graph until the first compile. */
+	bool bNeedsFullCompile = true;
 };
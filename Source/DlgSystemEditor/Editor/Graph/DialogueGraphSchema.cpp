@@ -321,6 +321,7 @@ void UDialogueGraphSchema::BreakNodeLinks(UEdGraphNode& TargetNode) const
 	verify(Dialogue->Modify());
 
 	Super::BreakNodeLinks(TargetNode);
+	CastChecked<UDialogueGraph>(Graph)->MarkNeedsFullCompile();
 
 #if DO_CHECK
 	if (UDialogueGraphNode* GraphNode = Cast<UDialogueGraphNode>(&TargetNode))
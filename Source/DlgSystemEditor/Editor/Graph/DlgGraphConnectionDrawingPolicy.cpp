@@ -31,6 +31,21 @@ FNYVector2f ToDlgVector2(const VectorType& Vector)
 {
 	return FNYVector2f(Vector.X, Vector.Y);
 }
+
+// The (approximate) closest points between the two geometries (nodes)
+void ComputeAnchorPoints(const FGeometry& StartGeom, const FGeometry& EndGeom, FNYVector2f& OutStartAnchorPoint, FNYVector2f& OutEndAnchorPoint)
+{
+	// Get a reasonable seed point (halfway between the boxes)
+	const FNYVector2f StartCenter = FGeometryHelper::CenterOf(StartGeom);
+	const FNYVector2f EndCenter = FGeometryHelper::CenterOf(EndGeom);
+	const FNYVector2f SeedPoint = (StartCenter + EndCenter) / 2.0f;
+
+	OutStartAnchorPoint = FGeometryHelper::FindClosestPointOnGeom(StartGeom, SeedPoint);
+	OutEndAnchorPoint = FGeometryHelper::FindClosestPointOnGeom(EndGeom, SeedPoint);
+}
+
+// Panning moves both nodes by the same amount, but not always to the same float
+constexpr float ConnectionGeometryTolerance = 0.01f;
 } // namespace
 
 /////////////////////////////////////////////////////
@@ -106,8 +121,22 @@ void FDlgGraphConnectionDrawingPolicy::DetermineLinkGeometry(
 		int32* NextNodeIndex = NodeWidgetMap.Find(ChildNode);
 		if (PrevNodeIndex != nullptr && NextNodeIndex != nullptr)
 		{
-			StartWidgetGeometry = &(ArrangedNodes[*PrevNodeIndex]);
-			EndWidgetGeometry = &(ArrangedNodes[*NextNodeIndex]);
+			FArrangedWidget& StartWidget = ArrangedNodes[*PrevNodeIndex];
+			FArrangedWidget& EndWidget = ArrangedNodes[*NextNodeIndex];
+
+			// Off screen, skip the wiring style and the drawing
+			if (FDlgConnectionGeometry* Geometry = ConnectionGeometryMap.FindRef(GraphNode_Edge))
+			{
+				UpdateConnectionGeometry(StartWidget.Geometry, EndWidget.Geometry, *Geometry);
+				const FNYVector2f StartPosition = ToDlgVector2(StartWidget.Geometry.GetAbsolutePosition());
+				if (!IsConnectionVisible(StartPosition + Geometry->StartAnchor, StartPosition + Geometry->EndAnchor))
+				{
+					return;
+				}
+			}
+
+			StartWidgetGeometry = &StartWidget;
+			EndWidgetGeometry = &EndWidget;
 		}
 	}
 	else
@@ -124,16 +153,21 @@ void FDlgGraphConnectionDrawingPolicy::DrawSplineWithArrow(
 )
 {
 	// Draw the spline and arrow from/to the closest points between the two geometries (nodes)
-	// Get a reasonable seed point (halfway between the boxes)
-	const FNYVector2f StartCenter = FGeometryHelper::CenterOf(StartGeom);
-	const FNYVector2f EndCenter = FGeometryHelper::CenterOf(EndGeom);
-	const FNYVector2f SeedPoint = (StartCenter + EndCenter) / 2.0f;
-
-	// Find the (approximate) closest points between the two boxes
-	const FNYVector2f StartAnchorPoint = FGeometryHelper::FindClosestPointOnGeom(StartGeom, SeedPoint);
-	const FNYVector2f EndAnchorPoint = FGeometryHelper::FindClosestPointOnGeom(EndGeom, SeedPoint);
+	FDlgConnectionGeometry* Geometry = FindConnectionGeometry(Params.AssociatedPin2);
+	if (Geometry == nullptr)
+	{
+		FNYVector2f StartAnchorPoint;
+		FNYVector2f EndAnchorPoint;
+		ComputeAnchorPoints(StartGeom, EndGeom, StartAnchorPoint, EndAnchorPoint);
+		DrawSplineWithArrow(StartAnchorPoint, EndAnchorPoint, Params);
+		return;
+	}
 
-	DrawSplineWithArrow(StartAnchorPoint, EndAnchorPoint, Params);
+	UpdateConnectionGeometry(StartGeom, EndGeom, *Geometry);
+	const FNYVector2f StartPosition = ToDlgVector2(StartGeom.GetAbsolutePosition());
+	DrawingConnectionGeometry = Geometry;
+	DrawSplineWithArrow(StartPosition + Geometry->StartAnchor, StartPosition + Geometry->EndAnchor, Params);
+	DrawingConnectionGeometry = nullptr;
 }
 
 void FDlgGraphConnectionDrawingPolicy::DrawSplineWithArrow(const FNYVector2f& StartPoint, const FNYVector2f& EndPoint,
@@ -279,9 +313,19 @@ void FDlgGraphConnectionDrawingPolicy::DrawConnection(
 
 	if (Params.bDrawBubbles || (MidpointImage != nullptr))
 	{
-		// This table maps distance along curve to alpha
-		FInterpCurve<float> SplineReparamTable;
-		const float SplineLength = MakeSplineReparamTable(P0, P0Tangent, P1, P1Tangent, SplineReparamTable);
+		// This table maps distance along curve to alpha, it only changes with the shape of the spline
+		FDlgConnectionGeometry LocalGeometry;
+		FDlgConnectionGeometry& Geometry = DrawingConnectionGeometry ? *DrawingConnectionGeometry : LocalGeometry;
+		const FNYVector2f SplineDelta = P1 - P0;
+		if (!Geometry.bHasSpline || !Geometry.SplineDelta.Equals(SplineDelta, ConnectionGeometryTolerance))
+		{
+			Geometry.SplineReparamTable.Reset();
+			Geometry.SplineLength = MakeSplineReparamTable(P0, P0Tangent, P1, P1Tangent, Geometry.SplineReparamTable);
+			Geometry.SplineDelta = SplineDelta;
+			Geometry.bHasSpline = true;
+		}
+		const FInterpCurve<float>& SplineReparamTable = Geometry.SplineReparamTable;
+		const float SplineLength = Geometry.SplineLength;
 
 		// Draw bubbles on the spline
 		if (Params.bDrawBubbles)
@@ -300,6 +344,12 @@ void FDlgGraphConnectionDrawingPolicy::DrawConnection(
 				{
 					const float Alpha = SplineReparamTable.Eval(Distance, 0.f);
 					FNYVector2f BubblePos = FMath::CubicInterp(P0, P0Tangent, P1, P1Tangent, Alpha);
+
+					// Long wires are often only partly on screen
+					if (!IsPointVisible(BubblePos, FMath::Max(BubbleSize.X, BubbleSize.Y)))
+					{
+						continue;
+					}
 					BubblePos -= (BubbleSize * 0.5f);
 
 					FSlateDrawElement::MakeBox(
@@ -396,11 +446,19 @@ void FDlgGraphConnectionDrawingPolicy::Draw(TMap<TSharedRef<SWidget>, FArrangedW
 {
 	// Build an acceleration structure to quickly find geometry for the nodes
 	NodeWidgetMap.Empty();
+	ConnectionGeometryMap.Empty();
 	for (int32 NodeIndex = 0; NodeIndex < ArrangedNodes.Num(); ++NodeIndex)
 	{
 		FArrangedWidget& CurWidget = ArrangedNodes[NodeIndex];
 		TSharedRef<SGraphNode> ChildNode = StaticCastSharedRef<SGraphNode>(CurWidget.Widget);
-		NodeWidgetMap.Add(ChildNode->GetNodeObj(), NodeIndex);
+		UEdGraphNode* NodeObj = ChildNode->GetNodeObj();
+		NodeWidgetMap.Add(NodeObj, NodeIndex);
+
+		// The edge widgets outlive this policy, they keep the geometry of their wire
+		if (NodeObj && NodeObj->IsA<UDialogueGraphNode_Edge>())
+		{
+			ConnectionGeometryMap.Add(NodeObj, &StaticCastSharedRef<SDlgGraphNode_Edge>(CurWidget.Widget)->GetConnectionGeometry());
+		}
 	}
 
 	// Now draw all regular connections
@@ -444,6 +502,91 @@ void FDlgGraphConnectionDrawingPolicy::Draw(TMap<TSharedRef<SWidget>, FArrangedW
 #endif // NY_ENGINE_VERSION >= 502
 }
 
+void FDlgGraphConnectionDrawingPolicy::UpdateConnectionGeometry(const FGeometry& StartGeom, const FGeometry& EndGeom, FDlgConnectionGeometry& Geometry)
+{
+	const FNYVector2f StartPosition = ToDlgVector2(StartGeom.GetAbsolutePosition());
+	const FNYVector2f StartSize = ToDlgVector2(StartGeom.GetAbsoluteSize());
+	const FNYVector2f EndSize = ToDlgVector2(EndGeom.GetAbsoluteSize());
+	const FNYVector2f EndOffset = ToDlgVector2(EndGeom.GetAbsolutePosition()) - StartPosition;
+	if (Geometry.bHasAnchors
+		&& Geometry.StartSize.Equals(StartSize, ConnectionGeometryTolerance)
+		&& Geometry.EndSize.Equals(EndSize, ConnectionGeometryTolerance)
+		&& Geometry.EndOffset.Equals(EndOffset, ConnectionGeometryTolerance))
+	{
+		return;
+	}
+
+	FNYVector2f StartAnchorPoint;
+	FNYVector2f EndAnchorPoint;
+	ComputeAnchorPoints(StartGeom, EndGeom, StartAnchorPoint, EndAnchorPoint);
+
+	Geometry.bHasAnchors = true;
+	Geometry.StartSize = StartSize;
+	Geometry.EndSize = EndSize;
+	Geometry.EndOffset = EndOffset;
+	Geometry.StartAnchor = StartAnchorPoint - StartPosition;
+	Geometry.EndAnchor = EndAnchorPoint - StartPosition;
+}
+
+bool FDlgGraphConnectionDrawingPolicy::IsConnectionVisible(const FNYVector2f& StartAnchorPoint, const FNYVector2f& EndAnchorPoint) const
+{
+	// Wide enough for the arrow head, the bubbles and the hover tolerance
+	const float BubbleSize = BubbleImage ? FMath::Max(BubbleImage->ImageSize.X, BubbleImage->ImageSize.Y) * ZoomFactor * 0.1f * DialogueSettings->WireThickness : 0.0f;
+	const float Margin = 2.0f * FMath::Max(ArrowRadius.X, ArrowRadius.Y) + BubbleSize + Settings->SplineHoverTolerance + DialogueSettings->WireThickness;
+
+	const FSlateRect WireBounds(
+		FMath::Min(StartAnchorPoint.X, EndAnchorPoint.X) - Margin,
+		FMath::Min(StartAnchorPoint.Y, EndAnchorPoint.Y) - Margin,
+		FMath::Max(StartAnchorPoint.X, EndAnchorPoint.X) + Margin,
+		FMath::Max(StartAnchorPoint.Y, EndAnchorPoint.Y) + Margin
+	);
+	if (!FSlateRect::DoRectanglesIntersect(WireBounds, ClippingRect))
+	{
+		return false;
+	}
+
+	// The bounds of a diagonal wire can intersect the clipping rect while the wire does not,
+	// in which case all the corners of the clipping rect are on the same side of the wire
+	const FNYVector2f DeltaPos = EndAnchorPoint - StartAnchorPoint;
+	const FNYVector2f Normal = FNYVector2f(DeltaPos.Y, -DeltaPos.X).GetSafeNormal();
+	if (Normal.IsNearlyZero())
+	{
+		return true;
+	}
+
+	const FNYVector2f Corners[] = {
+		FNYVector2f(ClippingRect.Left, ClippingRect.Top),
+		FNYVector2f(ClippingRect.Right, ClippingRect.Top),
+		FNYVector2f(ClippingRect.Left, ClippingRect.Bottom),
+		FNYVector2f(ClippingRect.Right, ClippingRect.Bottom)
+	};
+	float MinDistance = FLT_MAX;
+	float MaxDistance = -FLT_MAX;
+	for (const FNYVector2f& Corner : Corners)
+	{
+		const float Distance = FNYVector2f::DotProduct(Corner - StartAnchorPoint, Normal);
+		MinDistance = FMath::Min(MinDistance, Distance);
+		MaxDistance = FMath::Max(MaxDistance, Distance);
+	}
+	return MinDistance <= Margin && MaxDistance >= -Margin;
+}
+
+bool FDlgGraphConnectionDrawingPolicy::IsPointVisible(const FNYVector2f& Point, float Margin) const
+{
+	return Point.X >= ClippingRect.Left - Margin && Point.X <= ClippingRect.Right + Margin
+		&& Point.Y >= ClippingRect.Top - Margin && Point.Y <= ClippingRect.Bottom + Margin;
+}
+
+FDlgConnectionGeometry* FDlgGraphConnectionDrawingPolicy::FindConnectionGeometry(const UEdGraphPin* InputPin) const
+{
+	if (InputPin == nullptr)
+	{
+		return nullptr;
+	}
+
+	return ConnectionGeometryMap.FindRef(InputPin->GetOwningNode());
+}
+
 void FDlgGraphConnectionDrawingPolicy::Internal_DrawLineWithArrow(
 	const FNYVector2f& StartAnchorPoint,
 	const FNYVector2f& EndAnchorPoint,
@@ -10,6 +10,31 @@
 class FSlateWindowElementList;
 class UEdGraph;
 
+/**
+ * The geometry of the wire of one edge, kept between the paints (the drawing policy is created for every paint), see SDlgGraphNode_Edge.
+ * Everything is relative to the parent node so panning keeps it valid, it is recomputed only when the nodes move, resize or the zoom changes.
+ */
+struct DLGSYSTEMEDITOR_API FDlgConnectionGeometry
+{
+	// Key of the anchors: the size of the parent and child nodes and the offset of the child node from the parent node
+	bool bHasAnchors = false;
+	FNYVector2f StartSize = FNYVector2f::ZeroVector;
+	FNYVector2f EndSize = FNYVector2f::ZeroVector;
+	FNYVector2f EndOffset = FNYVector2f::ZeroVector;
+
+	// The closest points between the two nodes, relative to the parent node
+	FNYVector2f StartAnchor = FNYVector2f::ZeroVector;
+	FNYVector2f EndAnchor = FNYVector2f::ZeroVector;
+
+	// Key of the spline: its end relative to its start
+	bool bHasSpline = false;
+	FNYVector2f SplineDelta = FNYVector2f::ZeroVector;
+
+	// Maps the distance along the spline to alpha, used by the bubbles and the midpoint image
+	float SplineLength = 0.0f;
+	FInterpCurve<float> SplineReparamTable;
+};
+
 // This class draws the connections for an UEdGraph using a Dialogue schema
 // Aka how the wires look and and the flow look.
 class FDlgGraphConnectionDrawingPolicy : public FConnectionDrawingPolicy
@@ -79,12 +104,30 @@ protected:
 	FNYVector2f GetMousePosition() const;
 	void Internal_DrawLineWithArrow(const FNYVector2f& StartAnchorPoint, const FNYVector2f& EndAnchorPoint, const FConnectionParams& Params);
 
+	// Recomputes the anchors of the Geometry only if the nodes moved or resized relative to each other
+	static void UpdateConnectionGeometry(const FGeometry& StartGeom, const FGeometry& EndGeom, FDlgConnectionGeometry& Geometry);
+
+	// Is any part of the wire between the anchor points (with its arrow and bubbles) inside the clipping rect
+	bool IsConnectionVisible(const FNYVector2f& StartAnchorPoint, const FNYVector2f& EndAnchorPoint) const;
+
+	// Is the Point close enough to the clipping rect to be seen
+	bool IsPointVisible(const FNYVector2f& Point, float Margin) const;
+
+	// The cached geometry of the connection of the edge with this input pin, nullptr for the preview connectors
+	FDlgConnectionGeometry* FindConnectionGeometry(const UEdGraphPin* InputPin) const;
+
 	// Map for widgets
 	UEdGraph* Graph = nullptr;
 
 	// Map for widgets
 	TMap<UEdGraphNode*, int32> NodeWidgetMap;
 
+	// Edge node => the cached geometry of its widget
+	TMap<const UEdGraphNode*, FDlgConnectionGeometry*> ConnectionGeometryMap;
+
+	// The cached geometry of the connection being drawn (by DrawConnection), if any
+	FDlgConnectionGeometry* DrawingConnectionGeometry = nullptr;
+
 	// Cache the settings
 	const UDlgSystemSettings* DialogueSettings = nullptr;
 
@@ -112,6 +112,7 @@ UEdGraphNode* FDlgConvertSpeechNodesToSpeechSequence_GraphSchemaAction::PerformA
 	}
 #endif
 	Dialogue->EnableCompileDialogue();
+	CastChecked<UDialogueGraph>(ParentGraph)->MarkNeedsFullCompile();
 	Dialogue->CompileDialogueNodesFromGraphNodes();
 	Dialogue->PostEditChange();
 	Dialogue->MarkPackageDirty();
@@ -105,6 +105,7 @@ UEdGraphNode* FDlgConvertSpeechSequenceNodeToSpeechNodes_GraphSchemaAction::Perf
 #endif
 
 	Dialogue->EnableCompileDialogue();
+	CastChecked<UDialogueGraph>(ParentGraph)->MarkNeedsFullCompile();
 	Dialogue->CompileDialogueNodesFromGraphNodes();
 	Dialogue->PostEditChange();
 	Dialogue->MarkPackageDirty();
@@ -162,6 +162,9 @@ void UDialogueGraphNode::PinConnectionListChanged(UEdGraphPin* Pin)
 	check(Pin->GetOwningNode() == this);
 	check(DialogueNode->GetNodeOpenChildren_DEPRECATED().Num() == 0);
 
+	// Recompile only what changed, see FDlgCompilerContext::CompileIncremental
+	GetDialogueGraph()->MarkGraphNodeDirty(this);
+
 	// Input pins are ignored, as they are not reliable source of information, each node should only work with its output pins
 	if (Pin->Direction == EGPD_Input)
 	{
@@ -267,6 +267,15 @@ public:
 	/** Sets the new node depth. */
 	void SetNodeDepth(int32 NewNodeDepth) { NodeDepth = NewNodeDepth; }
 
+	/**
+	 * Gets the parent node that reached this node first in the BFS of the last compile.
+	 * nullptr for the root nodes, for the first node of every isolated group and if it is not known (not compiled yet).
+	 */
+	const UDialogueGraphNode* GetCompiledParentNode() const { return CompiledParentNode.Get(); }
+
+	/** Sets the new compiled parent node. */
+	void SetCompiledParentNode(const UDialogueGraphNode* InParentNode) { CompiledParentNode = InParentNode; }
+
 	/** Sets the Dialogue Node. */
 	virtual void SetDialogueNode(UDlgNode* InNode)
 	{
@@ -434,6 +443,9 @@ protected:
 	UPROPERTY()
 	int32 NodeDepth = INDEX_NONE;
 
+	/** The parent of this node in the BFS tree of the last compile, see GetCompiledParentNode. Only set by the compiler. */
+	TWeakObjectPtr<const UDialogueGraphNode> CompiledParentNode;
+
 	/** Used to highlight the node if the currently selected node is a proxy targeting it */
 	UPROPERTY(Transient)
 	bool bUseBorderHighlight = false;
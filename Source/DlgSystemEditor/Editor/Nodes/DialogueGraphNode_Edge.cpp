@@ -76,6 +76,8 @@ void UDialogueGraphNode_Edge::PinConnectionListChanged(UEdGraphPin* Pin)
 {
 	if (Pin->LinkedTo.Num() == 0)
 	{
+		MarkConnectedNodesDirty();
+
 		// (input pin) ParentNode (output pin) -> (EdgeInputPin) ThisNode (EdgeOutputPin) -> (input pin) ChildNode (output pin)
 		if (Pin->Direction == EGPD_Output)
 		{
@@ -103,6 +105,10 @@ void UDialogueGraphNode_Edge::PinConnectionListChanged(UEdGraphPin* Pin)
 	const int32 NewTargetIndex = GetChildNode()->GetDialogueNodeIndex();
 	if (NewTargetIndex != DialogueEdge.TargetIndex)
 	{
+		// Both the old and the new child
+		MarkConnectedNodesDirty();
+		GetDialogueGraph()->MarkGraphNodeDirty(GetChildNode());
+
 		// (input pin) Parent Node (output pin) -> (input pin) ThisEdge Node (output pin) -> (input pin) New ChildNode (output pin)
 		// Find ThisEdge node index, in the array of child edge nodes of the Parent node.
 		// This matches the Edge Index of the Dialogue Edges array we must modify the Target Index of
@@ -173,6 +179,8 @@ void UDialogueGraphNode_Edge::CreateConnections(UDialogueGraphNode* ParentNode,
 		ParentNode->GetMutableDialogueNode()->AddNodeChild(EdgeToAdd);
 		DialogueEdge = EdgeToAdd;
 	}
+
+	MarkConnectedNodesDirty();
 }
 
 FLinearColor UDialogueGraphNode_Edge::GetEdgeColor(bool bIsHovered) const
@@ -205,6 +213,21 @@ FDlgEdge* UDialogueGraphNode_Edge::GetMutableDialogueEdgeFromParentNode() const
 	const UDialogueGraphNode* ChildNode = GetChildNode();
 	return ParentNode->GetMutableDialogueNode()->GetMutableNodeChildForTargetIndex(ChildNode->GetDialogueNodeIndex());
 }
+
+void UDialogueGraphNode_Edge::MarkConnectedNodesDirty() const
+{
+	UDialogueGraph* DialogueGraph = GetDialogueGraph();
+	if (HasParentNode())
+	{
+		DialogueGraph->MarkGraphNodeDirty(GetParentNode());
+	}
+
+	const TArray<UDlgNode*>& DialogueNodes = DialogueGraph->GetDialogue()->GetNodes();
+	if (DialogueNodes.IsValidIndex(DialogueEdge.TargetIndex) && DialogueNodes[DialogueEdge.TargetIndex])
+	{
+		DialogueGraph->MarkGraphNodeDirty(Cast<UDialogueGraphNode>(DialogueNodes[DialogueEdge.TargetIndex]->GetGraphNode()));
+	}
+}
 // End own functions
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
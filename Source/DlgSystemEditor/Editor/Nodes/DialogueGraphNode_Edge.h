@@ -196,6 +196,12 @@ private:
 	/** Gets the corresponding FDlgEdge that this Node actually represents from the ParentNode */
 	FDlgEdge* GetMutableDialogueEdgeFromParentNode() const;
 
+	/**
+	 * Marks the parent and child nodes dirty for the next incremental compile.
+	 * The child node is found from the DialogueEdge.TargetIndex, it works even if the output pin is already broken.
+	 */
+	void MarkConnectedNodesDirty() const;
+
 	/** The copy Dialogue Edge corresponding to this graph node. This belongs to the the Node of the Input Pin (GetParentNode) */
 	UPROPERTY(EditAnywhere, Category = DialogueGraphNode, Meta = (ShowOnlyInnerProperties))
 	FDlgEdge DialogueEdge;
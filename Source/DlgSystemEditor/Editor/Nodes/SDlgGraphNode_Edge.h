@@ -6,6 +6,7 @@
 
 #include "DialogueGraphNode_Edge.h"
 #include "SDlgGraphNode_Base.h"
+#include "DlgSystemEditor/Editor/Graph/DlgGraphConnectionDrawingPolicy.h"
 
 /**
  * Widget for UDialogueGraphNode_Edge
@@ -73,6 +74,9 @@ public:
 
 	virtual const TArray<FDlgCondition>* GetEnterConditions() const override;
 
+	/** The geometry of the wire of this edge, kept between the paints by FDlgGraphConnectionDrawingPolicy */
+	FDlgConnectionGeometry& GetConnectionGeometry() { return ConnectionGeometry; }
+
 	// End own functions
 
 protected:
@@ -99,4 +103,7 @@ protected:
 
 	/** The widget we use to display if the edge has any conditions */
 	TSharedPtr<SWidget> ConditionOverlayWidget;
+
+	/** The cached geometry of the wire of this edge */
+	FDlgConnectionGeometry ConnectionGeometry;
 };
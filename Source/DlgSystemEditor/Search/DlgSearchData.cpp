@@ -0,0 +1,433 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgSearchData.h"
+
+#include "EdGraphNode_Comment.h"
+#include "Misc/Base64.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#include "DlgSystem/DlgDialogue.h"
+#include "DlgSystem/DlgHelper.h"
+#include "DlgSystem/Nodes/DlgNode_SpeechSequence.h"
+#include "DlgSystemEditor/Editor/Graph/DialogueGraph.h"
+#include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode.h"
+#include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode_Edge.h"
+#include "DlgSearchResult.h"
+#include "DlgSearchUtilities.h"
+
+// Same as the FDlgSearchManager results
+#define LOCTEXT_NAMESPACE "SDialogueBrowser"
+
+// The search data of a Dialogue is never this big, the tag value is corrupt
+static constexpr int32 DlgSearchDataMaxTagSize = 64 * 1024 * 1024;
+
+// Same as Ar << Array, except when loading the number of elements is checked against the bytes left before anything is allocated,
+// each element takes at least MinElementSize bytes. The tag values could be corrupt.
+template <typename ElementType>
+static void SerializeSearchDataArray(FArchive& Ar, TArray<ElementType>& Array, int64 MinElementSize)
+{
+	if (!Ar.IsLoading())
+	{
+		Ar << Array;
+		return;
+	}
+
+	int32 Num = 0;
+	Ar << Num;
+	if (Num < 0 || Num > (Ar.TotalSize() - Ar.Tell()) / MinElementSize)
+	{
+		Ar.SetError();
+		return;
+	}
+
+	Array.Empty(Num);
+	for (int32 Index = 0; Index < Num && !Ar.IsError(); Index++)
+	{
+		Ar << Array.AddDefaulted_GetRef();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgSearchField::IsSearched(const FDlgSearchFilter& SearchFilter) const
+{
+	switch (Type)
+	{
+		case EDlgSearchFieldType::Index:
+			return SearchFilter.bIncludeIndices;
+		case EDlgSearchFieldType::Comment:
+			return SearchFilter.bIncludeComments;
+		case EDlgSearchFieldType::NumericalType:
+			return SearchFilter.bIncludeNumericalTypes;
+		case EDlgSearchFieldType::TextLocalizationData:
+			return SearchFilter.bIncludeTextLocalizationData;
+		case EDlgSearchFieldType::CustomObjectName:
+			return SearchFilter.bIncludeCustomObjectNames;
+		default:
+			return true;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FText FDlgSearchField::GetCategory() const
+{
+	switch (Type)
+	{
+		case EDlgSearchFieldType::Index:
+			return LOCTEXT("SearchFieldIndexCategory", "Index");
+		case EDlgSearchFieldType::Comment:
+			return LOCTEXT("SearchFieldCommentCategory", "Comment");
+		case EDlgSearchFieldType::NumericalType:
+			return LOCTEXT("SearchFieldNumericalTypeCategory", "Number");
+		case EDlgSearchFieldType::TextLocalizationData:
+			return LOCTEXT("SearchFieldTextLocalizationDataCategory", "Text Localization Data");
+		case EDlgSearchFieldType::CustomObjectName:
+			return LOCTEXT("SearchFieldCustomObjectNameCategory", "Custom Object Name");
+		default:
+			return LOCTEXT("SearchFieldDefaultCategory", "Value");
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FArchive& operator<<(FArchive& Ar, FDlgSearchField& Field)
+{
+	Ar << Field.String;
+	uint8 Type = static_cast<uint8>(Field.Type);
+	Ar << Type;
+	Field.Type = static_cast<EDlgSearchFieldType>(Type);
+	return Ar;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgSearchNodeData::Matches(const FDlgSearchFilter& SearchFilter) const
+{
+	for (const FDlgSearchField& Field : Fields)
+	{
+		if (Field.IsSearched(SearchFilter) && Field.String.Contains(SearchFilter.SearchString))
+		{
+			return true;
+		}
+	}
+
+	if (SearchFilter.bIncludeNodeGUID)
+	{
+		FString FoundGUID;
+		for (const FGuid& GUID : GUIDs)
+		{
+			if (FDlgSearchUtilities::DoesGUIDContainString(GUID, SearchFilter.SearchString, FoundGUID))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FArchive& operator<<(FArchive& Ar, FDlgSearchNodeData& NodeData)
+{
+	Ar << NodeData.GraphNodeIndex;
+	Ar << NodeData.DisplayString;
+	Ar << NodeData.Category;
+	// String length + type
+	SerializeSearchDataArray(Ar, NodeData.Fields, sizeof(int32) + sizeof(uint8));
+	SerializeSearchDataArray(Ar, NodeData.GUIDs, sizeof(FGuid));
+	return Ar;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FArchive& operator<<(FArchive& Ar, FDlgSearchDialogueData& Data)
+{
+	Ar << Data.DialogueGUID;
+	// Index + two string lengths + two array lengths
+	SerializeSearchDataArray(Ar, Data.Nodes, 5 * sizeof(int32));
+	return Ar;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgSearchDialogueData::MatchesDialogueGUID(const FDlgSearchFilter& SearchFilter) const
+{
+	FString FoundGUID;
+	return SearchFilter.bIncludeDialogueGUID && FDlgSearchUtilities::DoesGUIDContainString(DialogueGUID, SearchFilter.SearchString, FoundGUID);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgSearchDialogueData::FindMatchingNodes(const FDlgSearchFilter& SearchFilter, const TArray<int32>* CandidateNodeIndices, TArray<int32>& OutNodeIndices) const
+{
+	if (CandidateNodeIndices)
+	{
+		for (const int32 NodeIndex : *CandidateNodeIndices)
+		{
+			if (Nodes.IsValidIndex(NodeIndex) && Nodes[NodeIndex].Matches(SearchFilter))
+			{
+				OutNodeIndices.Add(NodeIndex);
+			}
+		}
+	}
+	else
+	{
+		for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); NodeIndex++)
+		{
+			if (Nodes[NodeIndex].Matches(SearchFilter))
+			{
+				OutNodeIndices.Add(NodeIndex);
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FDlgSearchDialogueDataRef FDlgSearchDialogueData::Extract(const UDlgDialogue* InDialogue)
+{
+	check(IsInGameThread());
+	TSharedRef<FDlgSearchDialogueData, ESPMode::ThreadSafe> Data = MakeShared<FDlgSearchDialogueData, ESPMode::ThreadSafe>();
+	if (!IsValid(InDialogue))
+	{
+		return Data;
+	}
+
+	Data->DialogueGUID = InDialogue->GetGUID();
+	Data->DialoguePath = FSoftObjectPath(InDialogue);
+	Data->Dialogue = InDialogue;
+
+	const UDialogueGraph* Graph = CastChecked<UDialogueGraph>(InDialogue->GetGraph());
+	const TArray<UEdGraphNode*>& AllGraphNodes = Graph->GetAllGraphNodes();
+	for (int32 Index = 0; Index < AllGraphNodes.Num(); Index++)
+	{
+		FDlgSearchNodeData NodeData;
+		NodeData.GraphNodeIndex = Index;
+		NodeData.GraphNode = AllGraphNodes[Index];
+		ExtractGraphNode(AllGraphNodes[Index], NodeData);
+		if (NodeData.Fields.Num() > 0 || NodeData.GUIDs.Num() > 0)
+		{
+			Data->Nodes.Add(MoveTemp(NodeData));
+		}
+	}
+
+	return Data;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FString FDlgSearchDialogueData::ToTagValue() const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	int32 Version = TagVersion;
+	Writer << Version;
+	// Saving does not modify it
+	Writer << const_cast<FDlgSearchDialogueData&>(*this);
+
+	// The asset registry keeps the tags of all the Dialogues in memory, the text compresses well
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Bytes.Num());
+	TArray<uint8> CompressedBytes;
+	CompressedBytes.SetNumUninitialized(CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Zlib, CompressedBytes.GetData(), CompressedSize, Bytes.GetData(), Bytes.Num()))
+	{
+		return FString();
+	}
+	CompressedBytes.SetNum(CompressedSize);
+
+	// The uncompressed size is needed to uncompress it
+	return FString::Printf(TEXT("%d:%s"), Bytes.Num(), *FBase64::Encode(CompressedBytes));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FDlgSearchDialogueDataPtr FDlgSearchDialogueData::FromTagValue(const FString& TagValue, const FSoftObjectPath& InDialoguePath)
+{
+	FString SizeString;
+	FString EncodedString;
+	if (!TagValue.Split(TEXT(":"), &SizeString, &EncodedString))
+	{
+		return nullptr;
+	}
+
+	const int32 UncompressedSize = FCString::Atoi(*SizeString);
+	TArray<uint8> CompressedBytes;
+	if (UncompressedSize <= 0 || UncompressedSize > DlgSearchDataMaxTagSize || !FBase64::Decode(EncodedString, CompressedBytes))
+	{
+		return nullptr;
+	}
+
+	TArray<uint8> Bytes;
+	Bytes.SetNumUninitialized(UncompressedSize);
+	if (!FCompression::UncompressMemory(NAME_Zlib, Bytes.GetData(), UncompressedSize, CompressedBytes.GetData(), CompressedBytes.Num()))
+	{
+		return nullptr;
+	}
+
+	// No string can be bigger than the data
+	FMemoryReader Reader(Bytes);
+	Reader.ArMaxSerializeSize = Bytes.Num();
+	int32 Version = INDEX_NONE;
+	Reader << Version;
+	if (Version != TagVersion)
+	{
+		return nullptr;
+	}
+
+	TSharedRef<FDlgSearchDialogueData, ESPMode::ThreadSafe> Data = MakeShared<FDlgSearchDialogueData, ESPMode::ThreadSafe>();
+	Reader << *Data;
+	if (Reader.IsError())
+	{
+		return nullptr;
+	}
+
+	Data->DialoguePath = InDialoguePath;
+	return Data;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgSearchDialogueData::ExtractGraphNode(const UEdGraphNode* GraphNode, FDlgSearchNodeData& OutNodeData)
+{
+	if (const UDialogueGraphNode* DialogueGraphNode = Cast<UDialogueGraphNode>(GraphNode))
+	{
+		const UDlgNode& Node = DialogueGraphNode->GetDialogueNode();
+		const FString NodeType = Node.GetNodeTypeString();
+		OutNodeData.DisplayString = FText::Format(
+			LOCTEXT("TreeGraphNodeCategory", "{0} Node at index {1}"),
+			FText::FromString(NodeType), FText::AsNumber(DialogueGraphNode->GetDialogueNodeIndex())
+		).ToString();
+		OutNodeData.Category = NodeType;
+		if (!DialogueGraphNode->IsRootNode())
+		{
+			AddField(FString::FromInt(DialogueGraphNode->GetDialogueNodeIndex()), EDlgSearchFieldType::Index, OutNodeData);
+		}
+		AddField(CopyTemp(DialogueGraphNode->NodeComment), EDlgSearchFieldType::Comment, OutNodeData);
+		AddName(Node.GetNodeParticipantName(), OutNodeData);
+		AddText(Node.GetNodeUnformattedText(), OutNodeData);
+		for (const FDlgCondition& Condition : Node.GetNodeEnterConditions())
+		{
+			AddCondition(Condition, OutNodeData);
+		}
+		for (const FDlgEvent& Event : Node.GetNodeEnterEvents())
+		{
+			AddEvent(Event, OutNodeData);
+		}
+		AddName(Node.GetSpeakerState(), OutNodeData);
+		for (const FDlgTextArgument& TextArgument : Node.GetTextArguments())
+		{
+			AddTextArgument(TextArgument, OutNodeData);
+		}
+		AddObjectClassName(Node.GetNodeData(), OutNodeData);
+		OutNodeData.GUIDs.Add(Node.GetGUID());
+
+		if (const UDlgNode_SpeechSequence* SpeechSequence = Cast<UDlgNode_SpeechSequence>(&Node))
+		{
+			for (const FDlgSpeechSequenceEntry& SequenceEntry : SpeechSequence->GetNodeSpeechSequence())
+			{
+				AddName(SequenceEntry.Speaker, OutNodeData);
+				AddText(SequenceEntry.Text, OutNodeData);
+				AddText(SequenceEntry.EdgeText, OutNodeData);
+				AddName(SequenceEntry.SpeakerState, OutNodeData);
+			}
+		}
+	}
+	else if (const UDialogueGraphNode_Edge* EdgeNode = Cast<UDialogueGraphNode_Edge>(GraphNode))
+	{
+		const int32 FromParent = EdgeNode->HasParentNode() ? EdgeNode->GetParentNode()->GetDialogueNodeIndex() : -1;
+		const int32 ToChild = EdgeNode->HasChildNode() ? EdgeNode->GetChildNode()->GetDialogueNodeIndex() : -1;
+		OutNodeData.DisplayString = FText::Format(LOCTEXT("EdgeNodeDisplaytext", "Edge between {0} -> {1}"),
+			FText::AsNumber(FromParent), FText::AsNumber(ToChild)).ToString();
+		OutNodeData.Category = OutNodeData.DisplayString;
+
+		const FDlgEdge& Edge = EdgeNode->GetDialogueEdge();
+		AddText(Edge.GetUnformattedText(), OutNodeData);
+		for (const FDlgCondition& Condition : Edge.Conditions)
+		{
+			AddCondition(Condition, OutNodeData);
+		}
+		AddName(Edge.SpeakerState, OutNodeData);
+		for (const FDlgTextArgument& TextArgument : Edge.GetTextArguments())
+		{
+			AddTextArgument(TextArgument, OutNodeData);
+		}
+	}
+	else if (const UEdGraphNode_Comment* CommentNode = Cast<UEdGraphNode_Comment>(GraphNode))
+	{
+		OutNodeData.DisplayString = LOCTEXT("TreeNodeCommentCategory", "Comment Node").ToString();
+		OutNodeData.Category = OutNodeData.DisplayString;
+		AddField(CopyTemp(CommentNode->NodeComment), EDlgSearchFieldType::Comment, OutNodeData);
+	}
+	else
+	{
+		// Not searched
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgSearchDialogueData::AddText(const FText& Text, FDlgSearchNodeData& OutNodeData)
+{
+	AddField(Text.ToString(), EDlgSearchFieldType::Default, OutNodeData);
+	AddField(FTextInspector::GetNamespace(Text).Get(FString()), EDlgSearchFieldType::TextLocalizationData, OutNodeData);
+	AddField(FTextInspector::GetKey(Text).Get(FString()), EDlgSearchFieldType::TextLocalizationData, OutNodeData);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgSearchDialogueData::AddCondition(const FDlgCondition& Condition, FDlgSearchNodeData& OutNodeData)
+{
+	AddName(Condition.ParticipantName, OutNodeData);
+	AddName(Condition.CallbackName, OutNodeData);
+	AddName(Condition.NameValue, OutNodeData);
+	AddName(Condition.OtherParticipantName, OutNodeData);
+	AddName(Condition.OtherVariableName, OutNodeData);
+	AddField(FString::FromInt(Condition.IntValue), EDlgSearchFieldType::NumericalType, OutNodeData);
+	AddField(FString::SanitizeFloat(Condition.FloatValue), EDlgSearchFieldType::NumericalType, OutNodeData);
+	AddObjectClassName(Condition.CustomCondition, OutNodeData);
+	OutNodeData.GUIDs.Add(Condition.GUID);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgSearchDialogueData::AddEvent(const FDlgEvent& Event, FDlgSearchNodeData& OutNodeData)
+{
+	AddName(Event.ParticipantName, OutNodeData);
+	AddName(Event.EventName, OutNodeData);
+	AddName(Event.NameValue, OutNodeData);
+	AddField(FString::FromInt(Event.IntValue), EDlgSearchFieldType::NumericalType, OutNodeData);
+	AddField(FString::SanitizeFloat(Event.FloatValue), EDlgSearchFieldType::NumericalType, OutNodeData);
+	AddObjectClassName(Event.CustomEvent, OutNodeData);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgSearchDialogueData::AddTextArgument(const FDlgTextArgument& TextArgument, FDlgSearchNodeData& OutNodeData)
+{
+	AddField(CopyTemp(TextArgument.DisplayString), EDlgSearchFieldType::Default, OutNodeData);
+	AddName(TextArgument.ParticipantName, OutNodeData);
+	AddName(TextArgument.VariableName, OutNodeData);
+	AddObjectClassName(TextArgument.CustomTextArgument, OutNodeData);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgSearchDialogueData::AddObjectClassName(const UObject* Object, FDlgSearchNodeData& OutNodeData)
+{
+	// Same as FDlgSearchUtilities::DoesObjectClassNameContainString
+	if (Object)
+	{
+		AddField(FDlgHelper::CleanObjectName(Object->GetClass()->GetName()), EDlgSearchFieldType::CustomObjectName, OutNodeData);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgSearchDialogueData::AddName(FName Name, FDlgSearchNodeData& OutNodeData)
+{
+	if (!Name.IsNone())
+	{
+		AddField(Name.ToString(), EDlgSearchFieldType::Default, OutNodeData);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgSearchDialogueData::AddField(FString&& String, EDlgSearchFieldType Type, FDlgSearchNodeData& OutNodeData)
+{
+	// Nothing can be found in an empty string
+	if (String.IsEmpty())
+	{
+		return;
+	}
+
+	FDlgSearchField& Field = OutNodeData.Fields.AddDefaulted_GetRef();
+	Field.String = MoveTemp(String);
+	Field.Type = Type;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,133 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "UObject/SoftObjectPath.h"
+
+class UDlgDialogue;
+class UEdGraphNode;
+struct FDlgCondition;
+struct FDlgEvent;
+struct FDlgSearchFilter;
+struct FDlgTextArgument;
+
+// Which FDlgSearchFilter option a FDlgSearchField depends on
+enum class EDlgSearchFieldType : uint8
+{
+	// Always searched
+	Default = 0,
+
+	// bIncludeIndices
+	Index,
+
+	// bIncludeComments
+	Comment,
+
+	// bIncludeNumericalTypes
+	NumericalType,
+
+	// bIncludeTextLocalizationData
+	TextLocalizationData,
+
+	// bIncludeCustomObjectNames
+	CustomObjectName
+};
+
+// One searchable string
+struct DLGSYSTEMEDITOR_API FDlgSearchField
+{
+	FString String;
+	EDlgSearchFieldType Type = EDlgSearchFieldType::Default;
+
+	bool IsSearched(const FDlgSearchFilter& SearchFilter) const;
+
+	// Category of the search result of this field when the Dialogue is not loaded
+	FText GetCategory() const;
+
+	friend FArchive& operator<<(FArchive& Ar, FDlgSearchField& Field);
+};
+
+// The searchable data of one graph node
+struct DLGSYSTEMEDITOR_API FDlgSearchNodeData
+{
+	// Index of the node in UDialogueGraph::GetAllGraphNodes at the time it was extracted
+	int32 GraphNodeIndex = INDEX_NONE;
+
+	// Only dereference on the game thread
+	TWeakObjectPtr<const UEdGraphNode> GraphNode;
+
+	// What the search results show for the node when the Dialogue is not loaded
+	FString DisplayString;
+	FString Category;
+
+	TArray<FDlgSearchField> Fields;
+
+	// GUIDs of the node and its conditions, bIncludeNodeGUID
+	TArray<FGuid> GUIDs;
+
+	// Same as the FDlgSearchManager Query functions, except it does not build any results. Thread safe.
+	bool Matches(const FDlgSearchFilter& SearchFilter) const;
+
+	friend FArchive& operator<<(FArchive& Ar, FDlgSearchNodeData& NodeData);
+};
+
+/**
+ * All the searchable data of a Dialogue, extracted on the game thread by Extract.
+ * Immutable once shared, so it can be searched from any thread while the Dialogue changes, see FDlgSearchIndex.
+ *
+ * Also saved in the asset registry tags of the Dialogue (see ToTagValue), so the Dialogues that are not loaded can be searched.
+ */
+struct DLGSYSTEMEDITOR_API FDlgSearchDialogueData
+{
+	// Bump this when the serialized data changes, the Dialogues saved with another version are loaded instead
+	static constexpr int32 TagVersion = 2;
+
+	FGuid DialogueGUID;
+
+	FSoftObjectPath DialoguePath;
+
+	// Only dereference on the game thread, not set if the data was read from the asset registry
+	TWeakObjectPtr<const UDlgDialogue> Dialogue;
+
+	// Only the graph nodes with searchable data, in the graph order
+	TArray<FDlgSearchNodeData> Nodes;
+
+	// Does the Dialogue GUID match? bIncludeDialogueGUID. Thread safe.
+	bool MatchesDialogueGUID(const FDlgSearchFilter& SearchFilter) const;
+
+	/**
+	 * Fills OutNodeIndices with the indices into Nodes that match. Thread safe.
+	 * @param CandidateNodeIndices If set only these nodes are tested, see FDlgSearchIndex::FindCandidates
+	 */
+	void FindMatchingNodes(const FDlgSearchFilter& SearchFilter, const TArray<int32>* CandidateNodeIndices, TArray<int32>& OutNodeIndices) const;
+
+	// Extracts the data from the graph of the Dialogue, game thread only
+	static TSharedRef<const FDlgSearchDialogueData, ESPMode::ThreadSafe> Extract(const UDlgDialogue* InDialogue);
+
+	// Extracts the searchable fields of a graph node, what the FDlgSearchManager Query functions look into
+	static void ExtractGraphNode(const UEdGraphNode* GraphNode, FDlgSearchNodeData& OutNodeData);
+
+	// Compressed and encoded to be stored as the value of the UDlgDialogue::GetSearchDataTagName asset registry tag
+	FString ToTagValue() const;
+
+	// Reverse of ToTagValue. Returns nullptr if the TagValue is invalid or from another TagVersion.
+	static TSharedPtr<const FDlgSearchDialogueData, ESPMode::ThreadSafe> FromTagValue(const FString& TagValue, const FSoftObjectPath& InDialoguePath);
+
+	// Only the GUID and the nodes, the path is the one of the asset
+	friend FArchive& operator<<(FArchive& Ar, FDlgSearchDialogueData& Data);
+
+private:
+	static void AddText(const FText& Text, FDlgSearchNodeData& OutNodeData);
+	static void AddCondition(const FDlgCondition& Condition, FDlgSearchNodeData& OutNodeData);
+	static void AddEvent(const FDlgEvent& Event, FDlgSearchNodeData& OutNodeData);
+	static void AddTextArgument(const FDlgTextArgument& TextArgument, FDlgSearchNodeData& OutNodeData);
+	static void AddObjectClassName(const UObject* Object, FDlgSearchNodeData& OutNodeData);
+
+	// Skips NAME_None, the "None" string would match the searches for "one", "none", etc
+	static void AddName(FName Name, FDlgSearchNodeData& OutNodeData);
+	static void AddField(FString&& String, EDlgSearchFieldType Type, FDlgSearchNodeData& OutNodeData);
+};
+
+using FDlgSearchDialogueDataRef = TSharedRef<const FDlgSearchDialogueData, ESPMode::ThreadSafe>;
+using FDlgSearchDialogueDataPtr = TSharedPtr<const FDlgSearchDialogueData, ESPMode::ThreadSafe>;
@@ -0,0 +1,255 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgSearchIndex.h"
+
+#include "EdGraph/EdGraphNode.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FDlgSearchDialogueDataRef FDlgSearchIndex::IndexDialogue(const UDlgDialogue* Dialogue)
+{
+	FDlgSearchDialogueDataRef Data = FDlgSearchDialogueData::Extract(Dialogue);
+	IndexDialogueData(Data);
+	return Data;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgSearchIndex::IndexDialogueData(const FDlgSearchDialogueDataRef& Data)
+{
+	const FGuid& DialogueGUID = Data->DialogueGUID;
+	if (!DialogueGUID.IsValid())
+	{
+		return;
+	}
+
+	RemoveDialogue(DialogueGUID);
+	DialogueData.Add(DialogueGUID, Data);
+	DialogueDocuments.Add(DialogueGUID);
+	for (int32 NodeIndex = 0; NodeIndex < Data->Nodes.Num(); NodeIndex++)
+	{
+		AddDocument(DialogueGUID, NodeIndex, Data->Nodes[NodeIndex]);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgSearchIndex::RemoveDialogue(const FGuid& DialogueGUID)
+{
+	DialogueData.Remove(DialogueGUID);
+	TArray<int32> DocumentIndices;
+	if (!DialogueDocuments.RemoveAndCopyValue(DialogueGUID, DocumentIndices))
+	{
+		return;
+	}
+
+	for (const int32 DocumentIndex : DocumentIndices)
+	{
+		Documents[DocumentIndex].bRemoved = true;
+	}
+	NumRemovedDocuments += DocumentIndices.Num();
+
+	if (NumRemovedDocuments > Documents.Num() / 2)
+	{
+		Compact();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgSearchIndex::Empty()
+{
+	Documents.Empty();
+	Postings.Empty();
+	DialogueDocuments.Empty();
+	DialogueData.Empty();
+	NumRemovedDocuments = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgSearchIndex::FindCandidates(const FString& SearchString, TMap<FGuid, TArray<int32>>& OutCandidates) const
+{
+	// The trimmed string has fewer trigrams, so more candidates, but it is what the GUID search uses
+	const FString TrimmedSearchString = SearchString.TrimStartAndEnd();
+	if (TrimmedSearchString.Len() < TrigramLength)
+	{
+		return false;
+	}
+
+	TSet<uint64> Trigrams;
+	AddTrigrams(TrimmedSearchString, Trigrams);
+
+	TArray<const TArray<int32>*> TrigramPostings;
+	for (const uint64 Trigram : Trigrams)
+	{
+		const TArray<int32>* Found = Postings.Find(Trigram);
+		if (Found == nullptr)
+		{
+			// Nothing contains this trigram
+			return true;
+		}
+		TrigramPostings.Add(Found);
+	}
+
+	// Smallest first, the intersection can only get smaller
+	TrigramPostings.Sort([](const TArray<int32>& A, const TArray<int32>& B)
+	{
+		return A.Num() < B.Num();
+	});
+
+	TArray<int32> Intersection = *TrigramPostings[0];
+	TArray<int32> Next;
+	for (int32 PostingIndex = 1; PostingIndex < TrigramPostings.Num() && Intersection.Num() > 0; PostingIndex++)
+	{
+		const TArray<int32>& Posting = *TrigramPostings[PostingIndex];
+		Next.Reset();
+
+		int32 A = 0, B = 0;
+		while (A < Intersection.Num() && B < Posting.Num())
+		{
+			if (Intersection[A] < Posting[B])
+			{
+				A++;
+			}
+			else if (Posting[B] < Intersection[A])
+			{
+				B++;
+			}
+			else
+			{
+				Next.Add(Intersection[A]);
+				A++;
+				B++;
+			}
+		}
+		Swap(Intersection, Next);
+	}
+
+	// The documents of a Dialogue are added in the node order, the node indices stay sorted
+	for (const int32 DocumentIndex : Intersection)
+	{
+		const FDlgSearchIndexDocument& Document = Documents[DocumentIndex];
+		if (!Document.bRemoved)
+		{
+			OutCandidates.FindOrAdd(Document.DialogueGUID).Add(Document.NodeIndex);
+		}
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool FDlgSearchIndex::FindCandidateGraphNodes(const FString& SearchString, TMap<FGuid, TArray<const UEdGraphNode*>>& OutCandidates) const
+{
+	check(IsInGameThread());
+	TMap<FGuid, TArray<int32>> Candidates;
+	if (!FindCandidates(SearchString, Candidates))
+	{
+		return false;
+	}
+
+	for (const auto& Elem : Candidates)
+	{
+		const FDlgSearchDialogueDataRef& Data = DialogueData.FindChecked(Elem.Key);
+		TArray<const UEdGraphNode*>& GraphNodes = OutCandidates.Add(Elem.Key);
+		for (const int32 NodeIndex : Elem.Value)
+		{
+			if (const UEdGraphNode* GraphNode = Data->Nodes[NodeIndex].GraphNode.Get())
+			{
+				GraphNodes.Add(GraphNode);
+			}
+		}
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgSearchIndex::AddTrigrams(const FString& String, TSet<uint64>& OutTrigrams)
+{
+	// Same as the ESearchCase::IgnoreCase of FString::Contains
+	// 21 bits are enough for any code point
+	static constexpr uint64 CharMask = (1ull << 21) - 1;
+	const int32 Len = String.Len();
+	const TCHAR* Chars = *String;
+	for (int32 Index = 0; Index + TrigramLength <= Len; Index++)
+	{
+		const uint64 Trigram =
+			(static_cast<uint64>(FChar::ToUpper(Chars[Index])) & CharMask) << 42 |
+			(static_cast<uint64>(FChar::ToUpper(Chars[Index + 1])) & CharMask) << 21 |
+			(static_cast<uint64>(FChar::ToUpper(Chars[Index + 2])) & CharMask);
+		OutTrigrams.Add(Trigram);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgSearchIndex::AddDocument(const FGuid& DialogueGUID, int32 NodeIndex, const FDlgSearchNodeData& NodeData)
+{
+	const int32 DocumentIndex = Documents.Num();
+	FDlgSearchIndexDocument& Document = Documents.AddDefaulted_GetRef();
+	Document.DialogueGUID = DialogueGUID;
+	Document.NodeIndex = NodeIndex;
+	DialogueDocuments.FindOrAdd(DialogueGUID).Add(DocumentIndex);
+
+	// Trigrams never span two fields
+	TSet<uint64> Trigrams;
+	for (const FDlgSearchField& Field : NodeData.Fields)
+	{
+		AddTrigrams(Field.String, Trigrams);
+	}
+
+	// The document indices only grow, the postings stay sorted
+	for (const uint64 Trigram : Trigrams)
+	{
+		Postings.FindOrAdd(Trigram).Add(DocumentIndex);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FDlgSearchIndex::Compact()
+{
+	TArray<int32> Remap;
+	Remap.SetNumUninitialized(Documents.Num());
+	TArray<FDlgSearchIndexDocument> NewDocuments;
+	NewDocuments.Reserve(Documents.Num() - NumRemovedDocuments);
+	for (int32 Index = 0; Index < Documents.Num(); Index++)
+	{
+		if (Documents[Index].bRemoved)
+		{
+			Remap[Index] = INDEX_NONE;
+		}
+		else
+		{
+			Remap[Index] = NewDocuments.Add(MoveTemp(Documents[Index]));
+		}
+	}
+	Documents = MoveTemp(NewDocuments);
+	NumRemovedDocuments = 0;
+
+	// Remapping keeps the order, the postings stay sorted
+	for (auto It = Postings.CreateIterator(); It; ++It)
+	{
+		TArray<int32>& Posting = It.Value();
+		int32 NewNum = 0;
+		for (const int32 DocumentIndex : Posting)
+		{
+			if (Remap[DocumentIndex] != INDEX_NONE)
+			{
+				Posting[NewNum++] = Remap[DocumentIndex];
+			}
+		}
+
+		if (NewNum == 0)
+		{
+			It.RemoveCurrent();
+		}
+		else
+		{
+			Posting.SetNum(NewNum);
+		}
+	}
+	Postings.Compact();
+
+	for (auto& Elem : DialogueDocuments)
+	{
+		for (int32& DocumentIndex : Elem.Value)
+		{
+			DocumentIndex = Remap[DocumentIndex];
+		}
+	}
+}
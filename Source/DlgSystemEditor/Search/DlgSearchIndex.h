@@ -0,0 +1,95 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "DlgSearchData.h"
+
+class UDlgDialogue;
+
+// One indexed graph node of a Dialogue
+struct DLGSYSTEMEDITOR_API FDlgSearchIndexDocument
+{
+	FGuid DialogueGUID;
+
+	// Index into FDlgSearchDialogueData::Nodes
+	int32 NodeIndex = INDEX_NONE;
+
+	// Removed documents stay in the postings until the next compaction
+	bool bRemoved = false;
+};
+
+/**
+ * Trigram inverted index over the searchable fields of all the graph nodes of the Dialogues, used by FDlgSearchManager.
+ * Every 3 consecutive characters of every field map to the graph nodes that contain them (case insensitive),
+ * a node can only contain the search string if it contains all of the trigrams of the search string.
+ *
+ * All the fields are indexed no matter the FDlgSearchFilter, so the candidates are a superset of the matches,
+ * the FDlgSearchManager Query functions are still the ones that decide what matches.
+ * NOTE: the GUIDs are not indexed, they are searched without the index.
+ *
+ * Also keeps the FDlgSearchDialogueData of every indexed Dialogue, the searches running on other threads
+ * keep the data they started with alive.
+ */
+class DLGSYSTEMEDITOR_API FDlgSearchIndex
+{
+public:
+	static constexpr int32 TrigramLength = 3;
+
+	// Extracts and indexes the data of the Dialogue, replaces the previous data of the Dialogue
+	FDlgSearchDialogueDataRef IndexDialogue(const UDlgDialogue* Dialogue);
+
+	// Indexes already extracted data, replaces the previous data of the same Dialogue GUID
+	void IndexDialogueData(const FDlgSearchDialogueDataRef& Data);
+
+	// Removes all the documents of the Dialogue
+	void RemoveDialogue(const FGuid& DialogueGUID);
+
+	bool HasDialogue(const FGuid& DialogueGUID) const { return DialogueData.Contains(DialogueGUID); }
+	FDlgSearchDialogueDataPtr FindDialogueData(const FGuid& DialogueGUID) const
+	{
+		const FDlgSearchDialogueDataRef* Found = DialogueData.Find(DialogueGUID);
+		return Found ? FDlgSearchDialogueDataPtr(*Found) : nullptr;
+	}
+	void Empty();
+
+	// Is the search string long enough to have trigrams?
+	static bool CanFilter(const FString& SearchString) { return SearchString.TrimStartAndEnd().Len() >= TrigramLength; }
+
+	/**
+	 * Finds the nodes that might contain the SearchString, grouped by the Dialogue GUID.
+	 * The values are indices into FDlgSearchDialogueData::Nodes, sorted. The Dialogues without any candidates are not in OutCandidates.
+	 * @return False if the index can't be used for this search string (too short), every node is a candidate then.
+	 */
+	bool FindCandidates(const FString& SearchString, TMap<FGuid, TArray<int32>>& OutCandidates) const;
+
+	// Same as above but returns the graph nodes. Game thread only.
+	bool FindCandidateGraphNodes(const FString& SearchString, TMap<FGuid, TArray<const UEdGraphNode*>>& OutCandidates) const;
+
+	int32 NumDialogues() const { return DialogueData.Num(); }
+	int32 NumDocuments() const { return Documents.Num() - NumRemovedDocuments; }
+	int32 NumTrigrams() const { return Postings.Num(); }
+
+	// Adds the case insensitive trigrams of String to OutTrigrams
+	static void AddTrigrams(const FString& String, TSet<uint64>& OutTrigrams);
+
+private:
+	void AddDocument(const FGuid& DialogueGUID, int32 NodeIndex, const FDlgSearchNodeData& NodeData);
+
+	// Drops the removed documents from the postings, the order of the documents is kept
+	void Compact();
+
+private:
+	TArray<FDlgSearchIndexDocument> Documents;
+
+	// Trigram => sorted indices into Documents
+	TMap<uint64, TArray<int32>> Postings;
+
+	// Dialogue GUID => indices into Documents
+	TMap<FGuid, TArray<int32>> DialogueDocuments;
+
+	// Dialogue GUID => the indexed data
+	TMap<FGuid, FDlgSearchDialogueDataRef> DialogueData;
+
+	int32 NumRemovedDocuments = 0;
+};
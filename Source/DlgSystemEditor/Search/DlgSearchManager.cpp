@@ -2,6 +2,8 @@
 #include "DlgSearchManager.h"
 
 #include "Widgets/Docking/SDockTab.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "DlgSearchUtilities.h"
 #include "WorkspaceMenuStructureModule.h"
@@ -17,6 +19,7 @@
 #include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode.h"
 #include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode_Edge.h"
 #include "DlgSystemEditor/DlgStyle.h"
+#include "DlgSystemEditor/DlgEditorUtilities.h"
 #include "DlgSystem/DlgConstants.h"
 
 #define LOCTEXT_NAMESPACE "SDialogueBrowser"
@@ -562,7 +565,8 @@ bool FDlgSearchManager::QueryGraphNode(
 	}
 
 	// Test the ParticipantName
-	if (Node.GetNodeParticipantName().ToString().Contains(SearchFilter.SearchString))
+	if (!Node.GetNodeParticipantName().IsNone() &&
+		Node.GetNodeParticipantName().ToString().Contains(SearchFilter.SearchString))
 	{
 		bContainsSearchString = true;
 		MakeChildTextNode(
@@ -682,7 +686,8 @@ bool FDlgSearchManager::QueryGraphNode(
 			const FDlgSpeechSequenceEntry& SequenceEntry = SpeechSequenceArray[Index];
 
 			// Test Speaker
-			if (SequenceEntry.Speaker.ToString().Contains(SearchFilter.SearchString))
+			if (!SequenceEntry.Speaker.IsNone() &&
+				SequenceEntry.Speaker.ToString().Contains(SearchFilter.SearchString))
 			{
 				bContainsSearchString = true;
 				const FText Category = FText::Format(LOCTEXT("SequenceEntrySpeaker", "SequenceEntry.Speaker at index = {0}"), FText::AsNumber(Index));
@@ -821,7 +826,8 @@ bool FDlgSearchManager::QueryCommentNode(
 bool FDlgSearchManager::QuerySingleDialogue(
 	const FDlgSearchFilter& SearchFilter,
 	const UDlgDialogue* InDialogue,
-	TSharedPtr<FDlgSearchResult>& OutParentNode
+	TSharedPtr<FDlgSearchResult>& OutParentNode,
+	const TArray<const UEdGraphNode*>* CandidateNodes
 )
 {
 	if (SearchFilter.SearchString.IsEmpty() || !OutParentNode.IsValid() || !IsValid(InDialogue))
@@ -838,18 +844,27 @@ bool FDlgSearchManager::QuerySingleDialogue(
 	// Find in GraphNodes
 	bool bFoundInDialogue = false;
 	const TArray<UEdGraphNode*>& AllGraphNodes = Graph->GetAllGraphNodes();
-	for (UEdGraphNode* Node : AllGraphNodes)
+	const int32 NumNodes = CandidateNodes ? CandidateNodes->Num() : AllGraphNodes.Num();
+	for (int32 Index = 0; Index < NumNodes; Index++)
 	{
+		const UEdGraphNode* Node = CandidateNodes ? (*CandidateNodes)[Index] : AllGraphNodes[Index];
+
+		// Candidates of another Dialogue with the same GUID
+		if (!IsValid(Node) || Node->GetGraph() != Graph)
+		{
+			continue;
+		}
+
 		bool bFoundInNode = false;
-		if (UDialogueGraphNode* GraphNode = Cast<UDialogueGraphNode>(Node))
+		if (const UDialogueGraphNode* GraphNode = Cast<UDialogueGraphNode>(Node))
 		{
 			bFoundInNode = QueryGraphNode(SearchFilter, GraphNode, TreeDialogueNode);
 		}
-		else if (UDialogueGraphNode_Edge* EdgeNode = Cast<UDialogueGraphNode_Edge>(Node))
+		else if (const UDialogueGraphNode_Edge* EdgeNode = Cast<UDialogueGraphNode_Edge>(Node))
 		{
 			bFoundInNode = QueryEdgeNode(SearchFilter, EdgeNode, TreeDialogueNode);
 		}
-		else if (UEdGraphNode_Comment* CommentNode = Cast<UEdGraphNode_Comment>(Node))
+		else if (const UEdGraphNode_Comment* CommentNode = Cast<UEdGraphNode_Comment>(Node))
 		{
 			bFoundInNode = QueryCommentNode(SearchFilter, CommentNode, TreeDialogueNode);
 		}
@@ -886,19 +901,345 @@ bool FDlgSearchManager::QuerySingleDialogue(
 	return bFoundInDialogue;
 }
 
+bool FDlgSearchManager::QueryUnloadedDialogue(
+	const FDlgSearchFilter& SearchFilter,
+	const FDlgSearchDialogueData& Data,
+	const TArray<int32>& NodeIndices,
+	const TSharedPtr<FDlgSearchResult>& OutParentNode
+)
+{
+	if (SearchFilter.SearchString.IsEmpty() || !OutParentNode.IsValid())
+	{
+		return false;
+	}
+
+	TSharedPtr<FDlgSearchResult_DialogueNode> TreeDialogueNode = MakeShared<FDlgSearchResult_DialogueNode>(
+		FText::FromString(Data.DialoguePath.ToString()), OutParentNode
+	);
+	TreeDialogueNode->SetDialoguePath(Data.DialoguePath);
+
+	// Find in the saved GraphNodes
+	bool bFoundInDialogue = false;
+	FString FoundGUID;
+	for (const int32 NodeIndex : NodeIndices)
+	{
+		if (!Data.Nodes.IsValidIndex(NodeIndex))
+		{
+			continue;
+		}
+
+		const FDlgSearchNodeData& NodeData = Data.Nodes[NodeIndex];
+		TSharedPtr<FDlgSearchResult_UnloadedGraphNode> TreeGraphNode = MakeShared<FDlgSearchResult_UnloadedGraphNode>(
+			FText::FromString(NodeData.DisplayString), TreeDialogueNode
+		);
+		TreeGraphNode->SetCategory(FText::FromString(NodeData.Category));
+		TreeGraphNode->SetGraphNodeIndex(NodeData.GraphNodeIndex);
+
+		bool bFoundInNode = false;
+		for (const FDlgSearchField& Field : NodeData.Fields)
+		{
+			if (Field.IsSearched(SearchFilter) && Field.String.Contains(SearchFilter.SearchString))
+			{
+				bFoundInNode = true;
+				MakeChildTextNode(TreeGraphNode, FText::FromString(Field.String), Field.GetCategory(), TEXT(""));
+			}
+		}
+
+		if (SearchFilter.bIncludeNodeGUID)
+		{
+			for (const FGuid& GUID : NodeData.GUIDs)
+			{
+				if (FDlgSearchUtilities::DoesGUIDContainString(GUID, SearchFilter.SearchString, FoundGUID))
+				{
+					bFoundInNode = true;
+					MakeChildTextNode(TreeGraphNode, FText::FromString(FoundGUID), LOCTEXT("NodeGUID", "Node GUID"), TEXT(""));
+				}
+			}
+		}
+
+		if (bFoundInNode)
+		{
+			bFoundInDialogue = true;
+			TreeDialogueNode->AddChild(TreeGraphNode);
+		}
+	}
+
+	// Search for GUID
+	if (SearchFilter.bIncludeDialogueGUID && FDlgSearchUtilities::DoesGUIDContainString(Data.DialogueGUID, SearchFilter.SearchString, FoundGUID))
+	{
+		bFoundInDialogue = true;
+		MakeChildTextNode(
+			TreeDialogueNode,
+			FText::FromString(FoundGUID),
+			LOCTEXT("DialogueGUID", "Dialogue GUID"),
+			TEXT("Dialogue.GUID")
+		);
+	}
+
+	if (bFoundInDialogue)
+	{
+		OutParentNode->AddChild(TreeDialogueNode);
+	}
+
+	return bFoundInDialogue;
+}
+
 void FDlgSearchManager::QueryAllDialogues(
 	const FDlgSearchFilter& SearchFilter,
 	TSharedPtr<FDlgSearchResult>& OutParentNode
 )
 {
+	// Only visit the graph nodes that can match
+	UpdateSearchIndex();
+	TMap<FGuid, TArray<const UEdGraphNode*>> Candidates;
+	const bool bUseSearchIndex = CanUseSearchIndex(SearchFilter) && SearchIndex.FindCandidateGraphNodes(SearchFilter.SearchString, Candidates);
+	static const TArray<const UEdGraphNode*> NoCandidates;
+
 	// Iterate over all cached dialogues
 	for (auto& Elem : SearchMap)
 	{
 		const FDialogueSearchData& SearchData = Elem.Value;
-		if (SearchData.Dialogue.IsValid())
+		if (!SearchData.Dialogue.IsValid())
+		{
+			continue;
+		}
+
+		const UDlgDialogue* Dialogue = SearchData.Dialogue.Get();
+		if (!bUseSearchIndex)
+		{
+			QuerySingleDialogue(SearchFilter, Dialogue, OutParentNode);
+			continue;
+		}
+
+		const TArray<const UEdGraphNode*>* DialogueCandidates = Candidates.Find(Dialogue->GetGUID());
+		if (DialogueCandidates == nullptr)
 		{
-			QuerySingleDialogue(SearchFilter, SearchData.Dialogue.Get(), OutParentNode);
+			// Only the Dialogue GUID can still match
+			if (!SearchFilter.bIncludeDialogueGUID)
+			{
+				continue;
+			}
+			DialogueCandidates = &NoCandidates;
 		}
+		QuerySingleDialogue(SearchFilter, Dialogue, OutParentNode, DialogueCandidates);
+	}
+}
+
+FDlgSearchQueryRef FDlgSearchManager::QueryAllDialoguesAsync(
+	const FDlgSearchFilter& SearchFilter,
+	const TSharedPtr<FDlgSearchResult>& OutParentNode,
+	const FDlgSearchResultsDelegate& OnResults
+)
+{
+	check(IsInGameThread());
+	FDlgSearchQueryRef Query = MakeShared<FDlgSearchQuery, ESPMode::ThreadSafe>();
+	Query->SearchFilter = SearchFilter;
+	Query->ParentNode = OutParentNode;
+	Query->OnResults = OnResults;
+
+	ActiveQueries.RemoveAll([](const TWeakPtr<FDlgSearchQuery, ESPMode::ThreadSafe>& ActiveQuery)
+	{
+		return !ActiveQuery.IsValid();
+	});
+	ActiveQueries.Add(Query);
+
+	if (SearchFilter.SearchString.IsEmpty() || !OutParentNode.IsValid())
+	{
+		ReportSearchMatches(Query, {}, true);
+		return Query;
+	}
+
+	// The snapshot, the data is immutable, the index can change while the task runs
+	UpdateSearchIndex();
+	TArray<FDlgSearchDialogueDataRef> Snapshot;
+	Snapshot.Reserve(SearchMap.Num());
+	for (const auto& Elem : SearchMap)
+	{
+		if (FDlgSearchDialogueDataPtr Data = SearchIndex.FindDialogueData(Elem.Value.IndexedGUID))
+		{
+			Snapshot.Add(Data.ToSharedRef());
+		}
+	}
+
+	TMap<FGuid, TArray<int32>> Candidates;
+	const bool bUseSearchIndex = CanUseSearchIndex(SearchFilter) && SearchIndex.FindCandidates(SearchFilter.SearchString, Candidates);
+
+	// The last reference to the Query must be released on the game thread (its results tree and delegate are not thread safe),
+	// so the task only keeps it in QueryPtr and always moves it into a last game thread task, even when cancelled
+	Async(EAsyncExecution::ThreadPool, [QueryPtr = FDlgSearchQueryPtr(Query), SearchFilter, Snapshot = MoveTemp(Snapshot), Candidates = MoveTemp(Candidates), bUseSearchIndex]() mutable
+	{
+		const FDlgSearchQuery& TaskQuery = *QueryPtr;
+		TArray<FDlgSearchMatch> Batch;
+		double BatchStartTime = FPlatformTime::Seconds();
+		for (const FDlgSearchDialogueDataRef& Data : Snapshot)
+		{
+			if (TaskQuery.IsCancelled())
+			{
+				break;
+			}
+
+			const TArray<int32>* CandidateNodeIndices = nullptr;
+			if (bUseSearchIndex)
+			{
+				CandidateNodeIndices = Candidates.Find(Data->DialogueGUID);
+				if (CandidateNodeIndices == nullptr && !SearchFilter.bIncludeDialogueGUID)
+				{
+					continue;
+				}
+			}
+
+			FDlgSearchMatch Match(Data);
+			if (!bUseSearchIndex || CandidateNodeIndices)
+			{
+				Data->FindMatchingNodes(SearchFilter, CandidateNodeIndices, Match.NodeIndices);
+			}
+			if (Match.NodeIndices.Num() > 0 || Data->MatchesDialogueGUID(SearchFilter))
+			{
+				Batch.Add(MoveTemp(Match));
+			}
+
+			if (Batch.Num() >= SearchBatchNumDialogues ||
+				(Batch.Num() > 0 && FPlatformTime::Seconds() - BatchStartTime >= SearchBatchSeconds))
+			{
+				AsyncTask(ENamedThreads::GameThread, [Query = QueryPtr, Batch = MoveTemp(Batch)]()
+				{
+					// The manager could be gone
+					if (!Query->IsCancelled())
+					{
+						FDlgSearchManager::Get()->ReportSearchMatches(Query.ToSharedRef(), Batch, false);
+					}
+				});
+				Batch.Reset();
+				BatchStartTime = FPlatformTime::Seconds();
+			}
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [Query = MoveTemp(QueryPtr), Batch = MoveTemp(Batch)]()
+		{
+			if (!Query->IsCancelled())
+			{
+				FDlgSearchManager::Get()->ReportSearchMatches(Query.ToSharedRef(), Batch, true);
+			}
+		});
+	});
+
+	return Query;
+}
+
+void FDlgSearchManager::ReportSearchMatches(const FDlgSearchQueryRef& Query, const TArray<FDlgSearchMatch>& Matches, bool bComplete)
+{
+	check(IsInGameThread());
+	if (Query->IsCancelled())
+	{
+		return;
+	}
+
+	// The matches are a superset, the Query functions decide what is in the results
+	TSharedPtr<FDlgSearchResult>& ParentNode = Query->ParentNode;
+	const int32 NumChildrenBefore = ParentNode.IsValid() ? ParentNode->GetChildren().Num() : 0;
+	TArray<const UEdGraphNode*> GraphNodes;
+	for (const FDlgSearchMatch& Match : Matches)
+	{
+		// Removed or renamed since the search started
+		if (!SearchMap.Contains(Match.Data->DialoguePath))
+		{
+			continue;
+		}
+
+		// The data of the Dialogues that were not loaded comes from the asset registry, they could have been loaded since
+		const UDlgDialogue* Dialogue = Match.Data->Dialogue.Get();
+		const bool bFromAssetRegistry = Dialogue == nullptr;
+		if (bFromAssetRegistry)
+		{
+			Dialogue = Cast<UDlgDialogue>(Match.Data->DialoguePath.ResolveObject());
+		}
+		if (!IsValid(Dialogue))
+		{
+			QueryUnloadedDialogue(Query->SearchFilter, *Match.Data, Match.NodeIndices, ParentNode);
+			continue;
+		}
+
+		GraphNodes.Reset();
+		const TArray<UEdGraphNode*>& AllGraphNodes = CastChecked<UDialogueGraph>(Dialogue->GetGraph())->GetAllGraphNodes();
+		for (const int32 NodeIndex : Match.NodeIndices)
+		{
+			const FDlgSearchNodeData& NodeData = Match.Data->Nodes[NodeIndex];
+			if (const UEdGraphNode* GraphNode = NodeData.GraphNode.Get())
+			{
+				GraphNodes.Add(GraphNode);
+			}
+			else if (bFromAssetRegistry && AllGraphNodes.IsValidIndex(NodeData.GraphNodeIndex))
+			{
+				// Not modified since it was loaded, otherwise it would have been indexed again
+				GraphNodes.Add(AllGraphNodes[NodeData.GraphNodeIndex]);
+			}
+		}
+		QuerySingleDialogue(Query->SearchFilter, Dialogue, ParentNode, &GraphNodes);
+	}
+
+	TArray<TSharedPtr<FDlgSearchResult>> NewResults;
+	if (ParentNode.IsValid())
+	{
+		const TArray<TSharedPtr<FDlgSearchResult>>& Children = ParentNode->GetChildren();
+		for (int32 Index = NumChildrenBefore; Index < Children.Num(); Index++)
+		{
+			NewResults.Add(Children[Index]);
+		}
+	}
+
+	Query->bComplete = bComplete;
+	if (NewResults.Num() > 0 || bComplete)
+	{
+		Query->OnResults.ExecuteIfBound(NewResults, bComplete);
+	}
+}
+
+void FDlgSearchManager::UpdateSearchIndex()
+{
+	if (DirtyDialogues.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<TWeakObjectPtr<UDlgDialogue>> ChangedDialogues;
+	for (const TWeakObjectPtr<UDlgDialogue>& WeakDialogue : DirtyDialogues)
+	{
+		UDlgDialogue* Dialogue = WeakDialogue.Get();
+		if (!IsValid(Dialogue))
+		{
+			continue;
+		}
+
+		if (FDialogueSearchData* SearchData = SearchMap.Find(FSoftObjectPath(Dialogue)))
+		{
+			// Could have been indexed from the asset registry before it was loaded
+			SearchData->Dialogue = Dialogue;
+			IndexDialogue(*SearchData);
+			ChangedDialogues.Add(WeakDialogue);
+		}
+	}
+	DirtyDialogues.Empty();
+
+	if (ChangedDialogues.Num() > 0)
+	{
+		DialoguesChangedDelegate.Broadcast(ChangedDialogues, {});
+	}
+}
+
+void FDlgSearchManager::IndexDialogue(FDialogueSearchData& SearchData)
+{
+	// The GUID could have changed since the last time
+	if (SearchData.IndexedGUID.IsValid())
+	{
+		SearchIndex.RemoveDialogue(SearchData.IndexedGUID);
+		SearchData.IndexedGUID.Invalidate();
+	}
+
+	const UDlgDialogue* Dialogue = SearchData.Dialogue.Get();
+	if (IsValid(Dialogue))
+	{
+		SearchIndex.IndexDialogue(Dialogue);
+		SearchData.IndexedGUID = Dialogue->GetGUID();
 	}
 }
 
@@ -1131,6 +1472,8 @@ void FDlgSearchManager::Initialize(TSharedPtr<FWorkspaceItem> ParentTabCategory)
 		HandleOnAssetRegistryFilesLoaded();
 	}
 	OnAssetLoadedHandle = FCoreUObjectDelegates::OnAssetLoaded.AddRaw(this, &Self::HandleOnAssetLoaded);
+	OnObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &Self::HandleOnObjectModified);
+	OnObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &Self::HandleOnObjectPropertyChanged);
 
 	// Register global find results tabs
 	EnableGlobalFindResults(ParentTabCategory);
@@ -1167,6 +1510,34 @@ void FDlgSearchManager::UnInitialize()
 		FCoreUObjectDelegates::OnAssetLoaded.Remove(OnAssetLoadedHandle);
 		OnAssetLoadedHandle.Reset();
 	}
+	if (OnObjectModifiedHandle.IsValid())
+	{
+		FCoreUObjectDelegates::OnObjectModified.Remove(OnObjectModifiedHandle);
+		OnObjectModifiedHandle.Reset();
+	}
+	if (OnObjectPropertyChangedHandle.IsValid())
+	{
+		FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(OnObjectPropertyChangedHandle);
+		OnObjectPropertyChangedHandle.Reset();
+	}
+	if (ReindexTickerHandle.IsValid())
+	{
+#if NY_ENGINE_VERSION >= 500
+		FTSTicker::GetCoreTicker().RemoveTicker(ReindexTickerHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(ReindexTickerHandle);
+#endif
+		ReindexTickerHandle.Reset();
+	}
+
+	for (const TWeakPtr<FDlgSearchQuery, ESPMode::ThreadSafe>& ActiveQuery : ActiveQueries)
+	{
+		if (FDlgSearchQueryPtr Query = ActiveQuery.Pin())
+		{
+			Query->Cancel();
+		}
+	}
+	ActiveQueries.Empty();
 
 	// Shut down the global find results tab feature.
 	DisableGlobalFindResults();
@@ -1174,21 +1545,50 @@ void FDlgSearchManager::UnInitialize()
 
 void FDlgSearchManager::BuildCache()
 {
-	// Difference between this and the UDlgManager::GetAllDialoguesFromMemory is that this loads all Dialogues
-	// even those that are not loaded into memory.
-	// TODO this seems slow :(
-	// AssetRegistryModule = &FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-	// FARFilter ClassFilter;
-	// ClassFilter.bRecursiveClasses = true;
-	// ClassFilter.ClassNames.Add(UDlgDialogue::StaticClass()->GetFName());
-	// TArray<FAssetData> DialogueAssets;
-	// AssetRegistryModule->Get().GetAssets(ClassFilter, DialogueAssets);
-	// for (FAssetData& Asset : DialogueAssets)
-	// {
-	// 	HandleOnAssetAdded(Asset);
-	// }
-
-	// We already loaded all Dialogues into memory in the StartupModule.
+	// Difference between this and the UDlgManager::GetAllDialoguesFromMemory is that this also finds the Dialogues
+	// that are not loaded into memory, without loading them.
+	FARFilter ClassFilter;
+	ClassFilter.bRecursiveClasses = true;
+#if NY_ENGINE_VERSION >= 501
+	ClassFilter.ClassPaths.Add(UDlgDialogue::StaticClass()->GetClassPathName());
+#else
+	ClassFilter.ClassNames.Add(UDlgDialogue::StaticClass()->GetFName());
+#endif
+	TArray<FAssetData> DialogueAssets;
+	AssetRegistry->GetAssets(ClassFilter, DialogueAssets);
+	for (const FAssetData& AssetData : DialogueAssets)
+	{
+		HandleOnAssetAdded(AssetData);
+	}
+
+	// The index only keeps one Dialogue per GUID, see FDlgEditorUtilities::LoadAllDialoguesAndCheckGUIDs for why they could be duplicated
+	TSet<FGuid> IndexedGUIDs;
+	for (const auto& Elem : SearchMap)
+	{
+		if (!Elem.Value.IndexedGUID.IsValid())
+		{
+			continue;
+		}
+
+		bool bIsAlreadyIndexed = false;
+		IndexedGUIDs.Add(Elem.Value.IndexedGUID, &bIsAlreadyIndexed);
+		if (bIsAlreadyIndexed)
+		{
+			RebuildCacheWithUniqueGUIDs();
+			return;
+		}
+	}
+}
+
+void FDlgSearchManager::RebuildCacheWithUniqueGUIDs()
+{
+	FDlgEditorUtilities::LoadAllDialoguesAndCheckGUIDs();
+
+	SearchMap.Empty();
+	SearchIndex.Empty();
+	DirtyDialogues.Empty();
+
+	// All loaded now, indexed from their graph
 	for (UDlgDialogue* Dialogue : UDlgManager::GetAllDialoguesFromMemory())
 	{
 		FAssetData AssetData(Dialogue);
@@ -1199,7 +1599,8 @@ void FDlgSearchManager::BuildCache()
 void FDlgSearchManager::HandleOnAssetAdded(const FAssetData& InAssetData)
 {
 	// Confirm that the Dialogue has not been added already, this can occur during duplication of Dialogues.
-	const FDialogueSearchData* SearchDataPtr = SearchMap.Find(InAssetData.ToSoftObjectPath());
+	const FSoftObjectPath DialoguePath = InAssetData.ToSoftObjectPath();
+	const FDialogueSearchData* SearchDataPtr = SearchMap.Find(DialoguePath);
 	if (SearchDataPtr != nullptr)
 	{
 		// Already exists
@@ -1212,43 +1613,187 @@ void FDlgSearchManager::HandleOnAssetAdded(const FAssetData& InAssetData)
 		return;
 	}
 
-	// Load the Dialogue
-	UDlgDialogue* Dialogue = Cast<UDlgDialogue>(InAssetData.GetAsset());
-	if (!IsValid(Dialogue))
+	// The loaded Dialogues could have changed since they were saved
+	FDlgSearchDialogueDataPtr SavedData;
+	FString TagValue;
+	if (!InAssetData.IsAssetLoaded() && InAssetData.GetTagValue(UDlgDialogue::GetSearchDataTagName(), TagValue))
 	{
-		return;
+		SavedData = FDlgSearchDialogueData::FromTagValue(TagValue, DialoguePath);
 	}
 
-	// Add to the loaded cached map
 	FDialogueSearchData SearchData;
-	SearchData.Dialogue = Dialogue;
-	SearchMap.Add(InAssetData.ToSoftObjectPath(), MoveTemp(SearchData));
+	if (SavedData.IsValid())
+	{
+		// Searched without loading it
+		SearchIndex.IndexDialogueData(SavedData.ToSharedRef());
+		SearchData.IndexedGUID = SavedData->DialogueGUID;
+	}
+	else
+	{
+		// Loaded already or saved without the search data (or with another version of it), load the Dialogue
+		UDlgDialogue* Dialogue = Cast<UDlgDialogue>(InAssetData.GetAsset());
+		if (!IsValid(Dialogue))
+		{
+			return;
+		}
+
+		SearchData.Dialogue = Dialogue;
+		IndexDialogue(SearchData);
+	}
+
+	// Add to the cached map
+	const TWeakObjectPtr<UDlgDialogue> AddedDialogue = SearchData.Dialogue;
+	SearchMap.Add(DialoguePath, MoveTemp(SearchData));
+	if (AddedDialogue.IsValid())
+	{
+		DialoguesChangedDelegate.Broadcast({AddedDialogue}, {});
+	}
 }
 
 void FDlgSearchManager::HandleOnAssetRemoved(const FAssetData& InAssetData)
 {
-	// TODO
+	FDialogueSearchData SearchData;
+	const FSoftObjectPath DialoguePath = InAssetData.ToSoftObjectPath();
+	if (!SearchMap.RemoveAndCopyValue(DialoguePath, SearchData))
+	{
+		return;
+	}
+
+	// Even if the Dialogue is already destroyed, the listeners only compare the weak pointer (e.g. SDlgBrowser)
+	DialoguesChangedDelegate.Broadcast({}, {SearchData.Dialogue});
+	if (!SearchData.IndexedGUID.IsValid())
+	{
+		return;
+	}
+
+	// Another Dialogue with the same GUID could have replaced the data
+	const FDlgSearchDialogueDataPtr Data = SearchIndex.FindDialogueData(SearchData.IndexedGUID);
+	if (Data.IsValid() && Data->DialoguePath == DialoguePath)
+	{
+		SearchIndex.RemoveDialogue(SearchData.IndexedGUID);
+	}
 }
 
 void FDlgSearchManager::HandleOnAssetRenamed(const FAssetData& InAssetData, const FString& InOldName)
 {
-	// TODO
+	FDialogueSearchData SearchData;
+	if (!SearchMap.RemoveAndCopyValue(FSoftObjectPath(InOldName), SearchData))
+	{
+		// Not one of ours or not cached yet
+		HandleOnAssetAdded(InAssetData);
+		return;
+	}
+
+	const FSoftObjectPath DialoguePath = InAssetData.ToSoftObjectPath();
+	if (!SearchData.Dialogue.IsValid() && InAssetData.IsAssetLoaded())
+	{
+		SearchData.Dialogue = Cast<UDlgDialogue>(InAssetData.GetAsset());
+	}
+
+	UDlgDialogue* Dialogue = SearchData.Dialogue.Get();
+	SearchMap.Add(DialoguePath, MoveTemp(SearchData));
+	if (IsValid(Dialogue))
+	{
+		// Extracted again with the new path
+		MarkDialogueDirty(Dialogue);
+	}
+	else if (const FDlgSearchDialogueDataPtr Data = SearchIndex.FindDialogueData(SearchMap.FindChecked(DialoguePath).IndexedGUID))
+	{
+		// Nothing else changed, only the path of the saved data
+		TSharedRef<FDlgSearchDialogueData, ESPMode::ThreadSafe> RenamedData = MakeShared<FDlgSearchDialogueData, ESPMode::ThreadSafe>(*Data);
+		RenamedData->DialoguePath = DialoguePath;
+		SearchIndex.IndexDialogueData(RenamedData);
+	}
 }
 
 void FDlgSearchManager::HandleOnAssetLoaded(UObject* InAsset)
 {
+	UDlgDialogue* Dialogue = Cast<UDlgDialogue>(InAsset);
+	if (!Dialogue)
+	{
+		return;
+	}
+
+	// Indexed from the asset registry, the saved data is the same as the loaded one until the Dialogue is modified
+	FDialogueSearchData* SearchData = SearchMap.Find(FSoftObjectPath(Dialogue));
+	if (SearchData && !SearchData->Dialogue.IsValid())
+	{
+		SearchData->Dialogue = Dialogue;
+		DialoguesChangedDelegate.Broadcast({SearchData->Dialogue}, {});
+	}
+}
+
+void FDlgSearchManager::HandleOnObjectModified(UObject* Object)
+{
+	MarkDialogueDirty(Object);
+}
 
+void FDlgSearchManager::HandleOnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	MarkDialogueDirty(Object);
+}
+
+void FDlgSearchManager::MarkDialogueDirty(UObject* Object)
+{
+	if (!Object)
+	{
+		return;
+	}
+
+	// The graph, nodes, node data are all inside the Dialogue
+	UDlgDialogue* Dialogue = Cast<UDlgDialogue>(Object);
+	if (Dialogue == nullptr)
+	{
+		Dialogue = Object->GetTypedOuter<UDlgDialogue>();
+	}
+	if (Dialogue == nullptr)
+	{
+		return;
+	}
+
+	// The tag saved with the Dialogue is built again on the next save, even if the reindex did not run yet
+	Dialogue->InvalidateSearchDataTagValue();
+
+	// Rapid edits only push the reindex further away, the query functions reindex right away if needed
+	DirtyDialogues.Add(Dialogue);
+	LastDirtyTime = FPlatformTime::Seconds();
+	if (!ReindexTickerHandle.IsValid())
+	{
+		const FTickerDelegate ReindexDelegate = FTickerDelegate::CreateRaw(this, &Self::HandleReindexTick);
+#if NY_ENGINE_VERSION >= 500
+		ReindexTickerHandle = FTSTicker::GetCoreTicker().AddTicker(ReindexDelegate, ReindexDebounceSeconds);
+#else
+		ReindexTickerHandle = FTicker::GetCoreTicker().AddTicker(ReindexDelegate, ReindexDebounceSeconds);
+#endif
+	}
+}
+
+bool FDlgSearchManager::HandleReindexTick(float DeltaTime)
+{
+	// Still being edited
+	if (FPlatformTime::Seconds() - LastDirtyTime < ReindexDebounceSeconds)
+	{
+		return true;
+	}
+
+	// Removes the ticker
+	ReindexTickerHandle.Reset();
+	UpdateSearchIndex();
+	return false;
 }
 
 void FDlgSearchManager::HandleOnAssetRegistryFilesLoaded()
 {
 	// TODO Pause search if garbage collecting?
-	FDlgEditorUtilities::LoadAllDialoguesAndCheckGUIDs();
 	if (AssetRegistry)
 	{
 		// Do an immediate load of the cache to catch any Blueprints that were discovered by the asset registry before we initialized.
+		// Indexed from the asset registry tags, the Dialogues loaded afterwards are only attached, see HandleOnAssetLoaded
 		BuildCache();
 	}
+
+	// NOTE: the Dialogues are not loaded here, UDlgManager::GetAllDialoguesFromMemory loads them the first time
+	// something needs them (the blueprint nodes, the browser, the suggestions)
 }
 
 #undef LOCTEXT_NAMESPACE
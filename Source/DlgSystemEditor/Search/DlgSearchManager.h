@@ -1,10 +1,14 @@
 // Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
 #pragma once
 
+#include <atomic>
+
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 #include "Widgets/Docking/SDockTab.h"
 
 #include "DlgSearchResult.h"
+#include "DlgSearchIndex.h"
 
 // The maximum amount of global Dialogue Search windows opened.
 static constexpr int32 MAX_GLOBAL_DIALOGUE_SEARCH_RESULTS = 4;
@@ -15,6 +19,7 @@ class FAssetRegistryModule;
 class FWorkspaceItem;
 class UDialogueGraphNode;
 class UDialogueGraphNode_Edge;
+class UEdGraphNode;
 class UEdGraphNode_Comment;
 class IAssetRegistry;
 struct FAssetData;
@@ -25,10 +30,55 @@ struct FDlgTextArgument;
 
 struct DLGSYSTEMEDITOR_API FDialogueSearchData
 {
-	/** The Dialogue this search data points to, if available */
+	/** The Dialogue this search data points to, if available. Not set if the Dialogue was indexed from its asset registry tag without loading it */
 	TWeakObjectPtr<UDlgDialogue> Dialogue;
+
+	/** The GUID the Dialogue was indexed with in the FDlgSearchIndex, invalid if not indexed */
+	FGuid IndexedGUID;
+};
+
+/**
+ * Called on the game thread with the new results (children of the parent node) of a FDlgSearchQuery.
+ * bComplete is true for the last call, NewResults can be empty then.
+ */
+DECLARE_DELEGATE_TwoParams(FDlgSearchResultsDelegate, const TArray<TSharedPtr<FDlgSearchResult>>& /* NewResults */, bool /* bComplete */);
+
+/**
+ * Called on the game thread when loaded Dialogues were (re)indexed, e.g. after they were modified, added or loaded,
+ * and when Dialogues were removed from the index.
+ */
+DECLARE_MULTICAST_DELEGATE_TwoParams(
+	FDlgSearchDialoguesChangedDelegate,
+	const TArray<TWeakObjectPtr<UDlgDialogue>>& /* ChangedDialogues */,
+	const TArray<TWeakObjectPtr<UDlgDialogue>>& /* RemovedDialogues */
+);
+
+/** A search running in the background, see FDlgSearchManager::QueryAllDialoguesAsync */
+class DLGSYSTEMEDITOR_API FDlgSearchQuery
+{
+public:
+	// No more results are reported after this, the background task stops as soon as it can. Thread safe.
+	void Cancel() { bCancelled = true; }
+	bool IsCancelled() const { return bCancelled; }
+
+	// Game thread only
+	bool IsComplete() const { return bComplete; }
+
+private:
+	friend class FDlgSearchManager;
+
+	std::atomic<bool> bCancelled{false};
+
+	// Only accessed on the game thread
+	bool bComplete = false;
+	FDlgSearchFilter SearchFilter;
+	TSharedPtr<FDlgSearchResult> ParentNode;
+	FDlgSearchResultsDelegate OnResults;
 };
 
+using FDlgSearchQueryRef = TSharedRef<FDlgSearchQuery, ESPMode::ThreadSafe>;
+using FDlgSearchQueryPtr = TSharedPtr<FDlgSearchQuery, ESPMode::ThreadSafe>;
+
 /** Singleton manager for handling all Dialogue searches */
 class DLGSYSTEMEDITOR_API FDlgSearchManager
 {
@@ -118,17 +168,65 @@ public:
 
 	/**
 	 * Searches for InSearchString in the InDialogue. Adds the result as a child of OutParentNode.
+	 * @param CandidateNodes If set only these graph nodes of the Dialogue are searched, see FDlgSearchIndex::FindCandidates
 	 * @return True if found anything matching the InSearchString
 	 */
 	bool QuerySingleDialogue(
 		const FDlgSearchFilter& SearchFilter,
 		const UDlgDialogue* InDialogue,
-		TSharedPtr<FDlgSearchResult>& OutParentNode
+		TSharedPtr<FDlgSearchResult>& OutParentNode,
+		const TArray<const UEdGraphNode*>* CandidateNodes = nullptr
 	);
 
-	// Searches for InSearchString in all Dialogues. Adds the result as children of OutParentNode.
+	/**
+	 * Searches for InSearchString in the NodeIndices of the data of a Dialogue that is not loaded. Adds the result as a child of OutParentNode.
+	 * The results only have the matching fields, see FDlgSearchDialogueData::FromTagValue
+	 * @return True if found anything matching the InSearchString
+	 */
+	bool QueryUnloadedDialogue(
+		const FDlgSearchFilter& SearchFilter,
+		const FDlgSearchDialogueData& Data,
+		const TArray<int32>& NodeIndices,
+		const TSharedPtr<FDlgSearchResult>& OutParentNode
+	);
+
+	/**
+	 * Searches for InSearchString in all the loaded Dialogues. Adds the result as children of OutParentNode.
+	 * Only the graph nodes found by the search index are searched, unless the filter can't use the index.
+	 * QueryAllDialoguesAsync also searches the Dialogues that are not loaded.
+	 */
 	void QueryAllDialogues(const FDlgSearchFilter& SearchFilter, TSharedPtr<FDlgSearchResult>& OutParentNode);
 
+	/**
+	 * Same as QueryAllDialogues but the Dialogues are searched on a background thread, over the FDlgSearchDialogueData
+	 * of the Dialogues at the time of this call. The results are built on the game thread (only for the matching nodes)
+	 * and reported in batches to OnResults, as children of OutParentNode.
+	 * Cancel the returned query to stop it, e.g. when a new search is started.
+	 */
+	FDlgSearchQueryRef QueryAllDialoguesAsync(
+		const FDlgSearchFilter& SearchFilter,
+		const TSharedPtr<FDlgSearchResult>& OutParentNode,
+		const FDlgSearchResultsDelegate& OnResults
+	);
+
+	// Can the search index narrow down the nodes searched for this filter?
+	static bool CanUseSearchIndex(const FDlgSearchFilter& SearchFilter)
+	{
+		// The node GUIDs are not indexed
+		return !SearchFilter.bIncludeNodeGUID && FDlgSearchIndex::CanFilter(SearchFilter.SearchString);
+	}
+
+	// Reindexes the Dialogues modified since the last query or the last debounced reindex, in one batch
+	void UpdateSearchIndex();
+
+	// Were Dialogues modified since the last reindex? See UpdateSearchIndex
+	bool HasDirtyDialogues() const { return DirtyDialogues.Num() > 0; }
+
+	const FDlgSearchIndex& GetSearchIndex() const { return SearchIndex; }
+
+	// Lets the views built from the loaded Dialogues update only the Dialogues that changed
+	FDlgSearchDialoguesChangedDelegate& OnDialoguesChanged() { return DialoguesChangedDelegate; }
+
 	// Determines the global find results tab label
 	FText GetGlobalFindResultsTabLabel(int32 TabIdx);
 
@@ -213,16 +311,22 @@ private:
 	// Creates and opens a new global find results tab. The next one in the available list.
 	TSharedPtr<SDlgFindInDialogues> OpenGlobalFindResultsTab();
 
-	// Builds the cache from all available Dialogues assets that the asset registry has discovered at the time of this function. Occurs on startup.
+	/**
+	 * Builds the cache from all available Dialogues assets that the asset registry has discovered at the time of this function. Occurs on startup.
+	 * The Dialogues are indexed from their search data asset registry tag, only the ones without it are loaded.
+	 */
 	void BuildCache();
 
-	// Callback hook from the Asset Registry when an asset is added
+	// Loads all the Dialogues to fix the duplicate GUIDs and indexes them again
+	void RebuildCacheWithUniqueGUIDs();
+
+	// Callback hook from the Asset Registry when an asset is added, the Dialogue is only loaded if it does not have the search data tag
 	void HandleOnAssetAdded(const FAssetData& InAssetData);
 
-	// Callback hook from the Asset Registry, marks the asset for deletion from the cache
+	// Callback hook from the Asset Registry, removes the asset from the cache and the index
 	void HandleOnAssetRemoved(const FAssetData& InAssetData);
 
-	// Callback hook from the Asset Registry, marks the asset for deletion from the cache
+	// Callback hook from the Asset Registry, moves the asset to its new path in the cache
 	void HandleOnAssetRenamed(const FAssetData& InAssetData, const FString& InOldName);
 
 	// Callback hook from the Asset Registry when an asset is loaded
@@ -231,12 +335,61 @@ private:
 	// Callback when the Asset Registry loads all its assets
 	void HandleOnAssetRegistryFilesLoaded();
 
+	// Marks the Dialogue of the modified object for reindexing, Modify() is called before the change
+	void HandleOnObjectModified(UObject* Object);
+
+	// Marks the Dialogue of the changed object for reindexing, after PostEditChangeProperty
+	void HandleOnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+
+	// Adds the Dialogue of the Object (if any) to the DirtyDialogues and (re)starts the debounced reindex
+	void MarkDialogueDirty(UObject* Object);
+
+	// Reindexes the DirtyDialogues once they were not modified for ReindexDebounceSeconds
+	bool HandleReindexTick(float DeltaTime);
+
+	// (Re)indexes the Dialogue of the SearchData
+	void IndexDialogue(FDialogueSearchData& SearchData);
+
+	// Matches of one Dialogue found by the background task of a FDlgSearchQuery
+	struct FDlgSearchMatch
+	{
+		FDlgSearchDialogueDataRef Data;
+
+		// Indices into FDlgSearchDialogueData::Nodes
+		TArray<int32> NodeIndices;
+
+		FDlgSearchMatch(const FDlgSearchDialogueDataRef& InData) : Data(InData) {}
+	};
+
+	// Builds the results of the matches on the game thread and reports them
+	void ReportSearchMatches(const FDlgSearchQueryRef& Query, const TArray<FDlgSearchMatch>& Matches, bool bComplete);
+
 private:
 	static Self* Instance;
 
 	// Maps the Dialogue path => SearchData.
 	TMap<FSoftObjectPath, FDialogueSearchData> SearchMap;
 
+	// Index over all the Dialogues of the SearchMap
+	FDlgSearchIndex SearchIndex;
+
+	// Modified since they were indexed, reindexed before the next query or by the debounced reindex
+	TSet<TWeakObjectPtr<UDlgDialogue>> DirtyDialogues;
+
+	// When the last Dialogue was marked dirty, every edit of a node fires a few modified/changed events
+	double LastDirtyTime = 0.0;
+	static constexpr float ReindexDebounceSeconds = 0.5f;
+
+	// Broadcast after the index of the loaded Dialogues changed
+	FDlgSearchDialoguesChangedDelegate DialoguesChangedDelegate;
+
+	// Cancelled on UnInitialize
+	TArray<TWeakPtr<FDlgSearchQuery, ESPMode::ThreadSafe>> ActiveQueries;
+
+	// A batch of results is reported once it has this many Dialogues or after this many seconds, whichever comes first
+	static constexpr int32 SearchBatchNumDialogues = 32;
+	static constexpr double SearchBatchSeconds = 0.05;
+
 	// Because we are unable to query for the module on another thread, cache it for use later
 	IAssetRegistry* AssetRegistry = nullptr;
 
@@ -255,4 +408,11 @@ private:
 	FDelegateHandle OnAssetRenamedHandle;
 	FDelegateHandle OnFilesLoadedHandle;
 	FDelegateHandle OnAssetLoadedHandle;
+	FDelegateHandle OnObjectModifiedHandle;
+	FDelegateHandle OnObjectPropertyChangedHandle;
+#if NY_ENGINE_VERSION >= 500
+	FTSTicker::FDelegateHandle ReindexTickerHandle;
+#else
+	FDelegateHandle ReindexTickerHandle;
+#endif
 };
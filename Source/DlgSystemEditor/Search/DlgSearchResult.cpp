@@ -6,6 +6,7 @@
 #include "DlgSystemEditor/DlgEditorUtilities.h"
 #include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode.h"
 #include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode_Edge.h"
+#include "DlgSystemEditor/Editor/Graph/DialogueGraph.h"
 #include "DlgSystemEditor/DlgStyle.h"
 
 #define LOCTEXT_NAMESPACE "DialogueSearchResult"
@@ -57,6 +58,12 @@ FDlgSearchResult_DialogueNode::FDlgSearchResult_DialogueNode(const FText& InDisp
 
 FReply FDlgSearchResult_DialogueNode::OnClick()
 {
+	// Found without loading it
+	if (!Dialogue.IsValid() && DialoguePath.IsValid())
+	{
+		Dialogue = Cast<UDlgDialogue>(DialoguePath.TryLoad());
+	}
+
 	if (Dialogue.IsValid())
 	{
 		return FDlgEditorUtilities::OpenEditorForAsset(Dialogue.Get()) ? FReply::Handled() : FReply::Unhandled();
@@ -183,4 +190,31 @@ TSharedRef<SWidget>	FDlgSearchResult_CommentNode::CreateIcon() const
 	return Super::CreateIcon();
 }
 
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FDlgSearchResult_UnloadedGraphNode
+FDlgSearchResult_UnloadedGraphNode::FDlgSearchResult_UnloadedGraphNode(const FText& InDisplayText, const TSharedPtr<FDlgSearchResult>& InParent) :
+	Super(InDisplayText, InParent)
+{
+}
+
+FReply FDlgSearchResult_UnloadedGraphNode::OnClick()
+{
+	// Loads and opens the Dialogue
+	const FReply Reply = Super::OnClick();
+
+	const UDlgDialogue* Dialogue = GetParentDialogue().Get();
+	if (IsValid(Dialogue))
+	{
+		// The Dialogue could have changed since it was saved, the index is only a best guess
+		const TArray<UEdGraphNode*>& GraphNodes = CastChecked<UDialogueGraph>(Dialogue->GetGraph())->GetAllGraphNodes();
+		if (GraphNodes.IsValidIndex(GraphNodeIndex))
+		{
+			return FDlgEditorUtilities::OpenEditorAndJumpToGraphNode(GraphNodes[GraphNodeIndex]) ? FReply::Handled() : FReply::Unhandled();
+		}
+	}
+
+	return Reply;
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -108,9 +108,15 @@ public:
 	// Dialogue:
 	void SetDialogue(TWeakObjectPtr<const UDlgDialogue> InDialogue) { Dialogue = InDialogue; }
 
+	// DialoguePath, the Dialogue is loaded from it on click if it was not loaded when it was found
+	void SetDialoguePath(const FSoftObjectPath& InDialoguePath) { DialoguePath = InDialoguePath; }
+
 protected:
 	// The Dialogue this represents.
 	TWeakObjectPtr<const UDlgDialogue> Dialogue;
+
+	// The path of the Dialogue this represents.
+	FSoftObjectPath DialoguePath;
 };
 
 
@@ -168,3 +174,21 @@ protected:
 	// The EdgeNode this represents.
 	TWeakObjectPtr<const UEdGraphNode_Comment> CommentNode;
 };
+
+
+// Tree Node result that represents a graph node of a Dialogue that was not loaded when it was found, see FDlgSearchDialogueData
+class DLGSYSTEMEDITOR_API FDlgSearchResult_UnloadedGraphNode : public FDlgSearchResult
+{
+	typedef FDlgSearchResult Super;
+public:
+	FDlgSearchResult_UnloadedGraphNode(const FText& InDisplayText, const TSharedPtr<FDlgSearchResult>& InParent);
+
+	FReply OnClick() override;
+
+	// GraphNodeIndex:
+	void SetGraphNodeIndex(int32 InGraphNodeIndex) { GraphNodeIndex = InGraphNodeIndex; }
+
+protected:
+	// Index of the graph node in UDialogueGraph::GetAllGraphNodes when the Dialogue was saved.
+	int32 GraphNodeIndex = INDEX_NONE;
+};
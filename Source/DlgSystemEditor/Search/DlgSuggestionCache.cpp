@@ -0,0 +1,175 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#include "DlgSuggestionCache.h"
+
+#include "Algo/BinarySearch.h"
+
+#include "DlgSystem/DlgManager.h"
+#include "DlgSearchManager.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FDlgSuggestionIndex
+FDlgSuggestionIndex::FDlgSuggestionIndex(const TArray<FString>& InSuggestions)
+	: Suggestions(InSuggestions)
+{
+	LowerSuggestions.Reserve(Suggestions.Num());
+	SortedIndices.Reserve(Suggestions.Num());
+	for (int32 Index = 0; Index < Suggestions.Num(); Index++)
+	{
+		LowerSuggestions.Add(Suggestions[Index].ToLower());
+		SortedIndices.Add(Index);
+	}
+
+	SortedIndices.Sort([this](int32 A, int32 B)
+	{
+		return LowerSuggestions[A].Compare(LowerSuggestions[B], ESearchCase::CaseSensitive) < 0;
+	});
+}
+
+void FDlgSuggestionIndex::FindSuggestions(const FString& SearchText, const TArray<int32>* CandidateIndices, TArray<int32>& OutIndices) const
+{
+	OutIndices.Reset();
+	const FString LowerSearchText = SearchText.ToLower();
+	if (LowerSearchText.IsEmpty())
+	{
+		if (CandidateIndices)
+		{
+			OutIndices = *CandidateIndices;
+		}
+		else
+		{
+			for (int32 Index = 0; Index < Suggestions.Num(); Index++)
+			{
+				OutIndices.Add(Index);
+			}
+		}
+		return;
+	}
+
+	TArray<int32> PrefixIndices;
+	TArray<int32> ContainsIndices;
+	if (CandidateIndices)
+	{
+		// Already narrowed down, check only those
+		for (const int32 Index : *CandidateIndices)
+		{
+			const FString& LowerSuggestion = LowerSuggestions[Index];
+			if (LowerSuggestion.StartsWith(LowerSearchText, ESearchCase::CaseSensitive))
+			{
+				PrefixIndices.Add(Index);
+			}
+			else if (LowerSuggestion.Contains(LowerSearchText, ESearchCase::CaseSensitive))
+			{
+				ContainsIndices.Add(Index);
+			}
+		}
+	}
+	else
+	{
+		// The suggestions that start with the search text are next to each other in the sorted order
+		const int32 FirstSorted = Algo::LowerBoundBy(
+			SortedIndices,
+			LowerSearchText,
+			[this](int32 Index) -> const FString& { return LowerSuggestions[Index]; },
+			[](const FString& A, const FString& B) { return A.Compare(B, ESearchCase::CaseSensitive) < 0; }
+		);
+
+		TBitArray<> IsPrefix(false, Suggestions.Num());
+		for (int32 SortedIndex = FirstSorted; SortedIndex < SortedIndices.Num(); SortedIndex++)
+		{
+			const int32 Index = SortedIndices[SortedIndex];
+			if (!LowerSuggestions[Index].StartsWith(LowerSearchText, ESearchCase::CaseSensitive))
+			{
+				break;
+			}
+
+			PrefixIndices.Add(Index);
+			IsPrefix[Index] = true;
+		}
+
+		for (int32 Index = 0; Index < Suggestions.Num(); Index++)
+		{
+			if (!IsPrefix[Index] && LowerSuggestions[Index].Contains(LowerSearchText, ESearchCase::CaseSensitive))
+			{
+				ContainsIndices.Add(Index);
+			}
+		}
+	}
+
+	// Keep the order of the suggestions inside each group
+	PrefixIndices.Sort();
+	ContainsIndices.Sort();
+	OutIndices = MoveTemp(PrefixIndices);
+	OutIndices.Append(ContainsIndices);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FDlgSuggestionCache
+FDlgSuggestionCache& FDlgSuggestionCache::Get()
+{
+	static Self Instance;
+	return Instance;
+}
+
+FDlgSuggestionCache::FDlgSuggestionCache()
+{
+	FDlgSearchManager::Get()->OnDialoguesChanged().AddRaw(this, &Self::HandleDialoguesChanged);
+}
+
+const TArray<FName>& FDlgSuggestionCache::GetSuggestions(EDlgSuggestionType Type, FName ParticipantName)
+{
+	// The Dialogues modified just now were not reindexed yet, this drops the lists if needed.
+	// Without them the lists are up to date, the pick lists ask on every typed character.
+	FDlgSearchManager* SearchManager = FDlgSearchManager::Get();
+	if (SearchManager->HasDirtyDialogues())
+	{
+		SearchManager->UpdateSearchIndex();
+	}
+
+	FDlgSuggestionKey Key;
+	Key.Type = Type;
+	if (Type != EDlgSuggestionType::ParticipantName && Type != EDlgSuggestionType::SpeakerState)
+	{
+		Key.ParticipantName = ParticipantName;
+	}
+
+	if (const TArray<FName>* List = Lists.Find(Key))
+	{
+		return *List;
+	}
+	return Lists.Add(Key, BuildSuggestions(Type, Key.ParticipantName));
+}
+
+void FDlgSuggestionCache::HandleDialoguesChanged(
+	const TArray<TWeakObjectPtr<UDlgDialogue>>& ChangedDialogues,
+	const TArray<TWeakObjectPtr<UDlgDialogue>>& RemovedDialogues
+)
+{
+	// A Dialogue can add or remove names of any list (even participants), building a list again is as cheap as updating it
+	Empty();
+}
+
+TArray<FName> FDlgSuggestionCache::BuildSuggestions(EDlgSuggestionType Type, FName ParticipantName)
+{
+	switch (Type)
+	{
+	case EDlgSuggestionType::ParticipantName:
+		return UDlgManager::GetDialoguesParticipantNames();
+	case EDlgSuggestionType::SpeakerState:
+		return UDlgManager::GetDialoguesSpeakerStates();
+	case EDlgSuggestionType::IntVariable:
+		return UDlgManager::GetDialoguesParticipantIntNames(ParticipantName);
+	case EDlgSuggestionType::FloatVariable:
+		return UDlgManager::GetDialoguesParticipantFloatNames(ParticipantName);
+	case EDlgSuggestionType::BoolVariable:
+		return UDlgManager::GetDialoguesParticipantBoolNames(ParticipantName);
+	case EDlgSuggestionType::FNameVariable:
+		return UDlgManager::GetDialoguesParticipantFNameNames(ParticipantName);
+	case EDlgSuggestionType::Condition:
+		return UDlgManager::GetDialoguesParticipantConditionNames(ParticipantName);
+	case EDlgSuggestionType::Event:
+		return UDlgManager::GetDialoguesParticipantEventNames(ParticipantName);
+	default:
+		checkNoEntry();
+		return {};
+	}
+}
@@ -0,0 +1,105 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UDlgDialogue;
+
+// What the suggestions are the names of, see FDlgSuggestionCache
+enum class EDlgSuggestionType : uint8
+{
+	// Not specific to a participant
+	ParticipantName,
+	SpeakerState,
+
+	// Of the participant
+	IntVariable,
+	FloatVariable,
+	BoolVariable,
+	FNameVariable,
+	Condition,
+	Event
+};
+
+/**
+ * The suggestions of a pick list, with the lower case suggestions sorted so that the ones that start with the typed text
+ * are found with a binary search. Built once, filtered on every typed character.
+ */
+class DLGSYSTEMEDITOR_API FDlgSuggestionIndex
+{
+public:
+	FDlgSuggestionIndex() {}
+	FDlgSuggestionIndex(const TArray<FString>& InSuggestions);
+
+	const TArray<FString>& GetSuggestions() const { return Suggestions; }
+	int32 Num() const { return Suggestions.Num(); }
+
+	/**
+	 * Finds the suggestions that contain the SearchText (case insensitive), the ones that start with it first.
+	 * Each group keeps the order of the suggestions.
+	 * @param CandidateIndices	If set only these suggestions are checked, e.g. the result for the text typed before SearchText
+	 * @param OutIndices		Indices into GetSuggestions()
+	 */
+	void FindSuggestions(const FString& SearchText, const TArray<int32>* CandidateIndices, TArray<int32>& OutIndices) const;
+
+private:
+	// In the order they were given
+	TArray<FString> Suggestions;
+
+	// Same order as Suggestions
+	TArray<FString> LowerSuggestions;
+
+	// Indices into Suggestions sorted by LowerSuggestions
+	TArray<int32> SortedIndices;
+};
+
+/**
+ * The names the details panels and the blueprint nodes suggest, for each participant and type.
+ * A list is only built the first time it is asked for, from all the Dialogues loaded into memory
+ * (same as the UDlgManager::GetDialogues* functions), until a Dialogue changes.
+ * The lists are dropped when the FDlgSearchManager reindexes, adds or removes a Dialogue.
+ */
+class DLGSYSTEMEDITOR_API FDlgSuggestionCache
+{
+private:
+	typedef FDlgSuggestionCache Self;
+
+public:
+	static Self& Get();
+
+	FDlgSuggestionCache();
+
+	// Sorted alphabetically. ParticipantName is ignored for the ParticipantName and SpeakerState types.
+	// NOTE: only valid until the next change of a Dialogue, copy it to keep it.
+	const TArray<FName>& GetSuggestions(EDlgSuggestionType Type, FName ParticipantName = NAME_None);
+
+	// Drops all the lists, they are built again when needed
+	void Empty() { Lists.Empty(); }
+
+private:
+	void HandleDialoguesChanged(
+		const TArray<TWeakObjectPtr<UDlgDialogue>>& ChangedDialogues,
+		const TArray<TWeakObjectPtr<UDlgDialogue>>& RemovedDialogues
+	);
+
+	static TArray<FName> BuildSuggestions(EDlgSuggestionType Type, FName ParticipantName);
+
+	struct FDlgSuggestionKey
+	{
+		EDlgSuggestionType Type = EDlgSuggestionType::ParticipantName;
+		FName ParticipantName = NAME_None;
+
+		bool operator==(const FDlgSuggestionKey& Other) const
+		{
+			return Type == Other.Type && ParticipantName == Other.ParticipantName;
+		}
+
+		friend uint32 GetTypeHash(const FDlgSuggestionKey& Key)
+		{
+			return HashCombine(GetTypeHash(static_cast<uint8>(Key.Type)), GetTypeHash(Key.ParticipantName));
+		}
+	};
+
+private:
+	TMap<FDlgSuggestionKey, TArray<FName>> Lists;
+};
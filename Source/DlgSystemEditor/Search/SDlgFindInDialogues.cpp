@@ -150,7 +150,7 @@ void SDlgFindInDialogues::Construct(const FArguments& InArgs, const TSharedPtr<F
 
 SDlgFindInDialogues::~SDlgFindInDialogues()
 {
-	// TODO clear all cache for this
+	CancelActiveQuery();
 }
 
 void SDlgFindInDialogues::FocusForUse(bool bSetFindWithinDialogue, const FDlgSearchFilter& SearchFilter, bool bSelectFirstResult)
@@ -171,25 +171,59 @@ void SDlgFindInDialogues::FocusForUse(bool bSetFindWithinDialogue, const FDlgSea
 		SearchTextBoxWidget->SetText(FText::FromString(SearchFilter.SearchString));
 		MakeSearchQuery(SearchFilter, bIsInFindWithinDialogueMode);
 
-		// Select the first result
-		if (bSelectFirstResult && ItemsFound.Num())
+		// Select the first result, now or once the global search finds it
+		if (bSelectFirstResult)
 		{
-			auto ItemToFocusOn = ItemsFound[0];
-
-			// Focus the deepest child
-			while (ItemToFocusOn->HasChildren())
+			if (ActiveQuery.IsValid())
+			{
+				bSelectFirstResultWhenFound = true;
+			}
+			else
 			{
-				ItemToFocusOn = ItemToFocusOn->GetChildren()[0];
+				SelectFirstResult();
 			}
-			TreeView->SetSelection(ItemToFocusOn);
-			ItemToFocusOn->OnClick();
 		}
 	}
 }
 
+void SDlgFindInDialogues::SelectFirstResult()
+{
+	if (ItemsFound.Num() == 0 || !ItemsFound[0].IsValid())
+	{
+		return;
+	}
+
+	auto ItemToFocusOn = ItemsFound[0];
+
+	// Focus the deepest child
+	while (ItemToFocusOn->HasChildren())
+	{
+		ItemToFocusOn = ItemToFocusOn->GetChildren()[0];
+	}
+	TreeView->SetSelection(ItemToFocusOn);
+	ItemToFocusOn->OnClick();
+}
+
+void SDlgFindInDialogues::CancelActiveQuery()
+{
+	if (ActiveQuery.IsValid())
+	{
+		ActiveQuery->Cancel();
+		ActiveQuery.Reset();
+	}
+	bSelectFirstResultWhenFound = false;
+}
+
 void SDlgFindInDialogues::MakeSearchQuery(const FDlgSearchFilter& SearchFilter, bool bInIsFindWithinDialogue)
 {
-	SearchTextBoxWidget->SetText(FText::FromString(SearchFilter.SearchString));
+	// The previous results are not wanted anymore
+	CancelActiveQuery();
+
+	// Only if different, otherwise we are called again from HandleSearchTextChanged
+	if (!SearchTextBoxWidget->GetText().ToString().Equals(SearchFilter.SearchString, ESearchCase::CaseSensitive))
+	{
+		SearchTextBoxWidget->SetText(FText::FromString(SearchFilter.SearchString));
+	}
 
 	// Reset the scroll to the top
 	if (ItemsFound.Num())
@@ -201,13 +235,13 @@ void SDlgFindInDialogues::MakeSearchQuery(const FDlgSearchFilter& SearchFilter,
 	// Nothing to search for :(
 	if (SearchFilter.SearchString.IsEmpty())
 	{
+		TreeView->RequestTreeRefresh();
 		return;
 	}
 
 	HighlightText = FText::FromString(SearchFilter.SearchString);
 	RootSearchResult = MakeShared<FDlgSearchResult_RootNode>();
 
-	// TODO use threads extend FRunnable
 	if (bInIsFindWithinDialogue)
 	{
 		// Local
@@ -230,8 +264,14 @@ void SDlgFindInDialogues::MakeSearchQuery(const FDlgSearchFilter& SearchFilter,
 	}
 	else
 	{
-		// Global
-		FDlgSearchManager::Get()->QueryAllDialogues(SearchFilter, RootSearchResult);
+		// Global, the results come in HandleSearchResults
+		ActiveQuery = FDlgSearchManager::Get()->QueryAllDialoguesAsync(
+			SearchFilter,
+			RootSearchResult,
+			FDlgSearchResultsDelegate::CreateSP(this, &Self::HandleSearchResults)
+		);
+		TreeView->RequestTreeRefresh();
+		return;
 	}
 
 	ItemsFound = RootSearchResult->GetChildren();
@@ -276,9 +316,43 @@ void SDlgFindInDialogues::HandleHostTabClosed(TSharedRef<SDockTab> DockTab)
 	FDlgSearchManager::Get()->CloseGlobalFindResults(SharedThis(this));
 }
 
+void SDlgFindInDialogues::HandleSearchResults(const TArray<TSharedPtr<FDlgSearchResult>>& NewResults, bool bComplete)
+{
+	ItemsFound.Append(NewResults);
+	for (const TSharedPtr<FDlgSearchResult>& Result : NewResults)
+	{
+		Result->ExpandAllChildren(TreeView);
+	}
+
+	if (bSelectFirstResultWhenFound && ItemsFound.Num() > 0)
+	{
+		bSelectFirstResultWhenFound = false;
+		SelectFirstResult();
+	}
+
+	if (bComplete)
+	{
+		ActiveQuery.Reset();
+		bSelectFirstResultWhenFound = false;
+		if (ItemsFound.Num() == 0)
+		{
+			ItemsFound.Add(MakeShared<FDlgSearchResult>(LOCTEXT("DialogueSearchNoResults", "No Results found"), RootSearchResult));
+			HighlightText = FText::GetEmpty();
+		}
+	}
+
+	TreeView->RequestTreeRefresh();
+}
+
 void SDlgFindInDialogues::HandleSearchTextChanged(const FText& Text)
 {
 	CurrentFilter.SearchString = Text.ToString();
+
+	// The global search does not block, search as we type, every keystroke cancels the previous search
+	if (!bIsInFindWithinDialogueMode)
+	{
+		MakeSearchQuery(CurrentFilter, false);
+	}
 }
 
 void SDlgFindInDialogues::HandleSearchTextCommitted(const FText& Text, ETextCommit::Type CommitType)
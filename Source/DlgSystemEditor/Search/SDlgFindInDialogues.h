@@ -9,6 +9,7 @@
 #include "DlgSearchResult.h"
 
 class FDlgEditor;
+class FDlgSearchQuery;
 class SSearchBox;
 class SDockTab;
 
@@ -36,7 +37,9 @@ public:
 	void FocusForUse(bool bSetFindWithinDialogue, const FDlgSearchFilter& SearchFilter = FDlgSearchFilter(), bool bSelectFirstResult = false);
 
 	/**
-	 * Submits a search query
+	 * Submits a search query, cancels the previous one if it is still running.
+	 * The search within the current Dialogue is done immediately, the global search runs in the background
+	 * and its results are added as they are found.
 	 *
 	 * @param SearchFilter						Filter for search
 	 * @param bInIsFindWithinDialogue			TRUE if searching within the current Dialogue only
@@ -50,6 +53,15 @@ public:
 	void CloseHostTab();
 
 private:
+	/** Called with the results of the global search as they are found */
+	void HandleSearchResults(const TArray<TSharedPtr<FDlgSearchResult>>& NewResults, bool bComplete);
+
+	/** Selects and focuses the deepest first result */
+	void SelectFirstResult();
+
+	/** Stops the running global search, if any */
+	void CancelActiveQuery();
+
 	/** Called when the host tab is closed (if valid) */
 	void HandleHostTabClosed(TSharedRef<SDockTab> DockTab);
 
@@ -114,6 +126,12 @@ private:
 	/** The current searach filter */
 	FDlgSearchFilter CurrentFilter;
 
+	/** The running global search */
+	TSharedPtr<FDlgSearchQuery, ESPMode::ThreadSafe> ActiveQuery;
+
+	/** Select the first result of the running global search once it is found */
+	bool bSelectFirstResultWhenFound = false;
+
 	/** Should we search within the current Dialogue only (rather than all Dialogues) */
 	bool bIsInFindWithinDialogueMode;
 
@@ -0,0 +1,337 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Kismet2/CompilerResultsLog.h"
+
+#include "DlgSystem/Tests/DlgBenchmarkTypes.h"
+#include "DlgSystem/Tests/DlgDialogueGenerator.h"
+#include "DlgSystem/DlgDialogue.h"
+#include "DlgSystem/DlgSystemSettings.h"
+#include "DlgSystem/Nodes/DlgNode_Speech.h"
+#include "DlgSystemEditor/Editor/DlgCompiler.h"
+#include "DlgSystemEditor/Editor/Graph/DialogueGraph.h"
+#include "DlgSystemEditor/Editor/Graph/DialogueGraphSchema.h"
+#include "DlgSystemEditor/Editor/Graph/SchemaActions/DlgNewNode_GraphSchemaAction.h"
+#include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode_Root.h"
+#include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode_Edge.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class FDlgCompilerBenchmark
+{
+public:
+	// Compiles the generated dialogue of size NumNodes
+	static void BenchmarkDialogue(FDlgBenchmarkReport& Report, FAutomationTestBase& Test, int32 NumNodes, const UDlgBenchmarkSettings& Settings);
+
+	// Every node reachable from the root nodes must have a primary edge pointing to it, edges to the node itself are secondary
+	static void TestEdgesCategorization(FAutomationTestBase& Test, const UDialogueGraph* Graph, int32 NumNodes);
+
+	// The generated dialogue of size NumNodes compiled once, only the tests compile it after this (see UDlgDialogue::DisableCompileDialogue)
+	static UDlgDialogue* CreateCompiledDialogue(int32 NumNodes);
+
+	// The deepest node reached by the last compile that can have children, nullptr if there is none
+	static UDialogueGraphNode* FindDeepestParentGraphNode(const UDialogueGraph* Graph);
+
+	// What the incremental compile must leave the same as the full compile, in the graph nodes order
+	static void GetCompiledData(const UDialogueGraph* Graph, TArray<int32>& OutNodeIndices, TArray<int32>& OutTargetIndices, TArray<bool>& OutPrimaryEdges);
+
+	// Compiles the whole Dialogue again and tests that nothing changed since the last compile
+	static void TestSameAsFullCompile(FAutomationTestBase& Test, UDlgDialogue* Dialogue);
+};
+
+void FDlgCompilerBenchmark::BenchmarkDialogue(FDlgBenchmarkReport& Report, FAutomationTestBase& Test, int32 NumNodes, const UDlgBenchmarkSettings& Settings)
+{
+	FDlgDialogueGeneratorOptions Options;
+	Options.Seed = Settings.Seed;
+	Options.NumNodes = NumNodes;
+	UDlgDialogue* Dialogue = FDlgDialogueGenerator::GenerateDialogue(Options);
+	Dialogue->CreateGraph();
+
+	// Nothing here should be garbage collected while measuring
+	Dialogue->AddToRoot();
+
+	const UDlgSystemSettings* SystemSettings = GetDefault<UDlgSystemSettings>();
+	FCompilerResultsLog MessageLog;
+	{
+		FDlgBenchmarkMemoryScope MemoryScope;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Settings.CompileIterations; Iteration++)
+		{
+			FDlgCompilerContext CompilerContext(Dialogue, SystemSettings, MessageLog);
+			CompilerContext.Compile();
+		}
+		Report.AddResult(TEXT("Compile"), NumNodes, Settings.CompileIterations, FPlatformTime::Seconds() - StartTime, MemoryScope.GetPeakBytes());
+	}
+
+	// What a connection change that does not change any index costs, the deepest node is the worst case for the categorization
+	UDialogueGraph* DialogueGraph = CastChecked<UDialogueGraph>(Dialogue->GetGraph());
+	UDialogueGraphNode* DirtyGraphNode = nullptr;
+	for (UDialogueGraphNode* GraphNode : DialogueGraph->GetAllDialogueGraphNodes())
+	{
+		if (GraphNode->GetCompiledParentNode() && (!DirtyGraphNode || GraphNode->GetNodeDepth() > DirtyGraphNode->GetNodeDepth()))
+		{
+			DirtyGraphNode = GraphNode;
+		}
+	}
+	if (DirtyGraphNode)
+	{
+		int32 NumIncrementalCompiles = 0;
+		FDlgBenchmarkMemoryScope MemoryScope;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Settings.CompileIterations; Iteration++)
+		{
+			DialogueGraph->MarkGraphNodeDirty(DirtyGraphNode);
+			FDlgCompilerContext CompilerContext(Dialogue, SystemSettings, MessageLog);
+			NumIncrementalCompiles += CompilerContext.CompileIncremental() ? 1 : 0;
+		}
+		Report.AddResult(TEXT("CompileIncremental"), NumNodes, Settings.CompileIterations, FPlatformTime::Seconds() - StartTime, MemoryScope.GetPeakBytes());
+
+		Test.TestEqual(
+			FString::Printf(TEXT("Nothing changed, no full compile is needed (NumNodes = %d)"), NumNodes),
+			NumIncrementalCompiles, Settings.CompileIterations
+		);
+	}
+
+	TestEdgesCategorization(Test, CastChecked<UDialogueGraph>(Dialogue->GetGraph()), NumNodes);
+	Dialogue->RemoveFromRoot();
+}
+
+void FDlgCompilerBenchmark::TestEdgesCategorization(FAutomationTestBase& Test, const UDialogueGraph* Graph, int32 NumNodes)
+{
+	TSet<const UDialogueGraphNode*> ReachableNodes;
+	TArray<const UDialogueGraphNode*> Stack;
+	for (const UDialogueGraphNode_Root* RootNode : Graph->GetRootGraphNodes())
+	{
+		ReachableNodes.Add(RootNode);
+		Stack.Add(RootNode);
+	}
+	while (Stack.Num() > 0)
+	{
+		const UDialogueGraphNode* GraphNode = Stack.Pop();
+		for (const UDialogueGraphNode* ChildNode : GraphNode->GetChildNodes())
+		{
+			bool bIsAlreadyReached = false;
+			ReachableNodes.Add(ChildNode, &bIsAlreadyReached);
+			if (!bIsAlreadyReached)
+			{
+				Stack.Add(ChildNode);
+			}
+		}
+	}
+
+	int32 NumNodesWithoutPrimaryEdge = 0;
+	int32 NumPrimaryEdgesToItself = 0;
+	for (const UDialogueGraphNode* GraphNode : ReachableNodes)
+	{
+		if (GraphNode->IsRootNode())
+		{
+			continue;
+		}
+
+		bool bHasPrimaryEdge = false;
+		for (const UDialogueGraphNode_Edge* ParentEdgeNode : GraphNode->GetParentEdgeNodes())
+		{
+			if (!ParentEdgeNode->IsPrimaryEdge())
+			{
+				continue;
+			}
+
+			bHasPrimaryEdge = true;
+			if (ParentEdgeNode->GetParentNode() == GraphNode)
+			{
+				NumPrimaryEdgesToItself++;
+			}
+		}
+		if (!bHasPrimaryEdge)
+		{
+			NumNodesWithoutPrimaryEdge++;
+		}
+	}
+
+	Test.TestEqual(FString::Printf(TEXT("Every reachable node has a primary edge (NumNodes = %d)"), NumNodes), NumNodesWithoutPrimaryEdge, 0);
+	Test.TestEqual(FString::Printf(TEXT("The edges to the node itself are secondary (NumNodes = %d)"), NumNodes), NumPrimaryEdgesToItself, 0);
+}
+
+UDlgDialogue* FDlgCompilerBenchmark::CreateCompiledDialogue(int32 NumNodes)
+{
+	FDlgDialogueGeneratorOptions Options;
+	Options.Seed = GetDefault<UDlgBenchmarkSettings>()->Seed;
+	Options.NumNodes = NumNodes;
+	UDlgDialogue* Dialogue = FDlgDialogueGenerator::GenerateDialogue(Options);
+	Dialogue->CreateGraph();
+	Dialogue->AddToRoot();
+	Dialogue->DisableCompileDialogue();
+
+	FCompilerResultsLog MessageLog;
+	FDlgCompilerContext CompilerContext(Dialogue, GetDefault<UDlgSystemSettings>(), MessageLog);
+	CompilerContext.Compile();
+	return Dialogue;
+}
+
+UDialogueGraphNode* FDlgCompilerBenchmark::FindDeepestParentGraphNode(const UDialogueGraph* Graph)
+{
+	UDialogueGraphNode* DeepestGraphNode = nullptr;
+	for (UDialogueGraphNode* GraphNode : Graph->GetAllDialogueGraphNodes())
+	{
+		if (GraphNode->GetCompiledParentNode() && GraphNode->CanHaveOutputConnections()
+			&& (!DeepestGraphNode || GraphNode->GetNodeDepth() > DeepestGraphNode->GetNodeDepth()))
+		{
+			DeepestGraphNode = GraphNode;
+		}
+	}
+
+	return DeepestGraphNode;
+}
+
+void FDlgCompilerBenchmark::GetCompiledData(const UDialogueGraph* Graph, TArray<int32>& OutNodeIndices, TArray<int32>& OutTargetIndices, TArray<bool>& OutPrimaryEdges)
+{
+	for (const UDialogueGraphNode* GraphNode : Graph->GetAllDialogueGraphNodes())
+	{
+		OutNodeIndices.Add(GraphNode->GetDialogueNodeIndex());
+		for (const FDlgEdge& Edge : GraphNode->GetDialogueNode().GetNodeChildren())
+		{
+			OutTargetIndices.Add(Edge.TargetIndex);
+		}
+		for (const UDialogueGraphNode_Edge* ChildEdgeNode : GraphNode->GetChildEdgeNodes())
+		{
+			OutTargetIndices.Add(ChildEdgeNode->GetDialogueEdge().TargetIndex);
+			OutPrimaryEdges.Add(ChildEdgeNode->IsPrimaryEdge());
+		}
+	}
+}
+
+void FDlgCompilerBenchmark::TestSameAsFullCompile(FAutomationTestBase& Test, UDlgDialogue* Dialogue)
+{
+	const UDialogueGraph* DialogueGraph = CastChecked<UDialogueGraph>(Dialogue->GetGraph());
+	TArray<int32> NodeIndices;
+	TArray<int32> TargetIndices;
+	TArray<bool> PrimaryEdges;
+	GetCompiledData(DialogueGraph, NodeIndices, TargetIndices, PrimaryEdges);
+
+	FCompilerResultsLog MessageLog;
+	FDlgCompilerContext CompilerContext(Dialogue, GetDefault<UDlgSystemSettings>(), MessageLog);
+	CompilerContext.Compile();
+
+	TArray<int32> FullNodeIndices;
+	TArray<int32> FullTargetIndices;
+	TArray<bool> FullPrimaryEdges;
+	GetCompiledData(DialogueGraph, FullNodeIndices, FullTargetIndices, FullPrimaryEdges);
+
+	Test.TestTrue(TEXT("The node indices are the same as the full compile ones"), NodeIndices == FullNodeIndices);
+	Test.TestTrue(TEXT("The edge target indices are the same as the full compile ones"), TargetIndices == FullTargetIndices);
+	Test.TestTrue(TEXT("The primary edges are the same as the full compile ones"), PrimaryEdges == FullPrimaryEdges);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgCompilerIncrementalTest,
+	"DlgSystem.Editor.CompilerIncremental",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FDlgCompilerIncrementalTest::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumNodes = 100;
+	UDlgDialogue* Dialogue = FDlgCompilerBenchmark::CreateCompiledDialogue(NumNodes);
+	UDialogueGraph* DialogueGraph = CastChecked<UDialogueGraph>(Dialogue->GetGraph());
+
+	// A new edge from the deepest node to a node the BFS reached before it, this does not change any node index
+	UDialogueGraphNode* ParentNode = FDlgCompilerBenchmark::FindDeepestParentGraphNode(DialogueGraph);
+	UDialogueGraphNode* ChildNode = nullptr;
+	if (ParentNode)
+	{
+		const TArray<UDialogueGraphNode*> ParentChildNodes = ParentNode->GetChildNodes();
+		for (UDialogueGraphNode* GraphNode : DialogueGraph->GetAllDialogueGraphNodes())
+		{
+			if (!GraphNode->IsRootNode() && GraphNode != ParentNode && GraphNode->CanHaveInputConnections()
+				&& GraphNode->GetDialogueNodeIndex() < ParentNode->GetDialogueNodeIndex() && !ParentChildNodes.Contains(GraphNode))
+			{
+				ChildNode = GraphNode;
+				break;
+			}
+		}
+	}
+	if (!TestNotNull(TEXT("The generated dialogue has a connection to add"), ChildNode))
+	{
+		Dialogue->RemoveFromRoot();
+		return false;
+	}
+
+	TestTrue(TEXT("The connection is created"), DialogueGraph->GetDialogueGraphSchema()->TryCreateConnection(ParentNode->GetOutputPin(), ChildNode->GetInputPin()));
+	{
+		FCompilerResultsLog MessageLog;
+		FDlgCompilerContext CompilerContext(Dialogue, GetDefault<UDlgSystemSettings>(), MessageLog);
+		TestTrue(TEXT("A new connection to an earlier node is compiled incrementally"), CompilerContext.CompileIncremental());
+	}
+	FDlgCompilerBenchmark::TestSameAsFullCompile(*this, Dialogue);
+
+	Dialogue->RemoveFromRoot();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgCompilerIncrementalFallbackTest,
+	"DlgSystem.Editor.CompilerIncrementalFallback",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FDlgCompilerIncrementalFallbackTest::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumNodes = 100;
+	UDlgDialogue* Dialogue = FDlgCompilerBenchmark::CreateCompiledDialogue(NumNodes);
+	UDialogueGraph* DialogueGraph = CastChecked<UDialogueGraph>(Dialogue->GetGraph());
+	UDialogueGraphNode* ParentNode = FDlgCompilerBenchmark::FindDeepestParentGraphNode(DialogueGraph);
+	if (!TestNotNull(TEXT("The generated dialogue has a node that can have children"), ParentNode))
+	{
+		Dialogue->RemoveFromRoot();
+		return false;
+	}
+
+	// A new node connected to the deepest node, the last compile has not seen it so its index is unknown
+	UDialogueGraphNode* NewGraphNode = FDlgNewNode_GraphSchemaAction::SpawnGraphNodeWithDialogueNodeFromTemplate<UDialogueGraphNode>(
+		DialogueGraph, UDlgNode_Speech::StaticClass(), FNYVector2f(ParentNode->NodePosX, ParentNode->NodePosY + 200), false
+	);
+	TestTrue(TEXT("The connection is created"), DialogueGraph->GetDialogueGraphSchema()->TryCreateConnection(ParentNode->GetOutputPin(), NewGraphNode->GetInputPin()));
+	{
+		FCompilerResultsLog MessageLog;
+		FDlgCompilerContext CompilerContext(Dialogue, GetDefault<UDlgSystemSettings>(), MessageLog);
+		TestFalse(TEXT("A new node is not compiled incrementally"), CompilerContext.CompileIncremental());
+		TestTrue(TEXT("The incremental compile left the changes for the full compile"), DialogueGraph->GetDirtyGraphNodes().Num() > 0);
+	}
+
+	// What the editor does (see FDlgEditorAccess::CompileDialogueNodesFromGraphNodes), the fallback must compile the new node
+	Dialogue->EnableCompileDialogue();
+	Dialogue->CompileDialogueNodesFromGraphNodes();
+	Dialogue->DisableCompileDialogue();
+	TestEqual(TEXT("The full compile cleared the changes"), DialogueGraph->GetDirtyGraphNodes().Num(), 0);
+	TestTrue(TEXT("The new node is reached from its parent"), NewGraphNode->GetCompiledParentNode() == ParentNode);
+	TestEqual(
+		TEXT("The new node has its dialogue node index"),
+		NewGraphNode->GetDialogueNodeIndex(), Dialogue->GetNodes().IndexOfByKey(NewGraphNode->GetMutableDialogueNode())
+	);
+	FDlgCompilerBenchmark::TestSameAsFullCompile(*this, Dialogue);
+
+	Dialogue->RemoveFromRoot();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgCompilerBenchmarkTest,
+	"DlgSystem.Benchmarks.Compiler",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FDlgCompilerBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const UDlgBenchmarkSettings* Settings = GetDefault<UDlgBenchmarkSettings>();
+	FDlgBenchmarkReport Report(TEXT("Compiler"));
+	for (const int32 NumNodes : Settings->CompileDialogueSizes)
+	{
+		FDlgCompilerBenchmark::BenchmarkDialogue(Report, *this, NumNodes, *Settings);
+	}
+
+	return Report.ReportTo(*this, TEXT("NumNodes"));
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
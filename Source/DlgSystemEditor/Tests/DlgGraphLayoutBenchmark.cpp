@@ -0,0 +1,183 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+
+#include "DlgSystem/Tests/DlgBenchmarkTypes.h"
+#include "DlgSystem/Tests/DlgDialogueGenerator.h"
+#include "DlgSystem/DlgDialogue.h"
+#include "DlgSystemEditor/Editor/DlgGraphLayout.h"
+#include "DlgSystemEditor/Editor/Graph/DialogueGraph.h"
+#include "DlgSystemEditor/Editor/Nodes/DialogueGraphNode.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class FDlgGraphLayoutBenchmark
+{
+public:
+	// Lays out the graph of the generated dialogue of size NumNodes
+	static void BenchmarkDialogue(FDlgBenchmarkReport& Report, FAutomationTestBase& Test, int32 NumNodes, const UDlgBenchmarkSettings& Settings);
+
+	// The nodes of the same layer must not overlap and the ends of every edge must be in different layers
+	static void TestLayout(FAutomationTestBase& Test, const FDlgGraphLayout& Layout, const TArray<UDialogueGraphNode*>& GraphNodes, int32 NumNodes);
+};
+
+void FDlgGraphLayoutBenchmark::BenchmarkDialogue(FDlgBenchmarkReport& Report, FAutomationTestBase& Test, int32 NumNodes, const UDlgBenchmarkSettings& Settings)
+{
+	FDlgDialogueGeneratorOptions Options;
+	Options.Seed = Settings.Seed;
+	Options.NumNodes = NumNodes;
+	UDlgDialogue* Dialogue = FDlgDialogueGenerator::GenerateDialogue(Options);
+	Dialogue->CreateGraph();
+
+	// Nothing here should be garbage collected while measuring
+	Dialogue->AddToRoot();
+
+	const TArray<UDialogueGraphNode*> GraphNodes = CastChecked<UDialogueGraph>(Dialogue->GetGraph())->GetAllDialogueGraphNodes();
+	const FDlgGraphLayoutSettings LayoutSettings = FDlgGraphLayoutSettings::FromSystemSettings();
+	TSharedPtr<FDlgGraphLayout> Layout;
+	{
+		FDlgBenchmarkMemoryScope MemoryScope;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Settings.LayoutIterations; Iteration++)
+		{
+			Layout = FDlgGraphLayout::FromGraphNodes(GraphNodes, LayoutSettings);
+		}
+		Report.AddResult(TEXT("FromGraphNodes"), NumNodes, Settings.LayoutIterations, FPlatformTime::Seconds() - StartTime, MemoryScope.GetPeakBytes());
+	}
+	{
+		// What runs in the background, a copy each time so that every iteration starts from the same input
+		FDlgBenchmarkMemoryScope MemoryScope;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Settings.LayoutIterations; Iteration++)
+		{
+			Layout = MakeShared<FDlgGraphLayout>(*Layout);
+			Layout->Compute();
+		}
+		Report.AddResult(TEXT("Compute"), NumNodes, Settings.LayoutIterations, FPlatformTime::Seconds() - StartTime, MemoryScope.GetPeakBytes());
+	}
+
+	TestLayout(Test, *Layout, GraphNodes, NumNodes);
+	Dialogue->RemoveFromRoot();
+}
+
+void FDlgGraphLayoutBenchmark::TestLayout(FAutomationTestBase& Test, const FDlgGraphLayout& Layout, const TArray<UDialogueGraphNode*>& GraphNodes, int32 NumNodes)
+{
+	const TArray<FIntPoint>& Positions = Layout.GetPositions();
+	const TArray<int32>& Layers = Layout.GetLayers();
+	if (!Test.TestEqual(FString::Printf(TEXT("Every node has a position (NumNodes = %d)"), NumNodes), Positions.Num(), GraphNodes.Num()))
+	{
+		return;
+	}
+
+	TMap<const UDialogueGraphNode*, int32> NodeIndices;
+	for (int32 NodeIndex = 0; NodeIndex < GraphNodes.Num(); NodeIndex++)
+	{
+		NodeIndices.Add(GraphNodes[NodeIndex], NodeIndex);
+	}
+
+	int32 NumEdgesInSameLayer = 0;
+	for (int32 NodeIndex = 0; NodeIndex < GraphNodes.Num(); NodeIndex++)
+	{
+		for (const UDialogueGraphNode* ChildNode : GraphNodes[NodeIndex]->GetChildNodes())
+		{
+			const int32 ChildIndex = NodeIndices.FindChecked(ChildNode);
+			if (ChildIndex != NodeIndex && Layers[ChildIndex] == Layers[NodeIndex])
+			{
+				NumEdgesInSameLayer++;
+			}
+		}
+	}
+
+	// The direction is vertical, the layers are rows
+	TMap<int32, TArray<int32>> LayerNodes;
+	for (int32 NodeIndex = 0; NodeIndex < GraphNodes.Num(); NodeIndex++)
+	{
+		LayerNodes.FindOrAdd(Layers[NodeIndex]).Add(NodeIndex);
+	}
+	int32 NumOverlaps = 0;
+	for (TPair<int32, TArray<int32>>& Pair : LayerNodes)
+	{
+		Pair.Value.Sort([&Positions](int32 A, int32 B)
+		{
+			return Positions[A].X < Positions[B].X;
+		});
+		for (int32 Order = 1; Order < Pair.Value.Num(); Order++)
+		{
+			const int32 PreviousIndex = Pair.Value[Order - 1];
+			// One unit for the rounding
+			if (Positions[PreviousIndex].X + GraphNodes[PreviousIndex]->EstimateNodeWidth() > Positions[Pair.Value[Order]].X + 1)
+			{
+				NumOverlaps++;
+			}
+		}
+	}
+
+	Test.TestEqual(FString::Printf(TEXT("The ends of every edge are in different layers (NumNodes = %d)"), NumNodes), NumEdgesInSameLayer, 0);
+	Test.TestEqual(FString::Printf(TEXT("The nodes of the same layer do not overlap (NumNodes = %d)"), NumNodes), NumOverlaps, 0);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgGraphLayoutRootOrderTest,
+	"DlgSystem.Editor.GraphLayoutRootOrder",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FDlgGraphLayoutRootOrderTest::RunTest(const FString& Parameters)
+{
+	// Three roots, the children are crossed so that the barycenters would swap the roots
+	FDlgGraphLayoutSettings LayoutSettings;
+	FDlgGraphLayout Layout(LayoutSettings);
+	const FIntPoint Size(200, 100);
+	TArray<int32> Roots;
+	TArray<int32> RootChildren;
+	for (int32 Index = 0; Index < 3; Index++)
+	{
+		Roots.Add(Layout.AddNode(Size, true));
+	}
+	for (int32 Index = 0; Index < 3; Index++)
+	{
+		RootChildren.Add(Layout.AddNode(Size, false));
+	}
+	Layout.AddEdge(Roots[0], RootChildren[2]);
+	Layout.AddEdge(Roots[1], RootChildren[1]);
+	Layout.AddEdge(Roots[2], RootChildren[0]);
+	Layout.AddEdge(RootChildren[0], RootChildren[1]);
+
+	// Not the order they were added in
+	const TArray<int32> RootOrder = { Roots[2], Roots[0], Roots[1] };
+	Layout.SetRootOrder(RootOrder);
+	Layout.Compute();
+
+	const TArray<FIntPoint>& Positions = Layout.GetPositions();
+	for (int32 Order = 1; Order < RootOrder.Num(); Order++)
+	{
+		TestTrue(
+			FString::Printf(TEXT("Root %d is placed after root %d"), RootOrder[Order], RootOrder[Order - 1]),
+			Positions[RootOrder[Order]].X > Positions[RootOrder[Order - 1]].X
+		);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgGraphLayoutBenchmarkTest,
+	"DlgSystem.Benchmarks.GraphLayout",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FDlgGraphLayoutBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const UDlgBenchmarkSettings* Settings = GetDefault<UDlgBenchmarkSettings>();
+	FDlgBenchmarkReport Report(TEXT("GraphLayout"));
+	for (const int32 NumNodes : Settings->LayoutDialogueSizes)
+	{
+		FDlgGraphLayoutBenchmark::BenchmarkDialogue(Report, *this, NumNodes, *Settings);
+	}
+
+	return Report.ReportTo(*this, TEXT("NumNodes"));
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,284 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+
+#include "DlgSystem/Tests/DlgBenchmarkTypes.h"
+#include "DlgSystem/Tests/DlgDialogueGenerator.h"
+#include "DlgSystem/DlgDialogue.h"
+#include "DlgSystem/Nodes/DlgNode_SpeechSequence.h"
+#include "DlgSystemEditor/Search/DlgSearchIndex.h"
+#include "DlgSystemEditor/Search/DlgSearchManager.h"
+#include "DlgSystemEditor/Search/DlgSearchResult.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class FDlgSearchIndexBenchmark
+{
+public:
+	// Runs all the cases for a project of NumDialogues generated dialogues
+	static void BenchmarkProject(FDlgBenchmarkReport& Report, FAutomationTestBase& Test, int32 NumDialogues, const UDlgBenchmarkSettings& Settings);
+
+	// Same as FDlgSearchManager::QueryAllDialogues, with or without the index, returns the number of results
+	static int32 Query(const FDlgSearchFilter& SearchFilter, const TArray<UDlgDialogue*>& Dialogues, const FDlgSearchIndex* SearchIndex);
+
+	// What the background task of FDlgSearchManager::QueryAllDialoguesAsync does, returns the number of Dialogues that matched
+	static int32 MatchData(const FDlgSearchFilter& SearchFilter, const TArray<FDlgSearchDialogueDataRef>& Snapshot, const FDlgSearchIndex& SearchIndex);
+
+	static int32 CountResults(const TSharedPtr<FDlgSearchResult>& Result);
+};
+
+void FDlgSearchIndexBenchmark::BenchmarkProject(FDlgBenchmarkReport& Report, FAutomationTestBase& Test, int32 NumDialogues, const UDlgBenchmarkSettings& Settings)
+{
+	// Nothing here should be garbage collected while measuring
+	TArray<UDlgDialogue*> Dialogues;
+	for (int32 Index = 0; Index < NumDialogues; Index++)
+	{
+		FDlgDialogueGeneratorOptions Options;
+		Options.Seed = Settings.Seed + Index;
+		Options.NumNodes = Settings.SearchDialogueSize;
+		UDlgDialogue* Dialogue = FDlgDialogueGenerator::GenerateDialogue(Options);
+		Dialogue->CreateGraph();
+		Dialogue->AddToRoot();
+		Dialogues.Add(Dialogue);
+	}
+
+	FDlgSearchIndex SearchIndex;
+	TArray<FDlgSearchDialogueDataRef> Snapshot;
+	{
+		FDlgBenchmarkMemoryScope MemoryScope;
+		const double StartTime = FPlatformTime::Seconds();
+		for (const UDlgDialogue* Dialogue : Dialogues)
+		{
+			Snapshot.Add(SearchIndex.IndexDialogue(Dialogue));
+		}
+		Report.AddResult(TEXT("IndexDialogue"), NumDialogues, NumDialogues, FPlatformTime::Seconds() - StartTime, MemoryScope.GetPeakBytes());
+	}
+
+	// What saving a Dialogue and the editor startup pay instead of loading it, see FDlgSearchManager::HandleOnAssetAdded
+	TArray<FString> TagValues;
+	{
+		FDlgBenchmarkMemoryScope MemoryScope;
+		const double StartTime = FPlatformTime::Seconds();
+		for (const FDlgSearchDialogueDataRef& Data : Snapshot)
+		{
+			TagValues.Add(Data->ToTagValue());
+		}
+		Report.AddResult(TEXT("ToTagValue"), NumDialogues, NumDialogues, FPlatformTime::Seconds() - StartTime, MemoryScope.GetPeakBytes());
+	}
+	{
+		FDlgSearchIndex TagSearchIndex;
+		FDlgBenchmarkMemoryScope MemoryScope;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < TagValues.Num(); Index++)
+		{
+			if (FDlgSearchDialogueDataPtr Data = FDlgSearchDialogueData::FromTagValue(TagValues[Index], Snapshot[Index]->DialoguePath))
+			{
+				TagSearchIndex.IndexDialogueData(Data.ToSharedRef());
+			}
+		}
+		Report.AddResult(TEXT("IndexTagValue"), NumDialogues, NumDialogues, FPlatformTime::Seconds() - StartTime, MemoryScope.GetPeakBytes());
+
+		Test.TestEqual(
+			FString::Printf(TEXT("The tag values have all the indexed data (NumDialogues = %d)"), NumDialogues),
+			TagSearchIndex.NumDocuments(), SearchIndex.NumDocuments()
+		);
+	}
+
+	// Rare, common and missing strings, see FDlgDialogueGenerator
+	const TArray<FString> SearchStrings = {
+		TEXT("Line 17"),
+		TEXT("Option"),
+		TEXT("Participant_1"),
+		TEXT("Event_3"),
+		TEXT("ThisStringDoesNotExist")
+	};
+
+	FDlgSearchFilter SearchFilter;
+	SearchFilter.bIncludeIndices = true;
+	SearchFilter.bIncludeNumericalTypes = true;
+	SearchFilter.bIncludeTextLocalizationData = true;
+	for (const FString& SearchString : SearchStrings)
+	{
+		SearchFilter.SearchString = SearchString;
+
+		int32 NumFullScanResults = 0;
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Settings.SearchIterations; Iteration++)
+		{
+			NumFullScanResults = Query(SearchFilter, Dialogues, nullptr);
+		}
+		Report.AddResult(FString::Printf(TEXT("FullScan `%s`"), *SearchString), NumDialogues, Settings.SearchIterations, FPlatformTime::Seconds() - StartTime);
+
+		int32 NumIndexedResults = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Settings.SearchIterations; Iteration++)
+		{
+			NumIndexedResults = Query(SearchFilter, Dialogues, &SearchIndex);
+		}
+		Report.AddResult(FString::Printf(TEXT("Indexed `%s`"), *SearchString), NumDialogues, Settings.SearchIterations, FPlatformTime::Seconds() - StartTime);
+
+		// The index must not change the results
+		Test.TestEqual(
+			FString::Printf(TEXT("Same results with the index for `%s` (NumDialogues = %d)"), *SearchString, NumDialogues),
+			NumIndexedResults, NumFullScanResults
+		);
+
+		int32 NumMatchedDialogues = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Settings.SearchIterations; Iteration++)
+		{
+			NumMatchedDialogues = MatchData(SearchFilter, Snapshot, SearchIndex);
+		}
+		Report.AddResult(FString::Printf(TEXT("MatchData `%s`"), *SearchString), NumDialogues, Settings.SearchIterations, FPlatformTime::Seconds() - StartTime);
+
+		// The data matches are a superset of the results
+		TSharedPtr<FDlgSearchResult> RootSearchResult = MakeShared<FDlgSearchResult_RootNode>();
+		for (const UDlgDialogue* Dialogue : Dialogues)
+		{
+			FDlgSearchManager::Get()->QuerySingleDialogue(SearchFilter, Dialogue, RootSearchResult);
+		}
+		Test.TestTrue(
+			FString::Printf(TEXT("The data of all the found Dialogues matches `%s` (NumDialogues = %d)"), *SearchString, NumDialogues),
+			NumMatchedDialogues >= RootSearchResult->GetChildren().Num()
+		);
+	}
+
+	for (UDlgDialogue* Dialogue : Dialogues)
+	{
+		Dialogue->RemoveFromRoot();
+	}
+}
+
+int32 FDlgSearchIndexBenchmark::Query(const FDlgSearchFilter& SearchFilter, const TArray<UDlgDialogue*>& Dialogues, const FDlgSearchIndex* SearchIndex)
+{
+	FDlgSearchManager* SearchManager = FDlgSearchManager::Get();
+	TSharedPtr<FDlgSearchResult> RootSearchResult = MakeShared<FDlgSearchResult_RootNode>();
+
+	TMap<FGuid, TArray<const UEdGraphNode*>> Candidates;
+	if (SearchIndex == nullptr || !FDlgSearchManager::CanUseSearchIndex(SearchFilter) || !SearchIndex->FindCandidateGraphNodes(SearchFilter.SearchString, Candidates))
+	{
+		for (const UDlgDialogue* Dialogue : Dialogues)
+		{
+			SearchManager->QuerySingleDialogue(SearchFilter, Dialogue, RootSearchResult);
+		}
+		return CountResults(RootSearchResult);
+	}
+
+	for (const UDlgDialogue* Dialogue : Dialogues)
+	{
+		if (const TArray<const UEdGraphNode*>* DialogueCandidates = Candidates.Find(Dialogue->GetGUID()))
+		{
+			SearchManager->QuerySingleDialogue(SearchFilter, Dialogue, RootSearchResult, DialogueCandidates);
+		}
+	}
+	return CountResults(RootSearchResult);
+}
+
+int32 FDlgSearchIndexBenchmark::MatchData(const FDlgSearchFilter& SearchFilter, const TArray<FDlgSearchDialogueDataRef>& Snapshot, const FDlgSearchIndex& SearchIndex)
+{
+	TMap<FGuid, TArray<int32>> Candidates;
+	const bool bUseSearchIndex = FDlgSearchManager::CanUseSearchIndex(SearchFilter) && SearchIndex.FindCandidates(SearchFilter.SearchString, Candidates);
+
+	int32 NumMatched = 0;
+	TArray<int32> NodeIndices;
+	for (const FDlgSearchDialogueDataRef& Data : Snapshot)
+	{
+		const TArray<int32>* CandidateNodeIndices = bUseSearchIndex ? Candidates.Find(Data->DialogueGUID) : nullptr;
+		if (bUseSearchIndex && CandidateNodeIndices == nullptr)
+		{
+			continue;
+		}
+
+		NodeIndices.Reset();
+		Data->FindMatchingNodes(SearchFilter, CandidateNodeIndices, NodeIndices);
+		if (NodeIndices.Num() > 0)
+		{
+			NumMatched++;
+		}
+	}
+	return NumMatched;
+}
+
+int32 FDlgSearchIndexBenchmark::CountResults(const TSharedPtr<FDlgSearchResult>& Result)
+{
+	int32 Count = 0;
+	for (const TSharedPtr<FDlgSearchResult>& Child : Result->GetChildren())
+	{
+		Count += 1 + CountResults(Child);
+	}
+	return Count;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgSearchIndexBenchmarkTest,
+	"DlgSystem.Benchmarks.SearchIndex",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FDlgSearchIndexBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const UDlgBenchmarkSettings* Settings = GetDefault<UDlgBenchmarkSettings>();
+	FDlgBenchmarkReport Report(TEXT("SearchIndex"));
+	for (const int32 NumDialogues : Settings->SearchDialogueCounts)
+	{
+		FDlgSearchIndexBenchmark::BenchmarkProject(Report, *this, NumDialogues, *Settings);
+	}
+
+	return Report.ReportTo(*this, TEXT("NumDialogues"));
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgSearchIndexUnsetNamesTest,
+	"DlgSystem.Editor.SearchIndexUnsetNames",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FDlgSearchIndexUnsetNamesTest::RunTest(const FString& Parameters)
+{
+	// The participant names and speakers that are not set are None, the index skips them so the full scan must too
+	FDlgDialogueGeneratorOptions Options;
+	Options.Seed = 1;
+	Options.NumNodes = 50;
+	Options.SpeechSequenceRatio = 0.5f;
+	UDlgDialogue* Dialogue = FDlgDialogueGenerator::GenerateDialogue(Options);
+	TArray<UDlgNode*> AllNodes = Dialogue->GetNodes();
+	AllNodes.Append(Dialogue->GetStartNodes());
+	for (UDlgNode* Node : AllNodes)
+	{
+		Node->SetNodeParticipantName(NAME_None);
+		if (UDlgNode_SpeechSequence* SpeechSequence = Cast<UDlgNode_SpeechSequence>(Node))
+		{
+			for (FDlgSpeechSequenceEntry& Entry : *SpeechSequence->GetMutableNodeSpeechSequence())
+			{
+				Entry.Speaker = NAME_None;
+			}
+		}
+	}
+	Dialogue->CreateGraph();
+	Dialogue->AddToRoot();
+
+	FDlgSearchIndex SearchIndex;
+	SearchIndex.IndexDialogue(Dialogue);
+	const TArray<UDlgDialogue*> Dialogues = { Dialogue };
+
+	FDlgSearchFilter SearchFilter;
+	SearchFilter.bIncludeIndices = true;
+	SearchFilter.bIncludeNumericalTypes = true;
+	SearchFilter.bIncludeTextLocalizationData = true;
+	for (const FString& SearchString : { TEXT("None"), TEXT("one"), TEXT("No"), TEXT("Line") })
+	{
+		SearchFilter.SearchString = SearchString;
+		TestEqual(
+			FString::Printf(TEXT("Same results with the index for `%s` with unset participant names"), *SearchString),
+			FDlgSearchIndexBenchmark::Query(SearchFilter, Dialogues, &SearchIndex),
+			FDlgSearchIndexBenchmark::Query(SearchFilter, Dialogues, nullptr)
+		);
+	}
+
+	Dialogue->RemoveFromRoot();
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,121 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+
+#include "DlgSystemEditor/Search/DlgSuggestionCache.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class FDlgSuggestionIndexTest
+{
+public:
+	// What the pick lists did before FDlgSuggestionIndex, every suggestion that contains the SearchText (case insensitive)
+	static TArray<int32> FilterByContains(const TArray<FString>& Suggestions, const FString& SearchText);
+
+	// Indices must have the same suggestions as FilterByContains, the ones that start with the SearchText first
+	static void TestSameAsContains(FAutomationTestBase& Test, const FDlgSuggestionIndex& SuggestionIndex, const FString& SearchText, const TArray<int32>& Indices);
+};
+
+TArray<int32> FDlgSuggestionIndexTest::FilterByContains(const TArray<FString>& Suggestions, const FString& SearchText)
+{
+	TArray<int32> Indices;
+	for (int32 Index = 0; Index < Suggestions.Num(); Index++)
+	{
+		if (SearchText.IsEmpty() || Suggestions[Index].Contains(SearchText))
+		{
+			Indices.Add(Index);
+		}
+	}
+	return Indices;
+}
+
+void FDlgSuggestionIndexTest::TestSameAsContains(FAutomationTestBase& Test, const FDlgSuggestionIndex& SuggestionIndex, const FString& SearchText, const TArray<int32>& Indices)
+{
+	const TArray<FString>& Suggestions = SuggestionIndex.GetSuggestions();
+	TArray<int32> SortedIndices = Indices;
+	SortedIndices.Sort();
+	Test.TestTrue(
+		FString::Printf(TEXT("`%s` finds the same suggestions as Contains"), *SearchText),
+		SortedIndices == FilterByContains(Suggestions, SearchText)
+	);
+
+	// Each group keeps the order of the suggestions
+	int32 NumPrefix = 0;
+	while (NumPrefix < Indices.Num() && Suggestions[Indices[NumPrefix]].StartsWith(SearchText))
+	{
+		NumPrefix++;
+	}
+	bool bIsOrdered = true;
+	for (int32 Order = 1; Order < Indices.Num(); Order++)
+	{
+		if (Order != NumPrefix && Indices[Order] < Indices[Order - 1])
+		{
+			bIsOrdered = false;
+		}
+	}
+	for (int32 Order = NumPrefix; Order < Indices.Num(); Order++)
+	{
+		if (Suggestions[Indices[Order]].StartsWith(SearchText))
+		{
+			bIsOrdered = false;
+		}
+	}
+	Test.TestTrue(FString::Printf(TEXT("`%s` finds the suggestions that start with it first, in order"), *SearchText), bIsOrdered);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgSuggestionIndexFindTest,
+	"DlgSystem.Editor.SuggestionIndex",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FDlgSuggestionIndexFindTest::RunTest(const FString& Parameters)
+{
+	// Not sorted, some only differ in case
+	const TArray<FString> Suggestions = {
+		TEXT("QuestStarted"), TEXT("HasKey"), TEXT("bHasMetKing"), TEXT("haskey_Old"), TEXT("Gold"), TEXT("PlayerGold"),
+		TEXT("GoldCount"), TEXT("Reputation_Guild"), TEXT("KEY"), TEXT("MonkeyCount"), TEXT("Keys"), TEXT("gold")
+	};
+	const FDlgSuggestionIndex SuggestionIndex(Suggestions);
+
+	const TArray<FString> SearchTexts = {
+		TEXT(""), TEXT("has"), TEXT("HAS"), TEXT("Key"), TEXT("kEy"), TEXT("gold"), TEXT("GoLd"), TEXT("ount"), TEXT("_"), TEXT("x")
+	};
+	for (const FString& SearchText : SearchTexts)
+	{
+		TArray<int32> Indices;
+		SuggestionIndex.FindSuggestions(SearchText, nullptr, Indices);
+		FDlgSuggestionIndexTest::TestSameAsContains(*this, SuggestionIndex, SearchText, Indices);
+	}
+
+	// Typing one more character narrows down the last result, it must be the same as searching everything
+	const TArray<TArray<FString>> TypedTexts = {
+		{ TEXT("k"), TEXT("ke"), TEXT("KEY"), TEXT("keys") },
+		{ TEXT("G"), TEXT("gO"), TEXT("GoL"), TEXT("gold"), TEXT("GOLDC") },
+		{ TEXT("o"), TEXT("ol"), TEXT("old") }
+	};
+	for (const TArray<FString>& Texts : TypedTexts)
+	{
+		TArray<int32> LastIndices;
+		SuggestionIndex.FindSuggestions(Texts[0], nullptr, LastIndices);
+		for (int32 TextIndex = 1; TextIndex < Texts.Num(); TextIndex++)
+		{
+			TArray<int32> NarrowedIndices;
+			SuggestionIndex.FindSuggestions(Texts[TextIndex], &LastIndices, NarrowedIndices);
+			FDlgSuggestionIndexTest::TestSameAsContains(*this, SuggestionIndex, Texts[TextIndex], NarrowedIndices);
+
+			TArray<int32> Indices;
+			SuggestionIndex.FindSuggestions(Texts[TextIndex], nullptr, Indices);
+			TestTrue(
+				FString::Printf(TEXT("`%s` narrowed down from `%s` is the same as searching everything"), *Texts[TextIndex], *Texts[TextIndex - 1]),
+				NarrowedIndices == Indices
+			);
+			LastIndices = MoveTemp(NarrowedIndices);
+		}
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
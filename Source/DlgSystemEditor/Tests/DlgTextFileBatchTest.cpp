@@ -0,0 +1,98 @@
+// Copyright Csaba Molnar, Daniel Butum. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#include "DlgSystem/Tests/DlgDialogueGenerator.h"
+#include "DlgSystem/DlgDialogue.h"
+#include "DlgSystem/IO/IDlgParser.h"
+#include "DlgSystem/IO/DlgHashWriter.h"
+#include "DlgSystemEditor/DlgEditorUtilities.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+static uint64 GetDialogueHash(const UDlgDialogue* Dialogue)
+{
+	FDlgHashWriter HashWriter(0);
+	HashWriter.Write(Dialogue->GetClass(), Dialogue);
+	return HashWriter.GetHash();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FDlgTextFileBatchTest,
+	"DlgSystem.IO.TextFileBatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FDlgTextFileBatchTest::RunTest(const FString& Parameters)
+{
+	// More dialogues than fit in one batch of the export
+	static constexpr int32 NumDialogues = 70;
+	static constexpr bool bShowProgress = false;
+
+	// The packages are never saved, only the text files next to them are written (inside the project content directory)
+	TArray<UDlgDialogue*> Dialogues;
+	for (int32 Index = 0; Index < NumDialogues; Index++)
+	{
+		FDlgDialogueGeneratorOptions Options;
+		Options.Seed = Index + 1;
+		Options.NumNodes = 20;
+		UPackage* Package = CreatePackage(*FString::Printf(TEXT("/Game/DlgSystemTests/TextFileBatch_%d"), Index));
+		UDlgDialogue* Dialogue = FDlgDialogueGenerator::GenerateDialogue(Options, Package);
+		Dialogue->AddToRoot();
+		Dialogues.Add(Dialogue);
+	}
+
+	for (const EDlgDialogueTextFormat TextFormat : { EDlgDialogueTextFormat::JSON, EDlgDialogueTextFormat::Binary })
+	{
+		const FString TextFormatName = UDlgSystemSettings::GetTextFileExtension(TextFormat);
+		const FDlgTextFileBatchResult Result = FDlgEditorUtilities::ExportDialoguesToTextFiles(Dialogues, TextFormat, bShowProgress);
+		TestTrue(FString::Printf(TEXT("The batch export succeeded (%s)"), *TextFormatName), Result.IsSuccess());
+		TestEqual(FString::Printf(TEXT("Every dialogue was exported (%s)"), *TextFormatName), Result.NumSucceeded, NumDialogues);
+
+		// Read back each file into a new dialogue, it must have the same data as the exported one
+		for (const UDlgDialogue* Dialogue : Dialogues)
+		{
+			const FString TextFileName = Dialogue->GetTextFilePathName(TextFormat);
+			TUniquePtr<IDlgParser> Parser = UDlgDialogue::CreateTextFormatParser(TextFormat);
+			Parser->InitializeParser(TextFileName);
+			if (!TestTrue(FString::Printf(TEXT("The exported file is valid (%s)"), *TextFileName), Parser->IsValidFile()))
+			{
+				continue;
+			}
+
+			UDlgDialogue* ImportedDialogue = NewObject<UDlgDialogue>(GetTransientPackage(), NAME_None, RF_Transient);
+			Parser->ReadAllProperty(ImportedDialogue->GetClass(), ImportedDialogue, ImportedDialogue);
+			TestEqual(FString::Printf(TEXT("Same number of nodes (%s)"), *TextFileName), ImportedDialogue->GetNodes().Num(), Dialogue->GetNodes().Num());
+			TestTrue(FString::Printf(TEXT("Same data after the import (%s)"), *TextFileName), GetDialogueHash(ImportedDialogue) == GetDialogueHash(Dialogue));
+		}
+
+		// The batch import of the files that were just exported must not change the dialogues
+		TArray<uint64> ExportedHashes;
+		for (const UDlgDialogue* Dialogue : Dialogues)
+		{
+			ExportedHashes.Add(GetDialogueHash(Dialogue));
+		}
+		const FDlgTextFileBatchResult ImportResult = FDlgEditorUtilities::ImportDialoguesFromTextFiles(Dialogues, TextFormat, bShowProgress);
+		TestTrue(FString::Printf(TEXT("The batch import succeeded (%s)"), *TextFormatName), ImportResult.IsSuccess());
+		TestEqual(FString::Printf(TEXT("Every dialogue was imported (%s)"), *TextFormatName), ImportResult.NumSucceeded, NumDialogues);
+		for (int32 Index = 0; Index < NumDialogues; Index++)
+		{
+			TestTrue(
+				FString::Printf(TEXT("Same data after the batch import (%s)"), *Dialogues[Index]->GetTextFilePathName(TextFormat)),
+				GetDialogueHash(Dialogues[Index]) == ExportedHashes[Index]
+			);
+		}
+	}
+
+	for (UDlgDialogue* Dialogue : Dialogues)
+	{
+		Dialogue->DeleteAllTextFiles();
+		Dialogue->RemoveFromRoot();
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS